@@ -140,6 +140,42 @@ namespace ramses
         */
         [[nodiscard]] uint32_t getInstanceCount() const;
 
+        /**
+        * @brief Sets an axis aligned bounding box of the mesh in its local (model) space.
+        *
+        * When a bounding box is set the renderer can skip rendering of the mesh
+        * whenever the box transformed by the mesh's world transformation is completely
+        * outside of the view frustum of the camera used by a render pass.
+        * It is the responsibility of the user to provide a box which encloses all vertices
+        * of the mesh (including any vertex shader displacement), otherwise the mesh
+        * might get culled although it is (partially) visible.
+        * Meshes without bounding box are never culled (default).
+        *
+        * Setting a bounding box makes the scene incompatible to renderers and scene files of Ramses versions
+        * prior to the one introducing this feature, make sure remote renderers are up to date.
+        *
+        * @param[in] minCorner Minimum corner of the bounding box, must be component-wise less or equal to \p maxCorner.
+        * @param[in] maxCorner Maximum corner of the bounding box.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setBoundingBox(const vec3f& minCorner, const vec3f& maxCorner);
+
+        /**
+        * @brief Removes bounding box previously set using #setBoundingBox, mesh will never be culled.
+        *
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool removeBoundingBox();
+
+        /**
+        * @brief Gets the bounding box of the mesh set using #setBoundingBox.
+        *
+        * @param[out] minCorner Minimum corner of the bounding box.
+        * @param[out] maxCorner Maximum corner of the bounding box.
+        * @return true if bounding box was set, false if there is no bounding box set.
+        */
+        bool getBoundingBox(vec3f& minCorner, vec3f& maxCorner) const;
+
         /**
          * Get the internal data for implementation specifics of MeshNode.
          */
@@ -221,6 +221,34 @@ namespace ramses
         */
         bool retriggerRenderOnce();
 
+        /**
+        * @brief Enable/disable sorting of renderables by their render states.
+        * @details By default renderables are rendered in the order given by render order of
+        *          render groups in the render pass and render order of renderables in the render groups.
+        *          If the content of render pass does not depend on this order (e.g. opaque geometry
+        *          with depth test enabled), state sorting can be enabled. Renderer then ignores the render orders
+        *          and renders renderables of the render pass sorted by effect, textures, geometry and render state,
+        *          so that renderables sharing these are rendered one after another and switching
+        *          of states on GPU is minimized. Renderables with equal states keep their render order.
+        *
+        *          Do not enable state sorting for render passes whose content relies on render order,
+        *          e.g. for blending or stencil based effects.
+        *
+        *          Enabling state sorting makes the scene incompatible to renderers and scene files of Ramses versions
+        *          prior to the one introducing this feature, make sure remote renderers are up to date.
+        *
+        * @param enable The flag which indicates if renderables of the render pass are to be sorted by states (Default:false)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setStateSortingEnabled(bool enable);
+
+        /**
+        * @brief Get the state sorting mode of the render pass
+        *
+        * @return Indicates if renderables of the render pass are sorted by states instead of render order
+        */
+        [[nodiscard]] bool isStateSortingEnabled() const;
+
         /**
          * Get the internal data for implementation specifics of RenderPass.
          */
@@ -74,6 +74,48 @@ namespace ramses
          */
         void setMemoryVerificationEnabled(bool enabled);
 
+        /**
+         * @brief Keep scene actions describing the whole scene cached on client side, ready to be sent to new subscribers.
+         *
+         * By default, when a renderer subscribes to a remotely published scene (#ramses::EScenePublicationMode::LocalAndRemote),
+         * the client generates scene actions describing the whole scene at that time, which can take long for large scenes.
+         * When enabled, the cached scene actions are maintained incrementally with every flush and sent immediately
+         * to new subscribers, which reduces latency when (re)subscribing at the cost of additional memory
+         * (up to twice the serialized size of the scene).
+         * Has no effect for scenes with #ramses::EScenePublicationMode::LocalOnly.
+         *
+         * @param enabled flag to enable/disable caching of scene actions for new subscribers (disabled by default)
+         */
+        void setSceneSnapshotCachingEnabled(bool enabled);
+
+        /**
+         * @brief Load all resources of the scene file when the scene is loaded instead of on demand.
+         *
+         * By default, resources are loaded from the scene file when they are needed, which is on first flush for most
+         * of them. When enabled, all resources listed in the file are loaded together while the scene is loaded (i.e. on
+         * worker thread when using #ramses::RamsesClient::loadSceneFromFileAsync), ordered by their position in the file
+         * and deserialized on multiple threads. They are kept in memory at least until the first flush of the scene.
+         * Only relevant for loading a scene.
+         *
+         * @param enabled flag to enable/disable prefetching of resources (disabled by default)
+         */
+        void setResourcePrefetchEnabled(bool enabled);
+
+        /**
+         * @brief Let the renderer update world matrices of all nodes of the scene in one pass in breadth first order.
+         *
+         * By default, the renderer computes world matrix of a node on demand by walking up its parent chain, which is
+         * efficient when only few nodes change between frames. When enabled, the renderer keeps all nodes of the scene sorted
+         * breadth first and recomputes all changed world matrices in a single linear pass every frame, which is faster
+         * for scenes with many nodes and many transformation changes per frame (e.g. animated hierarchies).
+         * The mode is stored in the scene and therefore also in saved scene files. When loading a scene from file
+         * the mode stored in the file is used if it was enabled there.
+         * Scenes consuming transformation links always use the default mode.
+         *
+         * @param enabled flag to enable/disable breadth first transformation update (disabled by default)
+         */
+        void setBreadthFirstTransformationUpdateEnabled(bool enabled);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
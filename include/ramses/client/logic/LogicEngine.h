@@ -426,6 +426,8 @@ namespace ramses
          * As an optimization #ramses::LogicNode's are only updated, if at least one input of a #ramses::LogicNode
          * has changed since the last call to #update. If the links between logic nodes create a loop,
          * this method will fail with an error and will not execute any of the logic nodes.
+         * If a #ramses::LogicNode fails, nodes executed before it keep their results and propagate them through their links,
+         * the failing node and nodes after it are not executed. This is the same with parallel update (see #enableParallelUpdate).
          *
          * @return true if the update was successful, false otherwise
          * In case of an error, use #ramses::RamsesFramework::getLastError.
@@ -483,6 +485,21 @@ namespace ramses
         */
         void setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode = EStatisticsLogMode::Compact);
 
+        /**
+        * Enables parallel execution of #update using given number of worker threads (in addition to the thread calling #update).
+        * #ramses::LogicNode's are partitioned into levels based on their links, nodes of a level depend only on nodes
+        * of previous levels. All nodes of a level with access to Lua or the ramses scene (#ramses::LuaScript, bindings, etc.)
+        * are executed first on the thread calling #update, then nodes with no such access (#ramses::AnimationNode, #ramses::TimerNode)
+        * are executed concurrently on the workers. Results of #update are identical to the non-parallel execution,
+        * also when a node fails.
+        * Parallel execution is not used while update report is enabled (see #enableUpdateReport).
+        * Worker threads are created and owned by this #LogicEngine instance.
+        *
+        * @param workerCount number of worker threads, 0 disables parallel execution (default). Maximum is 32.
+        * @return true if successful, false if worker count is out of range.
+        */
+        bool enableParallelUpdate(uint32_t workerCount);
+
         /**
          * Links a property of a #ramses::LogicNode to another #ramses::Property of another #ramses::LogicNode.
          * After linking, calls to #update will propagate the value of \p sourceProperty to
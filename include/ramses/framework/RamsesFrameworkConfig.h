@@ -256,6 +256,41 @@ namespace ramses
         */
         bool setConnectionKeepaliveSettings(std::chrono::milliseconds interval, std::chrono::milliseconds timeout);
 
+        /**
+        * @brief Configures coalescing of outgoing messages into single socket writes
+        *
+        * Messages queued for the same remote participant are written to the socket together using a gather write
+        * up to the given number of bytes. This reduces the number of system calls and write completions
+        * when sending many messages, e.g. a large scene update split into packets.
+        * A single message larger than the given size is still written at once.
+        *
+        * @param maxBytes maximum number of bytes written with one gather write, 0 disables coalescing (default: 256 KiB)
+        */
+        void setConnectionSendCoalescingSize(uint32_t maxBytes);
+
+        /**
+        * @brief Sets the directory of socket files used with #ramses::EConnectionSystem::Local
+        *
+        * All participants which should connect to each other must use the same directory.
+        * The directory is created with access for the current user only if it does not exist.
+        * Connection fails if the directory is not owned by the current user or is writable by other users.
+        *
+        * @param directory directory of socket files, empty selects $XDG_RUNTIME_DIR/ramses or /tmp/ramses-<uid> if XDG_RUNTIME_DIR is not set (default: empty)
+        */
+        void setLocalConnectionDirectory(std::string_view directory);
+
+        /**
+        * @brief Sets the number of worker threads used to compress, hash and load resources
+        *
+        * Resources of a flush, of a saved scene file and resources loaded from scene files are processed
+        * on the worker threads together with the calling thread. Worker threads are only created on first use.
+        * By default one thread less than available hardware threads is used, but at most 4.
+        *
+        * @param threadCount number of worker threads, 0 processes all resources on the calling thread
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setResourceProcessingThreadCount(uint32_t threadCount);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
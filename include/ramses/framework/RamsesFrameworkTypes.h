@@ -259,6 +259,7 @@ namespace ramses
     enum class EConnectionSystem : uint32_t
     {
         TCP,
-        Off
+        Off,
+        Local,  ///< Same host only: uses Unix domain sockets instead of TCP loopback (not available on Windows)
     };
 }
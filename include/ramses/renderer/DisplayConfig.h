@@ -351,6 +351,57 @@ namespace ramses
         */
         bool setAsyncEffectUploadEnabled(bool enabled);
 
+        /**
+        * @brief Enables or disables asynchronous upload of textures, vertex and index buffers.
+        *
+        * @details By default resource data is decompressed and uploaded to GPU within the rendering loop,
+        *          which can stall rendering when big resources are uploaded.
+        *
+        *          Enabling async resource upload moves decompression and upload of textures, vertex and index buffers
+        *          to the same shared context and thread used for async effect upload (see #setAsyncEffectUploadEnabled).
+        *          Resources are handed over to the rendering loop only after GPU finished processing the upload,
+        *          they become available for rendering with a delay of at least one frame.
+        *
+        * @param[in] enabled Set to true to enable async resource upload, false to disable it (default).
+        *
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAsyncResourceUploadEnabled(bool enabled);
+
+        /**
+        * @brief Enables or disables asynchronous read back of pixels for screenshots and #ramses::RamsesRenderer::readPixels.
+        *
+        * @details By default pixels are read back from GPU right after the requested buffer was rendered,
+        *          which blocks rendering until GPU finished all pending work.
+        *
+        *          Enabling async read pixels copies the pixels into a small ring of GPU side buffers instead
+        *          and the result is delivered as soon as GPU finished the copy, typically one or two frames later.
+        *          If all buffers of the ring are in use, the blocking read back is used as fallback.
+        *          The result is reported using the same renderer event as with blocking read back.
+        *
+        * @param[in] enabled Set to true to enable async read pixels, false to disable it (default).
+        *
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAsyncReadPixelsEnabled(bool enabled);
+
+        /**
+        * @brief Enables or disables rendering of scenes via recorded command lists.
+        *
+        * @details By default scenes are traversed and rendering commands are submitted to the graphics device in a single pass.
+        *
+        *          With command recording enabled, rendering commands of each scene are first recorded into a command list
+        *          which is then executed on the graphics device. Recording does not access the graphics device, so if scene update
+        *          worker threads are configured (#ramses::RendererConfig::setSceneUpdateWorkerCount) scenes are recorded concurrently.
+        *          Command list of a scene which was not modified is executed again without traversing the scene.
+        *          This applies to framebuffer and offscreen buffers, interruptible offscreen buffers are always rendered directly.
+        *
+        * @param[in] enabled Set to true to enable render command recording, false to disable it (default).
+        *
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setRenderCommandRecordingEnabled(bool enabled);
+
         /**
          * @brief      Set the name to be used for the embedded compositing
          *             display socket name.
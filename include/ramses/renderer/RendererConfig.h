@@ -104,6 +104,30 @@ namespace ramses
         */
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        /**
+        * @brief   Set number of worker threads used to update scenes in parallel.
+        * @details Transformation caches of mapped scenes and data links between them are updated
+        *          at the beginning of every frame. With a non-zero worker count scenes which do not
+        *          depend on each other (via links) are updated concurrently on a pool of worker threads
+        *          (display thread takes part in the update too). Scenes depending on other scenes are
+        *          updated only after their providers are updated.
+        *          The workers are also used when applying large flushes, uniform values set within
+        *          a flush are applied concurrently for different data instances.
+        *          A value of zero disables parallel update and is the default.
+        *          Each display has its own set of workers.
+        *
+        * @param[in] workerCount Number of worker threads, maximum is 32
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setSceneUpdateWorkerCount(uint32_t workerCount);
+
+        /**
+        * @brief Get the number of worker threads used to update scenes in parallel
+        *
+        * @return Number of worker threads, zero means scenes are updated sequentially on display thread
+        */
+        [[nodiscard]] uint32_t getSceneUpdateWorkerCount() const;
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
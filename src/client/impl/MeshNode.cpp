@@ -110,6 +110,25 @@ namespace ramses
         return m_impl.getInstanceCount();
     }
 
+    bool MeshNode::setBoundingBox(const vec3f& minCorner, const vec3f& maxCorner)
+    {
+        const bool status = m_impl.setBoundingBox(minCorner, maxCorner);
+        LOG_HL_CLIENT_API6(status, minCorner.x, minCorner.y, minCorner.z, maxCorner.x, maxCorner.y, maxCorner.z);
+        return status;
+    }
+
+    bool MeshNode::removeBoundingBox()
+    {
+        const bool status = m_impl.removeBoundingBox();
+        LOG_HL_CLIENT_API_NOARG(status);
+        return status;
+    }
+
+    bool MeshNode::getBoundingBox(vec3f& minCorner, vec3f& maxCorner) const
+    {
+        return m_impl.getBoundingBox(minCorner, maxCorner);
+    }
+
     internal::MeshNodeImpl& MeshNode::impl()
     {
         return m_impl;
@@ -233,6 +233,38 @@ namespace ramses::internal
         return true;
     }
 
+    bool MeshNodeImpl::setBoundingBox(const vec3f& minCorner, const vec3f& maxCorner)
+    {
+        const ramses::internal::BoundingBox boundingBox{ minCorner, maxCorner };
+        if (!boundingBox.isValid())
+        {
+            getErrorReporting().set("MeshNode::setBoundingBox failed - minimum corner must be less or equal to maximum corner in all components.", *this);
+            return false;
+        }
+
+        getIScene().setRenderableBoundingBox(m_renderableHandle, boundingBox);
+        return true;
+    }
+
+    bool MeshNodeImpl::removeBoundingBox()
+    {
+        // no scene action if there is no box, keeps scenes not using bounding boxes compatible to older renderers
+        if (getIScene().getRenderable(m_renderableHandle).boundingBox.isValid())
+            getIScene().setRenderableBoundingBox(m_renderableHandle, {});
+        return true;
+    }
+
+    bool MeshNodeImpl::getBoundingBox(vec3f& minCorner, vec3f& maxCorner) const
+    {
+        const auto& boundingBox = getIScene().getRenderable(m_renderableHandle).boundingBox;
+        if (!boundingBox.isValid())
+            return false;
+
+        minCorner = boundingBox.min;
+        maxCorner = boundingBox.max;
+        return true;
+    }
+
     ramses::internal::RenderableHandle MeshNodeImpl::getRenderableHandle() const
     {
         return m_renderableHandle;
@@ -55,6 +55,9 @@ namespace ramses::internal
         [[nodiscard]] uint32_t getInstanceCount() const;
         bool setStartVertex(uint32_t startVertex);
         [[nodiscard]] uint32_t getStartVertex() const;
+        bool setBoundingBox(const vec3f& minCorner, const vec3f& maxCorner);
+        bool removeBoundingBox();
+        bool getBoundingBox(vec3f& minCorner, vec3f& maxCorner) const;
 
         [[nodiscard]] ramses::internal::RenderableHandle   getRenderableHandle() const;
 
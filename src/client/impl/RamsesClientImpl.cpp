@@ -34,6 +34,7 @@
 #include "internal/Components/FileInputStreamContainer.h"
 #include "internal/Components/MemoryInputStreamContainer.h"
 #include "internal/Components/OffsetFileInputStreamContainer.h"
+#include "internal/Components/MappedFileInputStreamContainer.h"
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/ClientCommands/PrintSceneList.h"
 #include "internal/ClientCommands/FlushSceneVersion.h"
@@ -60,11 +61,40 @@
 
 #include <cstdint>
 #include <array>
+#include <algorithm>
 
 namespace ramses::internal
 {
     static const bool clientRegisterSuccess = ClientFactory::RegisterClientFactory();
 
+    // Scene files are read from a memory mapping if possible, scene objects are then deserialized directly
+    // from mapped memory without prefetching. Returns nullptr if file cannot be mapped, fd is not taken over in that case.
+    static InputStreamContainerSPtr TryMapSceneFile(std::string_view fileName)
+    {
+        auto mappedFile = std::make_shared<MappedFileInputStreamContainer>(fileName);
+        return mappedFile->getStream().getState() == EStatus::Ok ? mappedFile : nullptr;
+    }
+
+    static InputStreamContainerSPtr TryMapSceneFile(int fd, size_t offset, size_t length)
+    {
+        auto mappedFile = std::make_shared<MappedFileInputStreamContainer>(fd, offset, length);
+        return mappedFile->getStream().getState() == EStatus::Ok ? mappedFile : nullptr;
+    }
+
+    // memory backed streams fail to seek beyond their end, resources are loaded lazily from them later on
+    // and must not touch pages beyond end of a mapped file
+    static bool ResourcesOfTOCAreInStream(IInputStream& inputStream, const ResourceTableOfContents& toc)
+    {
+        uint64_t resourcesEnd = 0u;
+        for (const auto& entry : toc.getFileContents())
+            resourcesEnd = std::max(resourcesEnd, static_cast<uint64_t>(entry.value.offsetInBytes) + entry.value.sizeInBytes);
+
+        size_t pos = 0u;
+        return inputStream.getPos(pos) == EStatus::Ok &&
+            inputStream.seek(static_cast<int64_t>(resourcesEnd), IInputStream::Seek::FromBeginning) == EStatus::Ok &&
+            inputStream.seek(static_cast<int64_t>(pos), IInputStream::Seek::FromBeginning) == EStatus::Ok;
+    }
+
     RamsesClientImpl::RamsesClientImpl(RamsesFrameworkImpl& framework,  std::string_view applicationName)
         : RamsesObjectImpl(ERamsesObjectType::Client, applicationName)
         , m_appLogic(framework.getParticipantAddress().getParticipantId(), framework.getFrameworkLock())
@@ -216,7 +246,8 @@ namespace ramses::internal
         managedResources.erase(std::unique(managedResources.begin(), managedResources.end()), managedResources.end());
 
         // write LL-TOC and LL resources
-        ramses::internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress);
+        ramses::internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress,
+            &m_framework.getResourceComponent().getResourceCompressionThreadPool());
     }
 
     ramses::internal::ManagedResource RamsesClientImpl::getResource(ramses::internal::ResourceContentHash hash) const
@@ -332,8 +363,22 @@ namespace ramses::internal
         }
         else
         {
-            // this path will be used in the future when creating scene from user provided stream
+            // stream is memory backed (e.g. mapped file), scene objects are deserialized directly from it.
+            // Seeking to end of scene objects fails if file is too small, so no page beyond end of file is touched.
+            size_t sceneObjectPos = 0u;
+            if (inputStream.getPos(sceneObjectPos) != ramses::internal::EStatus::Ok ||
+                inputStream.seek(static_cast<int64_t>(llResourceStart), ramses::internal::IInputStream::Seek::FromBeginning) != ramses::internal::EStatus::Ok ||
+                inputStream.seek(static_cast<int64_t>(sceneObjectPos), ramses::internal::IInputStream::Seek::FromBeginning) != ramses::internal::EStatus::Ok)
+            {
+                LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::{}: scene source {} is smaller than its scene data", cconfig.caller, cconfig.dataSource);
+                return nullptr;
+            }
             scene = loadSceneObjectFromStream(cconfig.caller, cconfig.dataSource, inputStream, cconfig.config);
+            if (scene && inputStream.seek(static_cast<int64_t>(llResourceStart), ramses::internal::IInputStream::Seek::FromBeginning) != ramses::internal::EStatus::Ok)
+            {
+                LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::{}: Failed seeking to resources in scene source {}", cconfig.caller, cconfig.dataSource);
+                return nullptr;
+            }
         }
         if (!scene)
         {
@@ -344,9 +389,20 @@ namespace ramses::internal
         // calls on m_appLogic are thread safe
         // register stream for on-demand resource loading (LL-Resources)
         ramses::internal::ResourceTableOfContents loadedTOC;
-        loadedTOC.readTOCPosAndTOCFromStream(inputStream);
+        if (!loadedTOC.readTOCPosAndTOCFromStream(inputStream))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::{}: Failed reading resource table of contents from scene source {}", cconfig.caller, cconfig.dataSource);
+            return nullptr;
+        }
+        if (!cconfig.prefetchData && !ResourcesOfTOCAreInStream(inputStream, loadedTOC))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::{}: scene source {} is smaller than its resources", cconfig.caller, cconfig.dataSource);
+            return nullptr;
+        }
         const ramses::internal::SceneFileHandle fileHandle = m_appLogic.addResourceFile(cconfig.streamContainer, loadedTOC);
         scene->m_impl.setSceneFileHandle(fileHandle);
+        if (cconfig.config.getResourcePrefetchEnabled())
+            scene->m_impl.setPrefetchedResources(m_appLogic.prefetchResourceFile(fileHandle));
 
         LOG_INFO(CONTEXT_CLIENT, "RamsesClient::{}: Source '{}' has handle {}", cconfig.caller, cconfig.dataSource, fileHandle);
 
@@ -361,10 +417,12 @@ namespace ramses::internal
             return nullptr;
         }
 
+        auto mappedFile = TryMapSceneFile(fileName);
+        const bool prefetchData = !mappedFile;
         return loadSceneSynchonousCommon({
                 "loadSceneFromFile",
                 std::string{fileName},
-                std::make_shared<ramses::internal::FileInputStreamContainer>(fileName), true, config
+                mappedFile ? mappedFile : std::make_shared<ramses::internal::FileInputStreamContainer>(fileName), prefetchData, config
             });
     }
 
@@ -404,11 +462,13 @@ namespace ramses::internal
             return nullptr;
         }
 
+        auto mappedFile = TryMapSceneFile(fd, offset, length);
+        const bool prefetchData = !mappedFile;
         return loadSceneSynchonousCommon(SceneCreationConfig{
                 "loadSceneFromFileDescriptor",
                 fmt::format("<filedescriptor fd:{} offset:{} length:{}>", fd, offset, length),
-                std::make_shared<ramses::internal::OffsetFileInputStreamContainer>(fd, offset, length),
-                true,
+                mappedFile ? mappedFile : std::make_shared<ramses::internal::OffsetFileInputStreamContainer>(fd, offset, length),
+                prefetchData,
                 config
             });
     }
@@ -514,12 +574,14 @@ namespace ramses::internal
             return false;
         }
 
+        auto mappedFile = TryMapSceneFile(stdFilename);
+        const bool prefetchData = !mappedFile;
         auto* task =
             new LoadSceneRunnable(*this, SceneCreationConfig{
                     "loadSceneFromFileAsync",
                     stdFilename,
-                    std::make_shared<ramses::internal::FileInputStreamContainer>(stdFilename),
-                    true,
+                    mappedFile ? mappedFile : std::make_shared<ramses::internal::FileInputStreamContainer>(stdFilename),
+                    prefetchData,
                     config
                 });
         m_loadFromFileTaskQueue.enqueue(*task);
@@ -394,4 +394,15 @@ namespace ramses::internal
         getIScene().retriggerRenderPassRenderOnce(m_renderPassHandle);
         return true;
     }
+
+    bool RenderPassImpl::setStateSortingEnabled(bool enable)
+    {
+        getIScene().setRenderPassStateSorting(m_renderPassHandle, enable);
+        return true;
+    }
+
+    bool RenderPassImpl::isStateSortingEnabled() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).isStateSortingEnabled;
+    }
 }
@@ -75,6 +75,8 @@ namespace ramses::internal
         bool setRenderOnce(bool enable);
         [[nodiscard]] bool isRenderOnce() const;
         bool retriggerRenderOnce();
+        bool setStateSortingEnabled(bool enable);
+        [[nodiscard]] bool isStateSortingEnabled() const;
 
         [[nodiscard]] RenderPassHandle getRenderPassHandle() const;
 
@@ -71,4 +71,22 @@ namespace ramses
         m_impl->setMemoryVerificationEnabled(enabled);
         LOG_HL_CLIENT_API1(true, enabled);
     }
+
+    void SceneConfig::setSceneSnapshotCachingEnabled(bool enabled)
+    {
+        m_impl->setSceneSnapshotCachingEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setResourcePrefetchEnabled(bool enabled)
+    {
+        m_impl->setResourcePrefetchEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setBreadthFirstTransformationUpdateEnabled(bool enabled)
+    {
+        m_impl->setBreadthFirstTransformationUpdateEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
 }
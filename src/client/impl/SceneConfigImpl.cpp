@@ -39,4 +39,34 @@ namespace ramses::internal
     {
         return m_memoryVerificationEnabled;
     }
+
+    void SceneConfigImpl::setSceneSnapshotCachingEnabled(bool enabled)
+    {
+        m_sceneSnapshotCachingEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getSceneSnapshotCachingEnabled() const
+    {
+        return m_sceneSnapshotCachingEnabled;
+    }
+
+    void SceneConfigImpl::setResourcePrefetchEnabled(bool enabled)
+    {
+        m_resourcePrefetchEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getResourcePrefetchEnabled() const
+    {
+        return m_resourcePrefetchEnabled;
+    }
+
+    void SceneConfigImpl::setBreadthFirstTransformationUpdateEnabled(bool enabled)
+    {
+        m_breadthFirstTransformationUpdateEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getBreadthFirstTransformationUpdateEnabled() const
+    {
+        return m_breadthFirstTransformationUpdateEnabled;
+    }
 }
@@ -19,14 +19,23 @@ namespace ramses::internal
         void setPublicationMode(EScenePublicationMode publicationMode);
         void setMemoryVerificationEnabled(bool enabled);
         void setSceneId(sceneId_t sceneId);
+        void setSceneSnapshotCachingEnabled(bool enabled);
+        void setResourcePrefetchEnabled(bool enabled);
+        void setBreadthFirstTransformationUpdateEnabled(bool enabled);
 
         [[nodiscard]] EScenePublicationMode getPublicationMode() const;
         [[nodiscard]] bool getMemoryVerificationEnabled() const;
         [[nodiscard]] sceneId_t getSceneId() const;
+        [[nodiscard]] bool getSceneSnapshotCachingEnabled() const;
+        [[nodiscard]] bool getResourcePrefetchEnabled() const;
+        [[nodiscard]] bool getBreadthFirstTransformationUpdateEnabled() const;
 
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode::LocalOnly;
         sceneId_t m_sceneId;
         bool m_memoryVerificationEnabled = true;
+        bool m_sceneSnapshotCachingEnabled = false;
+        bool m_resourcePrefetchEnabled = false;
+        bool m_breadthFirstTransformationUpdateEnabled = false;
     };
 }
@@ -118,7 +118,10 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_CLIENT, "Scene::Scene: sceneId {}, publicationMode {}", scene.getSceneId(), sceneConfig.getPublicationMode() == EScenePublicationMode::LocalAndRemote ? "LocalAndRemote" : "LocalOnly");
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
         const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode::LocalOnly;
-        getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
+        getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization, sceneConfig.getSceneSnapshotCachingEnabled());
+        // distributed to renderer with first flush, scene loaded from file can still set its own mode afterwards
+        if (sceneConfig.getBreadthFirstTransformationUpdateEnabled())
+            m_scene.setTransformationUpdateMode(ETransformationUpdateMode::BreadthFirst);
     }
 
     SceneImpl::~SceneImpl()
@@ -1277,6 +1280,7 @@ namespace ramses::internal
             return false;
         }
         getStatisticCollection().statFlushesTriggered.incCounter(1);
+        m_prefetchedResources.clear();
 
         return true;
     }
@@ -1919,6 +1923,11 @@ namespace ramses::internal
         m_sceneFileHandle = handle;
     }
 
+    void SceneImpl::setPrefetchedResources(ramses::internal::ManagedResourceVector resources)
+    {
+        m_prefetchedResources = std::move(resources);
+    }
+
     void SceneImpl::closeSceneFile()
     {
         if (!m_sceneFileHandle.isValid())
@@ -253,6 +253,7 @@ namespace ramses::internal
         bool createAndDeserializeObjectImpls(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext, uint32_t count);
 
         void setSceneFileHandle(ramses::internal::SceneFileHandle handle);
+        void setPrefetchedResources(ramses::internal::ManagedResourceVector resources);
         void closeSceneFile();
         ramses::internal::SceneFileHandle getSceneFileHandle() const;
 
@@ -335,6 +336,8 @@ namespace ramses::internal
         std::string m_effectErrorMessages;
 
         ramses::internal::SceneFileHandle m_sceneFileHandle;
+        // resources prefetched when scene was loaded, kept until first flush takes them over
+        ramses::internal::ManagedResourceVector m_prefetchedResources;
 
         bool m_sendEffectTimeSync = false;
     };
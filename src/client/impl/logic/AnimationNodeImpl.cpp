@@ -124,6 +124,12 @@ namespace ramses::internal
         return std::nullopt;
     }
 
+    bool AnimationNodeImpl::canUpdateConcurrently() const
+    {
+        // reads only own inputs and channel data, writes only own outputs
+        return true;
+    }
+
     void AnimationNodeImpl::updateChannel(size_t channelIdx, float localAnimationTime)
     {
         const auto& channelWorkData = m_channelsWorkData[channelIdx];
@@ -205,6 +205,11 @@ namespace ramses
         m_impl.setStatisticsLoggingRate(loggingRate, mode);
     }
 
+    bool LogicEngine::enableParallelUpdate(uint32_t workerCount)
+    {
+        return m_impl.enableParallelUpdate(workerCount);
+    }
+
     bool LogicEngine::link(Property& sourceProperty, Property& targetProperty)
     {
         return m_impl.link(sourceProperty, targetProperty);
@@ -71,6 +71,7 @@
 #include "fmt/format.h"
 
 #include <string>
+#include <algorithm>
 #include <fstream>
 #include <streambuf>
 
@@ -379,35 +380,29 @@ namespace ramses::internal
         return m_apiObjects->getLogicNodeDependencies().isLinked(logicNode.impl());
     }
 
-    size_t LogicEngineImpl::activateLinksRecursive(PropertyImpl& output)
+    size_t LogicEngineImpl::activateLinks(LogicNodeImpl& node)
     {
-        size_t activatedLinks = 0u;
+        // after links changed all values are propagated, otherwise only values of outputs which changed since last activation
+        const bool propagateAll = node.updateOutgoingLinks();
+        const auto& outgoingLinks = node.getOutgoingLinks();
 
-        const auto childCount = output.getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
+        size_t activatedLinks = 0u;
+        for (const auto& outLink : outgoingLinks)
         {
-            PropertyImpl& child = output.getChild(i)->impl();
+            if (!propagateAll && !outLink.activateAlways && !outLink.source->valueChangedSinceLinkActivation())
+                continue;
 
-            if (TypeUtils::CanHaveChildren(child.getType()))
-            {
-                activatedLinks += activateLinksRecursive(child);
-            }
-            else
+            const bool valueChanged = outLink.target->setValue(outLink.source->getValue());
+            if (valueChanged || outLink.activateAlways)
             {
-                const auto& outgoingLinks = child.getOutgoingLinks();
-                for (const auto& outLink : outgoingLinks)
-                {
-                    PropertyImpl* linkedProp = outLink.property;
-                    const bool valueChanged = linkedProp->setValue(child.getValue());
-                    if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
-                    {
-                        linkedProp->getLogicNode().setDirty(true);
-                        ++activatedLinks;
-                    }
-                }
+                outLink.target->getLogicNode().setDirty(true);
+                ++activatedLinks;
             }
         }
 
+        for (const auto& outLink : outgoingLinks)
+            outLink.source->resetValueChangedSinceLinkActivation();
+
         return activatedLinks;
     }
 
@@ -436,7 +431,10 @@ namespace ramses::internal
         // force dirty all timer nodes, anchor points and skinbindings
         setNodeToBeAlwaysUpdatedDirty();
 
-        const bool success = updateNodes(*sortedNodes);
+        // update report tracks execution of every node, parallel update is then not used
+        const bool success = (m_updateThreadPool && !m_updateReportEnabled) ?
+            updateNodesInParallel(m_apiObjects->getLogicNodeDependencies().getNodeLevels()) :
+            updateNodes(*sortedNodes);
 
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
@@ -476,14 +474,7 @@ namespace ramses::internal
                 return false;
             }
 
-            Property* outputs = node.getOutputs();
-            if (outputs != nullptr)
-            {
-                const size_t activatedLinks = activateLinksRecursive(outputs->impl());
-
-                if (m_statisticsEnabled || m_updateReportEnabled)
-                    m_updateReport.linksActivated(activatedLinks);
-            }
+            activateNodeOutputs(node);
 
             if (m_updateReportEnabled)
                 m_updateReport.nodeExecutionFinished();
@@ -494,6 +485,100 @@ namespace ramses::internal
         return true;
     }
 
+    bool LogicEngineImpl::updateNodesInParallel(const std::vector<NodeVector>& nodeLevels)
+    {
+        for (const auto& level : nodeLevels)
+        {
+            m_levelNodesToUpdate.clear();
+            m_concurrentNodesToUpdate.clear();
+            for (LogicNodeImpl* node : level)
+            {
+                if (shouldUpdateNode(*node))
+                    m_levelNodesToUpdate.push_back(node);
+            }
+
+            // nodes accessing Lua state or ramses scene are updated one by one on calling thread first,
+            // so that a failing one stops the update before any node sorted after it is executed, same as serial update
+            LogicNodeImpl* failedNode = nullptr;
+            std::optional<LogicNodeRuntimeError> error;
+            for (LogicNodeImpl* node : m_levelNodesToUpdate)
+            {
+                if (node->canUpdateConcurrently())
+                    continue;
+
+                if (m_statisticsEnabled)
+                    m_statistics.nodeExecuted();
+                error = node->update();
+                if (error)
+                {
+                    failedNode = node;
+                    break;
+                }
+            }
+
+            // remaining nodes are distributed to workers, after a failure only those sorted before failed node
+            for (LogicNodeImpl* node : m_levelNodesToUpdate)
+            {
+                if (node == failedNode)
+                    break;
+                if (!node->canUpdateConcurrently())
+                    continue;
+
+                m_concurrentNodesToUpdate.push_back(node);
+                if (m_statisticsEnabled)
+                    m_statistics.nodeExecuted();
+            }
+
+            m_concurrentNodesErrors.clear();
+            m_concurrentNodesErrors.resize(m_concurrentNodesToUpdate.size());
+            m_updateThreadPool->execute(m_concurrentNodesToUpdate,
+                [this](size_t nodeIdx) { m_concurrentNodesErrors[nodeIdx] = m_concurrentNodesToUpdate[nodeIdx]->update(); });
+
+            // concurrently updated nodes are all sorted before failed node, so their error comes first in sorted order.
+            // They do not access anything but own properties, exclusive nodes sorted after them are not affected by their failure
+            const auto concurrentErrorIt = std::find_if(m_concurrentNodesErrors.begin(), m_concurrentNodesErrors.end(), [](const auto& nodeError) { return nodeError.has_value(); });
+            if (concurrentErrorIt != m_concurrentNodesErrors.end())
+            {
+                failedNode = m_concurrentNodesToUpdate[static_cast<size_t>(std::distance(m_concurrentNodesErrors.begin(), concurrentErrorIt))];
+                error = std::move(*concurrentErrorIt);
+            }
+
+            // links are activated in sorted order on calling thread so that values and dirty states match serial update,
+            // which would have finished nodes sorted before failed node
+            for (LogicNodeImpl* node : m_levelNodesToUpdate)
+            {
+                if (node == failedNode)
+                    break;
+                activateNodeOutputs(*node);
+                node->setDirty(false);
+            }
+
+            if (failedNode != nullptr)
+            {
+                getErrorReporting().set(error->message, &failedNode->getLogicObject());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool LogicEngineImpl::shouldUpdateNode(LogicNodeImpl& node) const
+    {
+        return node.isDirty() || !m_nodeDirtyMechanismEnabled;
+    }
+
+    void LogicEngineImpl::activateNodeOutputs(LogicNodeImpl& node)
+    {
+        if (node.getOutputs() != nullptr)
+        {
+            const size_t activatedLinks = activateLinks(node);
+
+            if (m_statisticsEnabled || m_updateReportEnabled)
+                m_updateReport.linksActivated(activatedLinks);
+        }
+    }
+
     void LogicEngineImpl::setNodeToBeAlwaysUpdatedDirty()
     {
         // force timer nodes dirty so they can update their ticker
@@ -663,6 +748,27 @@ namespace ramses::internal
         }
     }
 
+    bool LogicEngineImpl::enableParallelUpdate(uint32_t workerCount)
+    {
+        if (workerCount > MaxParallelUpdateWorkerCount)
+        {
+            getErrorReporting().set(fmt::format("Failed to enable parallel update with {} workers, maximum supported worker count is {}", workerCount, MaxParallelUpdateWorkerCount), *this);
+            return false;
+        }
+
+        if (workerCount == 0u)
+            m_updateThreadPool.reset();
+        else if (getParallelUpdateWorkerCount() != workerCount)
+            m_updateThreadPool = std::make_unique<LogicNodeUpdateThreadPool>(workerCount);
+
+        return true;
+    }
+
+    uint32_t LogicEngineImpl::getParallelUpdateWorkerCount() const
+    {
+        return m_updateThreadPool ? m_updateThreadPool->getWorkerCount() : 0u;
+    }
+
     size_t LogicEngineImpl::getTotalSerializedSize(ELuaSavingMode luaSavingMode) const
     {
         return ApiObjectsSerializedSize::GetTotalSerializedSize(*m_apiObjects, luaSavingMode);
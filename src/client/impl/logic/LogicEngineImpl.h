@@ -14,10 +14,12 @@
 #include "ramses/client/logic/LogicEngineReport.h"
 #include "ramses/framework/DataTypes.h"
 #include "ramses/framework/EFeatureLevel.h"
+#include "impl/logic/LogicNodeImpl.h"
 #include "internal/logic/ApiObjects.h"
 #include "internal/logic/LogicNodeDependencies.h"
 #include "internal/logic/UpdateReport.h"
 #include "internal/logic/LogicNodeUpdateStatistics.h"
+#include "internal/logic/LogicNodeUpdateThreadPool.h"
 #include "internal/logic/ApiObjectsSerializedSize.h"
 
 #include "ramses/framework/RamsesFrameworkTypes.h"
@@ -124,6 +126,10 @@ namespace ramses::internal
 
         void setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode = EStatisticsLogMode::Compact);
 
+        static constexpr uint32_t MaxParallelUpdateWorkerCount = 32u;
+        bool enableParallelUpdate(uint32_t workerCount);
+        [[nodiscard]] uint32_t getParallelUpdateWorkerCount() const;
+
         [[nodiscard]] size_t getTotalSerializedSize(ELuaSavingMode luaSavingMode) const;
         template<typename T>
         [[nodiscard]] size_t getSerializedSize(ELuaSavingMode luaSavingMode) const;
@@ -136,10 +142,13 @@ namespace ramses::internal
 
     private:
         bool save(flatbuffers::FlatBufferBuilder& builder, const SaveFileConfigImpl& config);
-        size_t activateLinksRecursive(PropertyImpl& output);
+        size_t activateLinks(LogicNodeImpl& node);
         void setNodeToBeAlwaysUpdatedDirty();
 
         [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateNodesInParallel(const std::vector<NodeVector>& nodeLevels);
+        [[nodiscard]] bool shouldUpdateNode(LogicNodeImpl& node) const;
+        void activateNodeOutputs(LogicNodeImpl& node);
 
         [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, bool enableMemoryVerification, const std::string& dataSourceDescription);
 
@@ -153,6 +162,12 @@ namespace ramses::internal
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
         std::vector<char>         m_byteBuffer;
+
+        std::unique_ptr<LogicNodeUpdateThreadPool> m_updateThreadPool;
+        // per level scratch data for parallel update
+        NodeVector m_levelNodesToUpdate;
+        NodeVector m_concurrentNodesToUpdate;
+        std::vector<std::optional<LogicNodeRuntimeError>> m_concurrentNodesErrors;
     };
 
     template<typename T>
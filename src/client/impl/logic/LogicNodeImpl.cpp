@@ -11,6 +11,7 @@
 #include "ramses/client/logic/Property.h"
 
 #include "impl/logic/PropertyImpl.h"
+#include "internal/logic/TypeUtils.h"
 
 namespace ramses::internal
 {
@@ -51,6 +52,54 @@ namespace ramses::internal
         return m_dirty;
     }
 
+    bool LogicNodeImpl::updateOutgoingLinks()
+    {
+        if (m_outgoingLinksValid)
+            return false;
+
+        m_outgoingLinks.clear();
+        Property* outputs = getOutputs();
+        if (outputs != nullptr)
+            CollectOutgoingLinks(outputs->impl(), m_outgoingLinks);
+        m_outgoingLinksValid = true;
+
+        return true;
+    }
+
+    const LogicNodeImpl::OutgoingLinks& LogicNodeImpl::getOutgoingLinks() const
+    {
+        assert(m_outgoingLinksValid);
+        return m_outgoingLinks;
+    }
+
+    void LogicNodeImpl::invalidateOutgoingLinks()
+    {
+        m_outgoingLinksValid = false;
+    }
+
+    void LogicNodeImpl::CollectOutgoingLinks(PropertyImpl& output, OutgoingLinks& outgoingLinks)
+    {
+        const auto childCount = output.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            PropertyImpl& child = output.getChild(i)->impl();
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                CollectOutgoingLinks(child, outgoingLinks);
+            }
+            else
+            {
+                for (const auto& outLink : child.getOutgoingLinks())
+                    outgoingLinks.push_back({ &child, outLink.property, outLink.property->getPropertySemantics() == EPropertySemantics::AnimationInput });
+            }
+        }
+    }
+
+    bool LogicNodeImpl::canUpdateConcurrently() const
+    {
+        return false;
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
     {
         assert(!m_inputs);
@@ -35,14 +35,39 @@ namespace ramses::internal
 
         virtual void createRootProperties() = 0;
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
+        // True if update() only accesses data owned by this node (no Lua state, no ramses scene),
+        // such node can be updated concurrently with other nodes which do not depend on it
+        [[nodiscard]] virtual bool canUpdateConcurrently() const;
 
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Flat list of all links going out of leaf properties of getOutputs(), used to propagate values
+        // after update() without walking the output property tree
+        struct OutgoingLink
+        {
+            PropertyImpl* source = nullptr;
+            PropertyImpl* target = nullptr;
+            // animation inputs make their node dirty even if linked value did not change
+            bool activateAlways = false;
+        };
+        using OutgoingLinks = std::vector<OutgoingLink>;
+
+        // Rebuilds outgoing links if invalidated, returns true if rebuilt (all values have to be propagated then)
+        [[nodiscard]] bool updateOutgoingLinks();
+        [[nodiscard]] const OutgoingLinks& getOutgoingLinks() const;
+        void invalidateOutgoingLinks();
+
     protected:
         void setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
 
     private:
+        static void CollectOutgoingLinks(PropertyImpl& output, OutgoingLinks& outgoingLinks);
+
+        // declared before properties, links are invalidated when linked properties get destroyed
+        OutgoingLinks m_outgoingLinks;
+        bool m_outgoingLinksValid = false;
+
         PropertyUniquePtr m_inputs;
         PropertyUniquePtr m_outputs;
 
@@ -604,12 +604,24 @@ namespace ramses::internal
         }
 
         const bool valueChanged = (m_value != value);
+        if (valueChanged)
+            m_valueChangedSinceLinkActivation = true;
 
         m_value = std::move(value);
 
         return valueChanged;
     }
 
+    bool PropertyImpl::valueChangedSinceLinkActivation() const
+    {
+        return m_valueChangedSinceLinkActivation;
+    }
+
+    void PropertyImpl::resetValueChangedSinceLinkActivation()
+    {
+        m_valueChangedSinceLinkActivation = false;
+    }
+
     void PropertyImpl::setPropertyInstance(Property& property)
     {
         assert(m_propertyInstance == nullptr);
@@ -707,6 +719,8 @@ namespace ramses::internal
 
         output.m_outgoingLinks.push_back({ this, isWeakLink });
         m_incomingLink = { &output, isWeakLink };
+        if (output.m_logicNode != nullptr)
+            output.m_logicNode->invalidateOutgoingLinks();
     }
 
     void PropertyImpl::resetIncomingLink()
@@ -716,6 +730,8 @@ namespace ramses::internal
         auto linkIter = std::find_if(srcPropertyLinks.begin(), srcPropertyLinks.end(), [this](const auto& p) { return p.property == this; });
         assert(linkIter != srcPropertyLinks.end());
         srcPropertyLinks.erase(linkIter);
+        if (m_incomingLink.property->m_logicNode != nullptr)
+            m_incomingLink.property->m_logicNode->invalidateOutgoingLinks();
         m_incomingLink = { nullptr, false };
     }
 
@@ -104,6 +104,9 @@ namespace ramses::internal
 
         // Generic setter. Can optionally skip dirty-check
         bool setValue(PropertyValue value);
+        // True if value changed since last reset, used to propagate only changed outputs over links
+        [[nodiscard]] bool valueChangedSinceLinkActivation() const;
+        void resetValueChangedSinceLinkActivation();
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
 
@@ -151,6 +154,7 @@ namespace ramses::internal
         LogicNodeImpl* m_logicNode = nullptr;
 
         bool m_bindingInputHasNewValue = false;
+        bool m_valueChangedSinceLinkActivation = false;
         EPropertySemantics m_semantics;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> SerializeRecursive(
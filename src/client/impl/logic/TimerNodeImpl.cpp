@@ -55,6 +55,11 @@ namespace ramses::internal
         return std::nullopt;
     }
 
+    bool TimerNodeImpl::canUpdateConcurrently() const
+    {
+        return true;
+    }
+
     flatbuffers::Offset<rlogic_serialization::TimerNode> TimerNodeImpl::Serialize(
         const TimerNodeImpl& timerNode,
         flatbuffers::FlatBufferBuilder& builder,
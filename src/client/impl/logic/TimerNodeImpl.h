@@ -37,6 +37,7 @@ namespace ramses::internal
         TimerNodeImpl(SceneImpl& scene, std::string_view name, sceneObjectId_t id) noexcept;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool canUpdateConcurrently() const override;
 
         void createRootProperties() final;
 
@@ -40,11 +40,11 @@ namespace ramses::internal
         m_scenegraphProviderComponent = nullptr;
     }
 
-    void ClientApplicationLogic::createScene(ClientScene& scene, bool enableLocalOnlyOptimization)
+    void ClientApplicationLogic::createScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneSnapshotCaching)
     {
         PlatformGuard guard(m_frameworkLock);
         LOG_TRACE(CONTEXT_CLIENT, "ClientApplicationLogic::createScene:  '{}' with id '{}'", scene.getName(), scene.getSceneId().getValue());
-        m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization, *this);
+        m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization, enableSceneSnapshotCaching, *this);
     }
 
     void ClientApplicationLogic::publishScene(SceneId sceneId, EScenePublicationMode publicationMode)
@@ -121,6 +121,12 @@ namespace ramses::internal
         m_resourceComponent->loadResourceFromFile(handle);
     }
 
+    ManagedResourceVector ClientApplicationLogic::prefetchResourceFile(SceneFileHandle handle)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        return m_resourceComponent->prefetchResourceFile(handle);
+    }
+
     bool  ClientApplicationLogic::hasResourceFile(SceneFileHandle handle) const
     {
         PlatformGuard guard(m_frameworkLock);
@@ -41,7 +41,7 @@ namespace ramses::internal
         void deinit();
 
         // Scene handling
-        void createScene(ClientScene& scene, bool enableLocalOnlyOptimization);
+        void createScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneSnapshotCaching);
         void publishScene(SceneId sceneId, EScenePublicationMode publicationMode);
         void unpublishScene(SceneId sceneId);
         [[nodiscard]] bool isScenePublished(SceneId sceneId) const;
@@ -60,6 +60,7 @@ namespace ramses::internal
         SceneFileHandle         addResourceFile(InputStreamContainerSPtr resourceFileInputStream, const ResourceTableOfContents& toc);
         void                    removeResourceFile(SceneFileHandle handle);
         void                    loadResourceFromFile(SceneFileHandle handle);
+        ManagedResourceVector   prefetchResourceFile(SceneFileHandle handle);
         void                    reserveResourceCount(uint32_t totalCount);
         [[nodiscard]] bool                    hasResourceFile(SceneFileHandle handle) const;
 
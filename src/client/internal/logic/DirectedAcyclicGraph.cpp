@@ -185,6 +185,12 @@ namespace ramses::internal
         }
     }
 
+    const NodeVector& DirectedAcyclicGraph::getSourceNodes(Node& node) const
+    {
+        assert(m_nodeIncomingEdges.count(&node) != 0);
+        return m_nodeIncomingEdges.find(&node)->second;
+    }
+
     size_t DirectedAcyclicGraph::getInDegree(Node& node) const
     {
         assert(m_nodeOutgoingEdges.count(&node) != 0);
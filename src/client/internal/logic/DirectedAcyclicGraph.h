@@ -46,6 +46,8 @@ namespace ramses::internal
         void removeEdge(Node& source, Node& target);
 
         [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        // Nodes which have at least one edge to given node
+        [[nodiscard]] const NodeVector& getSourceNodes(Node& node) const;
 
         // For testing only
         [[nodiscard]] size_t getInDegree(Node& node) const;
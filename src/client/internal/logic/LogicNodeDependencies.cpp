@@ -18,6 +18,8 @@
 #include "internal/logic/TypeUtils.h"
 
 #include <cassert>
+#include <algorithm>
+#include <unordered_map>
 #include "fmt/format.h"
 
 namespace ramses::internal
@@ -43,6 +45,10 @@ namespace ramses::internal
             NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
             cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
         }
+
+        // same applies to levels, removing a node can only remove dependencies
+        for (auto& level : m_cachedNodeLevels)
+            level.erase(std::remove(level.begin(), level.end(), &node), level.end());
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -93,11 +99,95 @@ namespace ramses::internal
         {
             m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
             m_nodeTopologyChanged = false;
+            m_nodeLevelsChanged = true;
         }
 
         return m_cachedTopologicallySortedNodes;
     }
 
+    const std::vector<NodeVector>& LogicNodeDependencies::getNodeLevels()
+    {
+        const std::optional<NodeVector>& sortedNodes = getTopologicallySortedNodes();
+        assert(sortedNodes);
+
+        if (m_nodeLevelsChanged)
+        {
+            m_cachedNodeLevels.clear();
+
+            std::unordered_map<const LogicNodeImpl*, size_t> nodeSortIndex;
+            std::unordered_map<const LogicNodeImpl*, size_t> nodeLevel;
+            // lowest level allowed for weak link sources sorted after their target
+            std::unordered_map<const LogicNodeImpl*, size_t> nodeMinLevel;
+            nodeSortIndex.reserve(sortedNodes->size());
+            nodeLevel.reserve(sortedNodes->size());
+            for (size_t i = 0u; i < sortedNodes->size(); ++i)
+                nodeSortIndex.insert({ (*sortedNodes)[i], i });
+
+            NodeVector weakLinkSources;
+            for (size_t i = 0u; i < sortedNodes->size(); ++i)
+            {
+                LogicNodeImpl* node = (*sortedNodes)[i];
+
+                // sources are always sorted before node, so their level is known already
+                size_t level = 0u;
+                const auto minLevelIt = nodeMinLevel.find(node);
+                if (minLevelIt != nodeMinLevel.cend())
+                    level = minLevelIt->second;
+                for (const LogicNodeImpl* srcNode : m_logicNodeDAG.getSourceNodes(*node))
+                    level = std::max(level, nodeLevel[srcNode] + 1u);
+
+                // weak links are not part of the DAG, serial update however updates nodes in sorted order:
+                // - source sorted before node provides its value still in same update, node must stay in a later level
+                // - source sorted after node writes its value only after node was updated (node reads it in next update),
+                //   source must then stay in a later level so that it never writes to inputs of node while node is updated
+                weakLinkSources.clear();
+                if (const Property* inputs = node->getInputs())
+                    CollectWeakLinkSources(inputs->impl(), weakLinkSources);
+                for (const LogicNodeImpl* srcNode : weakLinkSources)
+                {
+                    if (nodeSortIndex[srcNode] < i)
+                        level = std::max(level, nodeLevel[srcNode] + 1u);
+                }
+                for (const LogicNodeImpl* srcNode : weakLinkSources)
+                {
+                    if (nodeSortIndex[srcNode] > i)
+                    {
+                        auto& srcMinLevel = nodeMinLevel[srcNode];
+                        srcMinLevel = std::max(srcMinLevel, level + 1u);
+                    }
+                }
+
+                nodeLevel[node] = level;
+                if (level >= m_cachedNodeLevels.size())
+                    m_cachedNodeLevels.resize(level + 1u);
+                m_cachedNodeLevels[level].push_back(node);
+            }
+
+            m_nodeLevelsChanged = false;
+        }
+
+        return m_cachedNodeLevels;
+    }
+
+    void LogicNodeDependencies::CollectWeakLinkSources(const PropertyImpl& input, NodeVector& sources)
+    {
+        const auto inputCount = input.getChildCount();
+        for (size_t i = 0; i < inputCount; ++i)
+        {
+            const auto& child = input.getChild(i)->impl();
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                CollectWeakLinkSources(child, sources);
+            }
+            else
+            {
+                const auto& incomingLink = child.getIncomingLink();
+                if (incomingLink.property != nullptr && incomingLink.isWeakLink)
+                    sources.push_back(&incomingLink.property->getLogicNode());
+            }
+        }
+    }
+
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting)
     {
         if (!m_logicNodeDAG.containsNode(output.getLogicNode()))
@@ -165,6 +255,10 @@ namespace ramses::internal
                 m_nodeTopologyChanged = true;
             }
         }
+        else
+        {
+            m_nodeLevelsChanged = true;
+        }
 
         // TODO Violin don't set anything dirty here, handle dirtiness purely in update()
         input.getLogicNode().setDirty(true);
@@ -200,6 +294,10 @@ namespace ramses::internal
             auto& targetNode = input.getLogicNode();
             m_logicNodeDAG.removeEdge(node, targetNode);
         }
+        else
+        {
+            m_nodeLevelsChanged = true;
+        }
 
         input.resetIncomingLink();
 
@@ -28,6 +28,10 @@ namespace ramses::internal
     public:
         // The primary purpose of this class
         [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
+        // Sorted nodes partitioned into levels, nodes in a level depend only on nodes from previous levels,
+        // so nodes within a level can be updated in any order with the same result as in sorted order.
+        // Order of nodes within a level matches the topological sort. Must only be called if topological sort succeeded.
+        [[nodiscard]] const std::vector<NodeVector>& getNodeLevels();
 
         // Nodes management
         void addNode(LogicNodeImpl& node);
@@ -46,9 +50,13 @@ namespace ramses::internal
         DirectedAcyclicGraph m_logicNodeDAG;
 
         [[nodiscard]] bool isLinked(const PropertyImpl& input) const;
+        static void CollectWeakLinkSources(const PropertyImpl& input, NodeVector& sources);
 
         // Initial state: no nodes and no need to re-compute node topology
         std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
         bool m_nodeTopologyChanged = false;
+
+        std::vector<NodeVector> m_cachedNodeLevels;
+        bool m_nodeLevelsChanged = false;
     };
 }
@@ -0,0 +1,25 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/LogicNodeUpdateThreadPool.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    LogicNodeUpdateThreadPool::LogicNodeUpdateThreadPool(uint32_t workerCount)
+        : WorkerThreadPool(workerCount)
+    {
+        assert(workerCount > 0u);
+    }
+
+    void LogicNodeUpdateThreadPool::execute(const NodeVector& nodes, const NodeUpdateFunc& updateFunc)
+    {
+        WorkerThreadPool::execute(nodes.size(), updateFunc);
+    }
+}
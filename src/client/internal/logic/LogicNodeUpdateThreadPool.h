@@ -0,0 +1,29 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/logic/DirectedAcyclicGraph.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
+
+#include <functional>
+
+namespace ramses::internal
+{
+    // Updates logic nodes of one dependency level concurrently on a set of worker threads.
+    // Calling thread helps updating the nodes and returns only once all given nodes are updated.
+    class LogicNodeUpdateThreadPool : public WorkerThreadPool
+    {
+    public:
+        using NodeUpdateFunc = std::function<void(size_t nodeIdx)>;
+
+        explicit LogicNodeUpdateThreadPool(uint32_t workerCount);
+
+        void execute(const NodeVector& nodes, const NodeUpdateFunc& updateFunc);
+    };
+}
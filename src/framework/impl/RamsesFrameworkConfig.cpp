@@ -153,6 +153,21 @@ namespace ramses
         return true;
     }
 
+    void RamsesFrameworkConfig::setConnectionSendCoalescingSize(uint32_t maxBytes)
+    {
+        m_impl->m_tcpConfig.setSendCoalescingSize(maxBytes);
+    }
+
+    void RamsesFrameworkConfig::setLocalConnectionDirectory(std::string_view directory)
+    {
+        m_impl->m_tcpConfig.setLocalSocketDirectory(directory);
+    }
+
+    bool RamsesFrameworkConfig::setResourceProcessingThreadCount(uint32_t threadCount)
+    {
+        return m_impl->setResourceProcessingThreadCount(threadCount);
+    }
+
     internal::RamsesFrameworkConfigImpl& RamsesFrameworkConfig::impl()
     {
         return *m_impl;
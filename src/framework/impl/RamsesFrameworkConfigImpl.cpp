@@ -13,6 +13,7 @@
 #include "internal/Communication/TransportCommon/EConnectionProtocol.h"
 #include "internal/Communication/TransportCommon/RamsesTransportProtocolVersion.h"
 #include "impl/EFeatureLevelImpl.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
 #include <map>
 
 namespace ramses::internal
@@ -200,10 +201,30 @@ namespace ramses::internal
         case EConnectionSystem::Off:
             m_usedProtocol = EConnectionProtocol::Off;
             break;
+        case EConnectionSystem::Local:
+            m_usedProtocol = EConnectionProtocol::Local;
+            break;
+        }
+        return true;
+    }
+
+    bool RamsesFrameworkConfigImpl::setResourceProcessingThreadCount(uint32_t threadCount)
+    {
+        if (threadCount > MaxResourceProcessingThreadCount)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "RamsesFrameworkConfig::setResourceProcessingThreadCount: thread count {} exceeds maximum of {}", threadCount, MaxResourceProcessingThreadCount);
+            return false;
         }
+
+        m_resourceProcessingThreadCount = threadCount;
         return true;
     }
 
+    uint32_t RamsesFrameworkConfigImpl::getResourceProcessingThreadCount() const
+    {
+        return m_resourceProcessingThreadCount.value_or(ResourceCompressionThreadPool::GetDefaultWorkerCount());
+    }
+
     Guid RamsesFrameworkConfigImpl::getUserProvidedGuid() const
     {
         return m_userProvidedGuid;
@@ -16,6 +16,7 @@
 #include "internal/Communication/TransportCommon/EConnectionProtocol.h"
 #include "internal/PlatformAbstraction/Collections/Guid.h"
 
+#include <optional>
 #include <string>
 
 namespace ramses::internal
@@ -65,6 +66,10 @@ namespace ramses::internal
 
         [[nodiscard]] bool setConnectionSystem(EConnectionSystem connectionSystem);
 
+        static constexpr uint32_t MaxResourceProcessingThreadCount = 64u;
+        [[nodiscard]] bool setResourceProcessingThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint32_t getResourceProcessingThreadCount() const;
+
         TCPConfig        m_tcpConfig;
         ERamsesShellType m_shellType;
         ThreadWatchdogConfig m_watchdogConfig;
@@ -82,5 +87,6 @@ namespace ramses::internal
         bool m_enableDltApplicationRegistration = true;
         Guid m_userProvidedGuid;
         std::string m_loggingInstanceName = "R";
+        std::optional<uint32_t> m_resourceProcessingThreadCount;
     };
 }
@@ -37,12 +37,13 @@ namespace ramses::internal
         , m_threadWatchdogConfig(config.m_watchdogConfig)
         // NOTE: ThreadedTaskExecutor must always be constructed after CommunicationSystem
         , m_threadedTaskExecutor(3, config.m_watchdogConfig)
-        , m_resourceComponent(m_statisticCollection, m_frameworkLock)
+        , m_resourceComponent(m_statisticCollection, m_frameworkLock, config.getResourceProcessingThreadCount())
         , m_scenegraphComponent(
             m_participantAddress.getParticipantId(),
             *m_communicationSystem,
             m_communicationSystem->getRamsesConnectionStatusUpdateNotifier(),
             m_resourceComponent,
+            m_resourceComponent.getResourceCompressionThreadPool(),
             m_frameworkLock,
             config.getFeatureLevel())
         , m_ramshCommandLogConnectionInformation(std::make_shared<LogConnectionInfo>(*m_communicationSystem))
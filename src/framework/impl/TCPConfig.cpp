@@ -20,6 +20,7 @@ namespace ramses::internal
         , m_daemonIP("127.0.0.1")
         , m_aliveInterval(300)
         , m_aliveTimeout(m_aliveInterval * 6)
+        , m_sendCoalescingSize(256u * 1024u)
     {
     }
 
@@ -84,4 +85,24 @@ namespace ramses::internal
     {
         m_aliveTimeout = timeout;
     }
+
+    uint32_t TCPConfig::getSendCoalescingSize() const
+    {
+        return m_sendCoalescingSize;
+    }
+
+    void TCPConfig::setSendCoalescingSize(uint32_t maxBytes)
+    {
+        m_sendCoalescingSize = maxBytes;
+    }
+
+    const std::string& TCPConfig::getLocalSocketDirectory() const
+    {
+        return m_localSocketDirectory;
+    }
+
+    void TCPConfig::setLocalSocketDirectory(std::string_view directory)
+    {
+        m_localSocketDirectory = directory;
+    }
 }
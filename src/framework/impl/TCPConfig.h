@@ -35,6 +35,12 @@ namespace ramses::internal
         void setAliveInterval(std::chrono::milliseconds interval);
         void setAliveTimeout(std::chrono::milliseconds timeout);
 
+        [[nodiscard]] uint32_t getSendCoalescingSize() const;
+        void setSendCoalescingSize(uint32_t maxBytes);
+
+        [[nodiscard]] const std::string& getLocalSocketDirectory() const;
+        void setLocalSocketDirectory(std::string_view directory);
+
     private:
         static const uint16_t DefaultPort;
         static const uint16_t DefaultDaemonPort;
@@ -46,5 +52,7 @@ namespace ramses::internal
         std::string m_daemonIP;
         std::chrono::milliseconds m_aliveInterval;
         std::chrono::milliseconds m_aliveTimeout;
+        uint32_t m_sendCoalescingSize;
+        std::string m_localSocketDirectory;
     };
 }
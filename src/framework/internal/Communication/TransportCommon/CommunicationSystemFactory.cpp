@@ -35,21 +35,26 @@ namespace ramses::internal
         auto ConstructTCPConnectionManager(const RamsesFrameworkConfigImpl& config, const ParticipantIdentifier& participantIdentifier,
             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection)
         {
-            LOG_INFO(CONTEXT_COMMUNICATION, "Use TCPConnectionSystem");
+            const EConnectionProtocol protocol = config.getUsedProtocol();
+            LOG_INFO(CONTEXT_COMMUNICATION, "Use TCPConnectionSystem with protocol {}", protocol);
 
-            // own address
+            // own address, local sockets are addressed by path of socket file instead of ip
             const bool isDaemon = false;
-            const NetworkParticipantAddress participantNetworkAddress(participantIdentifier.getParticipantId(), participantIdentifier.getParticipantName(), config.m_tcpConfig.getIPAddress(), config.m_tcpConfig.getPort(isDaemon));
+            const uint16_t port = config.m_tcpConfig.getPort(isDaemon);
+            const std::string ip = (protocol == EConnectionProtocol::Local) ? TCPConnectionSystem::GetLocalSocketPath(config.m_tcpConfig.getLocalSocketDirectory(), participantIdentifier.getParticipantId(), port) : config.m_tcpConfig.getIPAddress();
+            const NetworkParticipantAddress participantNetworkAddress(participantIdentifier.getParticipantId(), participantIdentifier.getParticipantName(), ip, port);
 
             LOG_DEBUG(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: My Address: {}:{}", participantNetworkAddress.getIp(), participantNetworkAddress.getPort());
 
             // daemon address
-            const NetworkParticipantAddress daemonNetworkAddress = NetworkParticipantAddress(TCPConnectionSystem::GetDaemonId(), "SM", config.m_tcpConfig.getDaemonIPAddress(), config.m_tcpConfig.getDaemonPort());
+            const uint16_t daemonPort = config.m_tcpConfig.getDaemonPort();
+            const std::string daemonIp = (protocol == EConnectionProtocol::Local) ? TCPConnectionSystem::GetLocalSocketPath(config.m_tcpConfig.getLocalSocketDirectory(), TCPConnectionSystem::GetDaemonId(), daemonPort) : config.m_tcpConfig.getDaemonIPAddress();
+            const NetworkParticipantAddress daemonNetworkAddress = NetworkParticipantAddress(TCPConnectionSystem::GetDaemonId(), "SM", daemonIp, daemonPort);
 
             LOG_DEBUG(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: Daemon Address: {}:{}", daemonNetworkAddress.getIp(), daemonNetworkAddress.getPort());
 
             // allocate
-            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
+            return std::make_unique<TCPConnectionSystem>(participantNetworkAddress, config.getProtocolVersion(), daemonNetworkAddress, false, frameworkLock, statisticCollection, config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout(), config.m_tcpConfig.getSendCoalescingSize(), protocol);
         }
 #endif
     }
@@ -63,6 +68,7 @@ namespace ramses::internal
         switch(config.getUsedProtocol())
         {
             case EConnectionProtocol::TCP:
+            case EConnectionProtocol::Local:
             {
 #if defined(HAS_TCP_COMM)
                 constructedDaemon = std::make_unique<TcpDiscoveryDaemon>(config, frameworkLock, statisticCollection, optionalRamsh);
@@ -89,6 +95,7 @@ namespace ramses::internal
         {
 #if defined(HAS_TCP_COMM)
         case EConnectionProtocol::TCP:
+        case EConnectionProtocol::Local:
         {
             return ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection);
         }
@@ -16,6 +16,7 @@ namespace ramses::internal
     {
         TCP,
         Off,
+        Local,
         Invalid, // must be last
     };
 
@@ -23,6 +24,7 @@ namespace ramses::internal
     {
         "TCP",
         "Off",
+        "Local",
         "Invalid"
     };
 }
@@ -42,7 +42,8 @@ namespace ramses::internal
         virtual bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) = 0;
 
         virtual bool sendInitializeScene(const Guid& to, const SceneId& sceneId) = 0;
-        virtual bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
+        // scene update is serialized once and same packets are sent to all given participants
+        virtual bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
 
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) = 0;
 
@@ -251,7 +251,7 @@ namespace ramses::internal
             return {};
         }
 
-        std::unique_ptr<IResource> Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data)
+        std::unique_ptr<IResource> Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data, ResourceBlob decompressedData)
         {
             BinaryInputStream is(description.data());
             ResourceContentHash hash;
@@ -274,7 +274,11 @@ namespace ramses::internal
                 // We just set offline for now to avoid any potential recompressing, but there shouldn't be
                 // any compressing on renderer side anyway.To implement correctly, we need to break network/file
                 // compatibility by serializing the IResource::CompressionLevel instead of EResourceCompressionStatus
-                if (header.compressionStatus == EResourceCompressionStatus::Compressed)
+                if (header.compressionStatus == EResourceCompressionStatus::Compressed && decompressedData.size() > 0u && decompressedData.size() == header.decompressedSize)
+                {
+                    header.resource->setResourceData(std::move(decompressedData), hash);
+                }
+                else if (header.compressionStatus == EResourceCompressionStatus::Compressed)
                 {
                     header.resource->setCompressedResourceData(CompressedResourceBlob(data.size(), data.data()), IResource::CompressionLevel::Offline, header.decompressedSize, hash);
                 }
@@ -285,5 +289,15 @@ namespace ramses::internal
             }
             return std::move(header.resource);
         }
+
+        bool GetDecompressedSize(absl::Span<const std::byte> description, uint32_t& decompressedSize)
+        {
+            BinaryInputStream is(description.data());
+            ResourceContentHash hash;
+            is >> hash;
+            const ResourceSerializationHelper::DeserializedResourceHeader header = ResourceSerializationHelper::ResourceFromMetadataStream(is);
+            decompressedSize = header.decompressedSize;
+            return header.compressionStatus == EResourceCompressionStatus::Compressed;
+        }
     }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "internal/SceneGraph/Resource/ResourceTypes.h"
 #include "absl/types/span.h"
 
 #include <cstdint>
@@ -33,7 +34,10 @@ namespace ramses::internal
         absl::Span<const std::byte> SerializeDescription(const IResource& resource, std::vector<std::byte>& workingMemory);
         absl::Span<const std::byte> SerializeData(const IResource& resource);
 
-        std::unique_ptr<IResource> Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data);
+        // decompressedData can hold compressed data already decompressed while it arrived, resource then only keeps decompressed data
+        std::unique_ptr<IResource> Deserialize(absl::Span<const std::byte> description, absl::Span<const std::byte> data, ResourceBlob decompressedData = ResourceBlob());
+        // returns false if data of described resource is not compressed
+        bool GetDecompressedSize(absl::Span<const std::byte> description, uint32_t& decompressedSize);
     }
 
     namespace FlushInformationSerialization
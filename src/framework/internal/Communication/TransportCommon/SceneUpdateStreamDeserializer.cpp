@@ -59,20 +59,36 @@ namespace ramses::internal
         // read all bytes from packet
         while (is.getCurrentReadBytes() < data.size())
         {
-            if (m_currentBlockSize != 0)
-            {
-                continueReadingBlock(is, data.size());
-            }
-            else
+            if (m_currentBlockSize == 0)
             {
                 if (!startReadingNewBlock(is, data.size()))
                     return fail();
+
+                // block fully contained in packet is deserialized in place
+                const size_t remainingDataInPacket = data.size() - is.getCurrentReadBytes();
+                if (m_currentBlockSize <= remainingDataInPacket)
+                {
+                    const absl::Span<const std::byte> block(is.readPosition(), m_currentBlockSize);
+                    is.skip(static_cast<int64_t>(m_currentBlockSize));
+                    if (!finalizeBlock(block))
+                        return fail();
+                    continue;
+                }
+
+                if (m_currentBlock.capacity() < m_currentBlockSize)
+                {
+                    ++m_blockBufferAllocations;
+                    m_currentBlock.reserve(m_currentBlockSize);
+                }
             }
 
+            continueReadingBlock(is, data.size());
+            decompressReceivedResourceData();
+
             // check if read full block
             if (m_currentBlock.size() == m_currentBlockSize)
             {
-                if (!finalizeBlock())
+                if (!finalizeBlock(m_currentBlock))
                     return fail();
             }
         }
@@ -125,23 +141,28 @@ namespace ramses::internal
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::finalizeBlock()
+    uint32_t SceneUpdateStreamDeserializer::getNumberOfBlockBufferAllocations() const
+    {
+        return m_blockBufferAllocations;
+    }
+
+    bool SceneUpdateStreamDeserializer::finalizeBlock(absl::Span<const std::byte> block)
     {
         auto blockType = static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType);
 
         if (blockType == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
         {
-            if (!handleSceneActionCollection())
+            if (!handleSceneActionCollection(block))
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::Resource)
         {
-            if (!handleResource())
+            if (!handleResource(block))
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::FlushInfos)
         {
-            if (!handleFlushInfos())
+            if (!handleFlushInfos(block))
                 return false;
         }
         else
@@ -150,8 +171,13 @@ namespace ramses::internal
             LOG_WARN(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::finalizeBlock: Ignore unexpected block type {}", m_blockType);
         }
 
+        // keep memory of block buffer for next block spanning packets unless it grew very large (e.g. by big resource)
+        if (m_currentBlock.capacity() > MaxKeptBlockBufferSize)
+            m_currentBlock = {};
         m_currentBlock.clear();
         m_currentBlockSize = 0;
+        m_resourceDecompressor.reset();
+        m_resourceDecompressionFailed = false;
         return true;
     }
 
@@ -161,11 +187,11 @@ namespace ramses::internal
         return Result{ResultType::Failed, SceneActionCollection(), {}, {}};
     }
 
-    bool SceneUpdateStreamDeserializer::handleSceneActionCollection()
+    bool SceneUpdateStreamDeserializer::handleSceneActionCollection(absl::Span<const std::byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (block.size() < sizeof(uint32_t)*2)
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", block.size());
             return false;
         }
         if (m_currentResult.actions.numberOfActions() != 0)
@@ -174,7 +200,7 @@ namespace ramses::internal
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t descSize = 0;
         uint32_t dataSize = 0;
         is >> descSize
@@ -185,35 +211,82 @@ namespace ramses::internal
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::handleResource()
+    bool SceneUpdateStreamDeserializer::handleResource(absl::Span<const std::byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (block.size() < sizeof(uint32_t)*2)
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", block.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t descSize = 0;
         uint32_t dataSize = 0;
         is >> descSize
            >> dataSize;
 
+        ResourceBlob decompressedData;
+        if (m_resourceDecompressor && m_resourceDecompressor->isFinished())
+            decompressedData = m_resourceDecompressor->release();
         m_currentResult.resources.push_back(ResourceSerialization::Deserialize(absl::Span<const std::byte>(is.readPosition(), descSize),
-                                                                               absl::Span<const std::byte>(is.readPosition() + descSize, dataSize)));
+                                                                               absl::Span<const std::byte>(is.readPosition() + descSize, dataSize),
+                                                                               std::move(decompressedData)));
         return true;
 
     }
 
-    bool SceneUpdateStreamDeserializer::handleFlushInfos()
+    void SceneUpdateStreamDeserializer::decompressReceivedResourceData()
+    {
+        if (m_resourceDecompressionFailed || static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType) != SingleSceneUpdateWriter::BlockType::Resource)
+            return;
+
+        constexpr size_t headerSize = sizeof(uint32_t) * 2;
+        if (m_currentBlock.size() < headerSize)
+            return;
+        BinaryInputStream is(m_currentBlock.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        is >> descSize
+           >> dataSize;
+
+        // sizes are checked when block is complete, do not decompress anything if they are inconsistent
+        const size_t dataOffset = headerSize + descSize;
+        if (dataOffset + dataSize != m_currentBlockSize)
+        {
+            m_resourceDecompressionFailed = true;
+            return;
+        }
+        if (m_currentBlock.size() <= dataOffset)
+            return;
+
+        if (!m_resourceDecompressor)
+        {
+            uint32_t decompressedSize = 0;
+            if (!ResourceSerialization::GetDecompressedSize(absl::Span<const std::byte>(is.readPosition(), descSize), decompressedSize))
+            {
+                m_resourceDecompressionFailed = true;
+                return;
+            }
+            m_resourceDecompressor.emplace(decompressedSize);
+        }
+
+        // data not in block format (or corrupted) is left to be decompressed as a whole when needed
+        if (!m_resourceDecompressor->update(absl::Span<const std::byte>(m_currentBlock.data() + dataOffset, m_currentBlock.size() - dataOffset)))
+        {
+            m_resourceDecompressor.reset();
+            m_resourceDecompressionFailed = true;
+        }
+    }
+
+    bool SceneUpdateStreamDeserializer::handleFlushInfos(absl::Span<const std::byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t))
+        if (block.size() < sizeof(uint32_t))
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleFlushInfos: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleFlushInfos: Block to small ({})", block.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t dataSize = 0;
         is >> dataSize;
 
@@ -10,13 +10,18 @@
 
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
 #include "internal/Components/FlushInformation.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
 #include "absl/types/span.h"
+#include <optional>
 
 namespace ramses::internal
 {
     class IResource;
     class BinaryInputStream;
 
+    // Blocks contained completely in a packet are deserialized directly from packet data. Only blocks spanning
+    // multiple packets are collected in block buffer, which keeps its memory for following blocks up to MaxKeptBlockBufferSize.
+    // Resource data compressed in LZ4 block format spanning multiple packets is decompressed block by block as packets arrive.
     class SceneUpdateStreamDeserializer
     {
     public:
@@ -44,21 +49,30 @@ namespace ramses::internal
 
         Result processData(absl::Span<const std::byte> data);
 
+        // number of times block buffer had to allocate memory for a block spanning multiple packets
+        [[nodiscard]] uint32_t getNumberOfBlockBufferAllocations() const;
+
+        static constexpr size_t MaxKeptBlockBufferSize = 4u * 1024u * 1024u;
+
     private:
         void continueReadingBlock(BinaryInputStream& is, size_t dataSize);
         bool startReadingNewBlock(BinaryInputStream& is, size_t dataSize);
         Result fail();
 
-        bool finalizeBlock();
-        bool handleSceneActionCollection();
-        bool handleResource();
-        bool handleFlushInfos();
+        bool finalizeBlock(absl::Span<const std::byte> block);
+        bool handleSceneActionCollection(absl::Span<const std::byte> block);
+        bool handleResource(absl::Span<const std::byte> block);
+        bool handleFlushInfos(absl::Span<const std::byte> block);
+        void decompressReceivedResourceData();
 
         uint32_t m_nextExpectedPacketNum = 1;
         bool m_hasFailed = false;
         uint32_t m_currentBlockSize = 0;
         uint32_t m_blockType = 0;
         std::vector<std::byte> m_currentBlock;
+        uint32_t m_blockBufferAllocations = 0;
+        std::optional<LZ4CompressionUtils::IncrementalDecompressor> m_resourceDecompressor;
+        bool m_resourceDecompressionFailed = false;
         Result m_currentResult;
     };
 }
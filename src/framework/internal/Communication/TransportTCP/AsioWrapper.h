@@ -57,6 +57,8 @@ WARNING_DISABLE_CLANG(-Wdeprecated-declarations)
 #include "asio/steady_timer.hpp"
 #include "asio/ip/address.hpp"
 #include "asio/ip/tcp.hpp"
+#include "asio/generic/stream_protocol.hpp"
+#include "asio/local/stream_protocol.hpp"
 #include "asio/connect.hpp"
 #include "asio/read.hpp"
 #include "asio/write.hpp"
@@ -0,0 +1,175 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportTCP/LocalSocketFile.h"
+#include "internal/PlatformAbstraction/PlatformEnvironmentVariables.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ramses::internal
+{
+    LocalSocketFile::LocalSocketFile(std::string path)
+        : m_path(std::move(path))
+    {
+    }
+
+    LocalSocketFile::~LocalSocketFile()
+    {
+        release();
+    }
+
+#ifdef _WIN32
+    bool LocalSocketFile::acquire()
+    {
+        LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::acquire: local sockets not supported on this platform, cannot use {}", m_path);
+        return false;
+    }
+
+    void LocalSocketFile::release()
+    {
+    }
+
+    std::string LocalSocketFile::GetDefaultDirectory()
+    {
+        return {};
+    }
+
+    bool LocalSocketFile::CreatePrivateDirectory(const std::string& /*directory*/)
+    {
+        return false;
+    }
+
+    bool LocalSocketFile::removeSocketFile() const
+    {
+        return false;
+    }
+#else
+    bool LocalSocketFile::acquire()
+    {
+        assert(m_lockFd < 0);
+
+        const auto separator = m_path.rfind('/');
+        const std::string directory = (separator == std::string::npos) ? std::string(".") : m_path.substr(0, std::max<size_t>(separator, 1u));
+        if (!CreatePrivateDirectory(directory))
+            return false;
+
+        const std::string lockPath = m_path + ".lock";
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-signed-bitwise) system call
+        m_lockFd = ::open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, S_IRUSR | S_IWUSR);
+        if (m_lockFd < 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::acquire: cannot open lock file {}. {}", lockPath, std::strerror(errno));
+            return false;
+        }
+
+        // lock is released by system when owner terminates, socket file without locked lock file is stale
+        // NOLINTNEXTLINE(hicpp-signed-bitwise) system flags
+        if (::flock(m_lockFd, LOCK_EX | LOCK_NB) != 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::acquire: {} is used by other participant", m_path);
+            ::close(m_lockFd);
+            m_lockFd = -1;
+            return false;
+        }
+
+        if (!removeSocketFile())
+        {
+            ::close(m_lockFd);
+            m_lockFd = -1;
+            return false;
+        }
+
+        return true;
+    }
+
+    void LocalSocketFile::release()
+    {
+        if (m_lockFd < 0)
+            return;
+
+        // socket file stays after acceptor is closed, remove it before giving up ownership
+        (void)removeSocketFile();
+        ::close(m_lockFd);
+        m_lockFd = -1;
+    }
+
+    std::string LocalSocketFile::GetDefaultDirectory()
+    {
+        std::string runtimeDirectory;
+        if (PlatformEnvironmentVariables::get("XDG_RUNTIME_DIR", runtimeDirectory) && !runtimeDirectory.empty())
+            return runtimeDirectory + "/ramses";
+        return "/tmp/ramses-" + std::to_string(::geteuid());
+    }
+
+    bool LocalSocketFile::CreatePrivateDirectory(const std::string& directory)
+    {
+        if (::mkdir(directory.c_str(), S_IRWXU) != 0 && errno != EEXIST)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::CreatePrivateDirectory: cannot create {}. {}", directory, std::strerror(errno));
+            return false;
+        }
+
+        // lstat to not follow symlink placed by someone else instead of directory
+        struct stat dirStat {};
+        if (::lstat(directory.c_str(), &dirStat) != 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::CreatePrivateDirectory: cannot access {}. {}", directory, std::strerror(errno));
+            return false;
+        }
+        if (!S_ISDIR(dirStat.st_mode) || dirStat.st_uid != ::geteuid())
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::CreatePrivateDirectory: {} is no directory owned by current user", directory);
+            return false;
+        }
+        // NOLINTNEXTLINE(hicpp-signed-bitwise) system flags
+        if ((dirStat.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::CreatePrivateDirectory: {} is writable by other users", directory);
+            return false;
+        }
+        return true;
+    }
+
+    bool LocalSocketFile::removeSocketFile() const
+    {
+        struct stat fileStat {};
+        if (::lstat(m_path.c_str(), &fileStat) != 0)
+        {
+            if (errno == ENOENT)
+                return true;
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::removeSocketFile: cannot access {}. {}", m_path, std::strerror(errno));
+            return false;
+        }
+
+        if (!S_ISSOCK(fileStat.st_mode) || fileStat.st_uid != ::geteuid())
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::removeSocketFile: not removing {}, it is no socket of current user", m_path);
+            return false;
+        }
+
+        if (::unlink(m_path.c_str()) != 0 && errno != ENOENT)
+        {
+            LOG_ERROR(CONTEXT_COMMUNICATION, "LocalSocketFile::removeSocketFile: cannot remove {}. {}", m_path, std::strerror(errno));
+            return false;
+        }
+        return true;
+    }
+#endif
+}
@@ -0,0 +1,47 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+namespace ramses::internal
+{
+    // Socket file a participant listens on with EConnectionProtocol::Local.
+    // The listening participant holds an exclusive lock on "<path>.lock" as long as it owns the path. A socket file
+    // whose lock file is not locked was left by a participant which terminated without cleanup and is removed,
+    // so participants starting concurrently with same path cannot remove the socket of each other.
+    // Lock files are never removed, removing them would allow two owners of same path.
+    class LocalSocketFile
+    {
+    public:
+        explicit LocalSocketFile(std::string path);
+        ~LocalSocketFile();
+
+        LocalSocketFile(const LocalSocketFile&) = delete;
+        LocalSocketFile& operator=(const LocalSocketFile&) = delete;
+
+        // takes ownership of path and removes stale socket file, fails if path is owned by other participant,
+        // directory is not private or existing file is no socket of current user
+        [[nodiscard]] bool acquire();
+        // removes socket file and gives up ownership
+        void release();
+
+        // directory used when none is configured: $XDG_RUNTIME_DIR/ramses, otherwise /tmp/ramses-<uid>
+        [[nodiscard]] static std::string GetDefaultDirectory();
+        // creates directory with mode 0700 if missing, fails if it is no directory, not owned by current user
+        // or writable by group or others
+        [[nodiscard]] static bool CreatePrivateDirectory(const std::string& directory);
+
+    private:
+        [[nodiscard]] bool removeSocketFile() const;
+
+        const std::string m_path;
+        int m_lockFd = -1;
+    };
+}
@@ -15,6 +15,9 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include <thread>
 #include <utility>
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
 
 namespace ramses::internal
@@ -22,6 +25,20 @@ namespace ramses::internal
     static const constexpr uint32_t ResourceDataSize = 300000;
     static const constexpr uint32_t SceneActionDataSize = 300000;
 
+    namespace
+    {
+        // generic endpoints only carry raw socket address, convert to protocol specific endpoint to access address details
+        template <typename Endpoint>
+        Endpoint ConvertEndpoint(const asio::generic::stream_protocol::endpoint& endpoint)
+        {
+            Endpoint result;
+            const size_t size = std::min(endpoint.size(), result.capacity());
+            std::memcpy(result.data(), endpoint.data(), size);
+            result.resize(size);
+            return result;
+        }
+    }
+
     TCPConnectionSystem::TCPConnectionSystem(NetworkParticipantAddress participantAddress,
                                                      uint32_t protocolVersion,
                                                      NetworkParticipantAddress  daemonAddress,
@@ -29,7 +46,9 @@ namespace ramses::internal
                                                      PlatformLock& frameworkLock,
                                                      StatisticCollectionFramework& statisticCollection,
                                                      std::chrono::milliseconds aliveInterval,
-                                                     std::chrono::milliseconds aliveTimeout)
+                                                     std::chrono::milliseconds aliveTimeout,
+                                                     uint32_t sendCoalescingSize,
+                                                     EConnectionProtocol protocol)
         : m_participantAddress(std::move(participantAddress))
         , m_protocolVersion(protocolVersion)
         , m_daemonAddress(std::move(daemonAddress))
@@ -43,6 +62,8 @@ namespace ramses::internal
                             : EParticipantType::Client)
         , m_aliveInterval(aliveInterval)
         , m_aliveIntervalTimeout(aliveTimeout)
+        , m_sendCoalescingSize(sendCoalescingSize)
+        , m_protocol(protocol)
         , m_frameworkLock(frameworkLock)
         , m_thread("TCP_ConnSys")
         , m_statisticCollection(statisticCollection)
@@ -64,6 +85,14 @@ namespace ramses::internal
         return guid;
     }
 
+    std::string TCPConnectionSystem::GetLocalSocketPath(const std::string& directory, const Guid& participantId, uint16_t port)
+    {
+        const std::string prefix = (directory.empty() ? LocalSocketFile::GetDefaultDirectory() : directory) + "/ramses-";
+        if (port != 0)
+            return prefix + "daemon-" + std::to_string(port) + ".sock";
+        return prefix + participantId.toString() + ".sock";
+    }
+
     bool TCPConnectionSystem::connectServices()
     {
         LOG_INFO_F(CONTEXT_COMMUNICATION, ([&](StringOutputStream& sos) {
@@ -71,7 +100,9 @@ namespace ramses::internal
                                                    << m_participantAddress.getParticipantId() << "/" << m_participantAddress.getParticipantName()
                                                    << " at " << m_participantAddress.getIp() << ":" << m_participantAddress.getPort()
                                                    << ", type " << EnumToString(m_participantType)
-                                                   << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms";
+                                                   << ", protocol " << m_protocol
+                                                   << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms"
+                                                   << ", sendCoalescingSize " << m_sendCoalescingSize;
                                                if (m_hasOtherDaemon)
                                                    sos << ", other daemon at " << m_daemonAddress.getIp() << ":" << m_daemonAddress.getPort();
                                            }));
@@ -161,8 +192,7 @@ namespace ramses::internal
             }
         }
 
-        m_runState->m_acceptor.close();
-        m_runState->m_acceptorSocket.close();
+        closeAcceptor();
         m_connectingParticipants.clear();
         m_establishedParticipants.clear();
     }
@@ -172,7 +202,32 @@ namespace ramses::internal
         assert(!m_runState->m_acceptor.is_open());
 
         asio::error_code e;
-        m_runState->m_acceptor.open(asio::ip::tcp::v4(), e);
+        asio::generic::stream_protocol::endpoint endpoint;
+        if (m_protocol == EConnectionProtocol::Local)
+        {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            // socket file of participant which did not shut down properly prevents bind, owner of path removes it
+            m_runState->m_localSocketFile = std::make_unique<LocalSocketFile>(m_participantAddress.getIp());
+            if (!m_runState->m_localSocketFile->acquire())
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openAcceptor: cannot use socket file {}", m_participantAddress.getParticipantName(), m_participantAddress.getIp());
+                m_runState->m_localSocketFile.reset();
+                return false;
+            }
+
+            endpoint = asio::local::stream_protocol::endpoint(m_participantAddress.getIp());
+#else
+            LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openAcceptor: local sockets not supported on this platform", m_participantAddress.getParticipantName());
+            return false;
+#endif
+        }
+        else
+        {
+            // always accept connections from all to also work on uncommon setups (could be changed to use m_participantAddress.getIp())
+            endpoint = asio::ip::tcp::endpoint(asio::ip::address::from_string("0.0.0.0"), m_participantAddress.getPort());
+        }
+
+        m_runState->m_acceptor.open(endpoint.protocol(), e);
         if (e)
         {
             LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openAcceptor: open failed. {}", m_participantAddress.getParticipantName(), e.message().c_str());
@@ -181,8 +236,7 @@ namespace ramses::internal
 
         m_runState->m_acceptor.set_option(asio::socket_base::reuse_address(true));
 
-        // always accept connections from all to also work on uncommon setups (could be changed to use m_participantAddress.getIp())
-        m_runState->m_acceptor.bind(asio::ip::tcp::endpoint(asio::ip::address::from_string("0.0.0.0"), m_participantAddress.getPort()), e);
+        m_runState->m_acceptor.bind(endpoint, e);
         if (e)
         {
             LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openAcceptor: bind failed. {}", m_participantAddress.getParticipantName(), e.message().c_str());
@@ -196,12 +250,66 @@ namespace ramses::internal
             return false;
         }
 
-        const auto endpoint = m_runState->m_acceptor.local_endpoint();
-        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openAcceptor: Listening for connections on {}:{}", m_participantAddress.getParticipantName(), endpoint.address().to_string().c_str(), endpoint.port());
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::openAcceptor: Listening for connections on {}", m_participantAddress.getParticipantName(), endpointToString(m_runState->m_acceptor.local_endpoint()));
 
         return true;
     }
 
+    void TCPConnectionSystem::closeAcceptor()
+    {
+        m_runState->m_acceptor.close();
+        m_runState->m_acceptorSocket.close();
+
+        // socket file stays after close and is removed by owner
+        m_runState->m_localSocketFile.reset();
+    }
+
+    std::optional<asio::generic::stream_protocol::endpoint> TCPConnectionSystem::getEndpoint(const NetworkParticipantAddress& address) const
+    {
+        if (m_protocol == EConnectionProtocol::Local)
+        {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            return asio::local::stream_protocol::endpoint(address.getIp());
+#else
+            return std::nullopt;
+#endif
+        }
+
+        // convert localhost to an actual ip, no need for dns resolving here
+        const char* const ipStr = (address.getIp() == "localhost" ? "127.0.0.1" : address.getIp().c_str());
+
+        // parse with error checking to prevent exception when ip is invalid format
+        asio::error_code err;
+        const auto asioIp = asio::ip::address::from_string(ipStr, err);
+        if (err)
+            return std::nullopt;
+        return asio::ip::tcp::endpoint(asioIp, address.getPort());
+    }
+
+    uint16_t TCPConnectionSystem::getAcceptorPort() const
+    {
+        // local socket is identified by its path, port is kept only to identify daemon
+        if (m_protocol == EConnectionProtocol::Local)
+            return m_participantAddress.getPort();
+        return ConvertEndpoint<asio::ip::tcp::endpoint>(m_runState->m_acceptor.local_endpoint()).port();
+    }
+
+    std::string TCPConnectionSystem::endpointToString(const asio::generic::stream_protocol::endpoint& endpoint) const
+    {
+        if (m_protocol == EConnectionProtocol::Local)
+        {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            // connecting side of local socket is unnamed
+            const auto path = ConvertEndpoint<asio::local::stream_protocol::endpoint>(endpoint).path();
+            return path.empty() ? std::string("<unnamed local socket>") : path;
+#else
+            return {};
+#endif
+        }
+        const auto tcpEndpoint = ConvertEndpoint<asio::ip::tcp::endpoint>(endpoint);
+        return tcpEndpoint.address().to_string() + ":" + std::to_string(tcpEndpoint.port());
+    }
+
     void TCPConnectionSystem::doAcceptIncomingConnections()
     {
         m_runState->m_acceptor.async_accept(m_runState->m_acceptorSocket,
@@ -214,15 +322,14 @@ namespace ramses::internal
                                     }
                                     else
                                     {
-                                        auto remoteEp = m_runState->m_acceptorSocket.remote_endpoint();
-                                        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doAcceptIncomingConnections: Accepted new connection from {}:{}",
-                                            m_participantAddress.getParticipantName(), remoteEp.address().to_string().c_str(), remoteEp.port());
+                                        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doAcceptIncomingConnections: Accepted new connection from {}",
+                                            m_participantAddress.getParticipantName(), endpointToString(m_runState->m_acceptorSocket.remote_endpoint()));
 
                                         // create new participant
                                         auto pp = std::make_shared<Participant>(NetworkParticipantAddress(), m_runState->m_io, EParticipantType::Client, EParticipantState::WaitingForHello);
                                         pp->socket = std::move(m_runState->m_acceptorSocket);
                                         m_connectingParticipants.put(pp);
-                                        m_runState->m_acceptorSocket = asio::ip::tcp::socket(m_runState->m_io);
+                                        m_runState->m_acceptorSocket = asio::generic::stream_protocol::socket(m_runState->m_io);
 
                                         initializeNewlyConnectedParticipant(pp);
 
@@ -236,21 +343,15 @@ namespace ramses::internal
     {
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Try connect to participant at {}:{}", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
 
-        // convert localhost to an actual ip, no need for dns resolving here
-        const char* const ipStr = (pp->address.getIp() == "localhost" ? "127.0.0.1" : pp->address.getIp().c_str());
-
-        // parse with error checking to prevent exception when ip is invalid format
-        asio::error_code err;
-        const auto asioIp = asio::ip::address::from_string(ipStr, err);
-        if (err)
+        const auto ep = getEndpoint(pp->address);
+        if (!ep)
         {
-            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Failed to parse ip address '{}:{}'", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Failed to parse address '{}:{}'", m_participantAddress.getParticipantName(), pp->address.getIp(), pp->address.getPort());
             return;
         }
 
-        asio::ip::tcp::endpoint ep(asioIp, pp->address.getPort());
-        std::array<asio::ip::tcp::endpoint, 1> endpointSequence = {ep};
-        asio::async_connect(pp->socket, endpointSequence, [this, pp](asio::error_code e, const asio::ip::tcp::endpoint& usedEndpoint) {
+        std::array<asio::generic::stream_protocol::endpoint, 1> endpointSequence = {*ep};
+        asio::async_connect(pp->socket, endpointSequence, [this, pp](asio::error_code e, const asio::generic::stream_protocol::endpoint& usedEndpoint) {
                 if (e)
                 {
                     // connect failed, try again after timeout
@@ -272,7 +373,7 @@ namespace ramses::internal
                 else
                 {
                     // connected
-                    LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Established to {}:{}", m_participantAddress.getParticipantName(), usedEndpoint.address().to_string().c_str(), usedEndpoint.port());
+                    LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doConnect: Established to {}", m_participantAddress.getParticipantName(), endpointToString(usedEndpoint));
                     initializeNewlyConnectedParticipant(pp);
                 }
             });
@@ -288,7 +389,8 @@ namespace ramses::internal
         pp->socket.set_option(asio::socket_base::send_buffer_size{static_cast<int>(ResourceDataSize)});
 
         // Disable nagle
-        pp->socket.set_option(asio::ip::tcp::no_delay{true});
+        if (m_protocol != EConnectionProtocol::Local)
+            pp->socket.set_option(asio::ip::tcp::no_delay{true});
         pp->state = EParticipantState::WaitingForHello;
         pp->lastReceived = std::chrono::steady_clock::now();
 
@@ -296,36 +398,66 @@ namespace ramses::internal
         sendConnectionDescriptionOnNewConnection(pp);
     }
 
-    void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
+    void TCPConnectionSystem::finalizeMessage(OutMessage& msg) const
     {
-        assert(pp->currentOutBuffer.empty());
-
-        pp->currentOutBuffer = msg.stream.release();
-        const auto fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
+        if (msg.data)
+            return;
 
-        LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgType {}, Size {}",
-            m_participantAddress.getParticipantName(), pp->address.getParticipantId(), msg.messageType, fullSize);
+        std::vector<std::byte> buffer = msg.stream.release();
+        const auto fullSize = static_cast<uint32_t>(buffer.size());
 
-        RawBinaryOutputStream s(pp->currentOutBuffer.data(), pp->currentOutBuffer.size());
-        const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
+        RawBinaryOutputStream s(buffer.data(), buffer.size());
+        const uint32_t remainingSize = fullSize - sizeof(Participant::lengthReceiveBuffer);
         s << remainingSize
           << m_protocolVersion;
 
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
-                          [this, pp](asio::error_code e, std::size_t sentBytes) {
+        msg.data = std::make_shared<const std::vector<std::byte>>(std::move(buffer));
+    }
+
+    void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
+    {
+        assert(pp->currentOutBuffers.empty());
+
+        finalizeMessage(msg);
+        LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgType {}, Size {}",
+            m_participantAddress.getParticipantName(), pp->address.getParticipantId(), msg.messageType, msg.data->size());
+
+        pp->currentOutBuffers.push_back(std::move(msg.data));
+        writeCurrentOutBuffers(pp);
+    }
+
+    void TCPConnectionSystem::writeCurrentOutBuffers(const ParticipantPtr& pp)
+    {
+        assert(!pp->currentOutBuffers.empty());
+
+        std::vector<asio::const_buffer> buffers;
+        buffers.reserve(pp->currentOutBuffers.size());
+        size_t numBytes = 0u;
+        for (const auto& data : pp->currentOutBuffers)
+        {
+            buffers.emplace_back(data->data(), data->size());
+            numBytes += data->size();
+        }
+
+        m_statisticCollection.statSocketWrites.incCounter(1);
+        m_statisticCollection.statSocketWriteMessages.incCounter(static_cast<uint32_t>(pp->currentOutBuffers.size()));
+        m_statisticCollection.statSocketWriteBytes.incCounter(numBytes);
+
+        asio::async_write(pp->socket, buffers,
+                          [this, pp, numBytes](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
-                                  LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: Send to {}/{} failed. {}. Remove participant",
+                                  LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::writeCurrentOutBuffers: Send to {}/{} failed. {}. Remove participant",
                                       m_participantAddress.getParticipantName(), pp->address.ParticipantIdentifier::getParticipantId(), pp->address.ParticipantIdentifier::getParticipantName(), e.message().c_str());
 
                                   removeParticipant(pp);
                               }
                               else
                               {
-                                  LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgBytes {}, SentBytes {}",
-                                      m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->currentOutBuffer.size(), sentBytes);
+                                  LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::writeCurrentOutBuffers: To {}, NumMsgs {}, MsgBytes {}, SentBytes {}",
+                                      m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->currentOutBuffers.size(), numBytes, sentBytes);
 
-                                  pp->currentOutBuffer.clear();
+                                  pp->currentOutBuffers.clear();
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -344,20 +476,87 @@ namespace ramses::internal
 
     void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() && !pp->outQueue.empty())
+        if (!pp->currentOutBuffers.empty())
+            return;
+
+        // gather queued messages into one write up to coalescing size, first message is always sent even when larger.
+        // Every message is taken from highest priority lane which has messages queued.
+        const auto now = std::chrono::steady_clock::now();
+        size_t numBytes = 0u;
+        for (;;)
         {
-            OutMessage msg = std::move(pp->outQueue.front());
-            pp->outQueue.pop_front();
+            const auto queueIt = std::find_if(pp->outQueues.begin(), pp->outQueues.end(), [](const auto& queue) { return !queue.empty(); });
+            if (queueIt == pp->outQueues.end())
+                break;
+
+            OutMessage& msg = queueIt->front();
+            finalizeMessage(msg);
+            if (!pp->currentOutBuffers.empty() && numBytes + msg.data->size() > m_sendCoalescingSize)
+                break;
+
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::doSendQueuedMessage: To {}, MsgType {}, Size {}, Lane {}",
+                m_participantAddress.getParticipantName(), pp->address.getParticipantId(), msg.messageType, msg.data->size(), EnumToString(msg.lane));
+
+            const auto lane = static_cast<size_t>(msg.lane);
+            const auto queuedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - msg.queuedTime).count());
+            m_statisticCollection.statSendLaneMessages[lane].incCounter(1);
+            m_statisticCollection.statSendLaneLatencySumUs[lane].incCounter(queuedUs);
+            m_statisticCollection.statSendLaneMaxLatencyUs[lane].setCounterValueIfCurrent<std::less<>>(queuedUs);
+
+            if (msg.lane != ESendLane::Control)
+            {
+                auto& messagesPerScene = pp->queuedMessagesPerScene[lane];
+                for (const auto& sceneId : msg.sceneIds)
+                {
+                    uint32_t& numMessages = messagesPerScene[sceneId];
+                    assert(numMessages > 0u);
+                    if (--numMessages == 0u)
+                        messagesPerScene.remove(sceneId);
+                }
+            }
 
-            sendMessageToParticipant(pp, std::move(msg));
+            numBytes += msg.data->size();
+            pp->currentOutBuffers.push_back(std::move(msg.data));
+            queueIt->pop_front();
         }
+
+        if (!pp->currentOutBuffers.empty())
+            writeCurrentOutBuffers(pp);
+    }
+
+    void TCPConnectionSystem::enqueueMessage(const ParticipantPtr& pp, OutMessage msg)
+    {
+        static_assert(NumSendLanes == ESendLaneStatisticIndex_NumIndices, "send lane statistics do not match send lanes");
+
+        // message must not overtake messages of same scene queued in a lower priority lane, e.g. next flush or
+        // re-initialization while large flush is still queued or unpublish and republish while scene is still sent
+        for (const auto& sceneId : msg.sceneIds)
+        {
+            for (const auto sceneLane : { ESendLane::Bulk, ESendLane::SceneUpdate })
+            {
+                if (sceneLane > msg.lane && pp->queuedMessagesPerScene[static_cast<size_t>(sceneLane)].contains(sceneId))
+                    msg.lane = sceneLane;
+            }
+        }
+
+        const auto lane = static_cast<size_t>(msg.lane);
+        if (msg.lane != ESendLane::Control)
+        {
+            for (const auto& sceneId : msg.sceneIds)
+                ++pp->queuedMessagesPerScene[lane][sceneId];
+        }
+
+        msg.queuedTime = std::chrono::steady_clock::now();
+        auto& queue = pp->outQueues[lane];
+        queue.push_back(std::move(msg));
+        m_statisticCollection.statSendLaneMaxQueueDepth[lane].setCounterValueIfCurrent<std::less<>>(static_cast<uint32_t>(queue.size()));
     }
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty())
+        if (pp->currentOutBuffers.empty())
         {
-            assert(pp->outQueue.empty());
+            assert(std::all_of(pp->outQueues.cbegin(), pp->outQueues.cend(), [](const auto& queue) { return queue.empty(); }));
 
             sendMessageToParticipant(pp, OutMessage(std::vector<Guid>(), EMessageId::Alive));
         }
@@ -505,6 +704,17 @@ namespace ramses::internal
         return "<Unknown>";
     }
 
+    const char* TCPConnectionSystem::EnumToString(ESendLane e)
+    {
+        switch (e)
+        {
+        case ESendLane::Control: return "Control";
+        case ESendLane::SceneUpdate: return "SceneUpdate";
+        case ESendLane::Bulk: return "Bulk";
+        };
+        return "<Unknown>";
+    }
+
     void TCPConnectionSystem::addNewParticipantByAddress(const NetworkParticipantAddress& address)
     {
         // TODO: need ptype!
@@ -544,6 +754,9 @@ namespace ramses::internal
         if (msg.to.empty())
             return true;
 
+        // finalize once here so all receivers of a message share the same buffer
+        finalizeMessage(msg);
+
         asio::post(m_runState->m_io, [this, msg = std::move(msg)]() mutable {
                             if (msg.to.size() > 1)
                             {
@@ -554,8 +767,8 @@ namespace ramses::internal
                                         continue; // skip invalid participant in broadcast. might happen due to disconnect race
                                     assert(pp);
 
-                                    // cannot move here when broadcast to more than 1 participant
-                                    pp->outQueue.push_back(msg);
+                                    // cannot move here when broadcast to more than 1 participant, copy only references finalized data
+                                    enqueueMessage(pp, msg);
 
                                     doSendQueuedMessage(pp);
                                 }
@@ -571,7 +784,7 @@ namespace ramses::internal
                                 }
                                 assert(pp);
 
-                                pp->outQueue.push_back(std::move(msg));
+                                enqueueMessage(pp, std::move(msg));
 
                                 doSendQueuedMessage(pp);
                             }
@@ -648,7 +861,7 @@ namespace ramses::internal
         msg.stream << m_participantAddress.getParticipantId()
                    << m_participantAddress.getParticipantName()
                    << m_participantAddress.getIp()
-                   << static_cast<uint16_t>(m_runState->m_acceptor.local_endpoint().port())
+                   << getAcceptorPort()
                    << m_participantType;
         sendMessageToParticipant(pp, std::move(msg));
     }
@@ -829,6 +1042,7 @@ namespace ramses::internal
     {
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSubscribeScene: to {}, sceneId {}", m_participantAddress.getParticipantName(), to, sceneId);
         OutMessage msg(to, EMessageId::SubscribeScene);
+        msg.sceneIds = { sceneId };
         msg.stream << sceneId.getValue();
         return postMessageForSending(std::move(msg));
     }
@@ -851,6 +1065,7 @@ namespace ramses::internal
     {
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendUnsubscribeScene: to {}, sceneId {}", m_participantAddress.getParticipantName(), to, sceneId);
         OutMessage msg(to, EMessageId::UnsubscribeScene);
+        msg.sceneIds = { sceneId };
         msg.stream << sceneId.getValue();
         return postMessageForSending(std::move(msg));
     }
@@ -873,6 +1088,8 @@ namespace ramses::internal
     {
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendInitializeScene: to {}, sceneId {}", m_participantAddress.getParticipantName(), to, sceneId);
         OutMessage msg(to, EMessageId::CreateScene);
+        msg.lane = ESendLane::SceneUpdate;
+        msg.sceneIds = { sceneId };
         msg.stream << sceneId.getValue();
         return postMessageForSending(std::move(msg));
     }
@@ -891,23 +1108,38 @@ namespace ramses::internal
     }
 
     // --
-    bool TCPConnectionSystem::sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+    bool TCPConnectionSystem::sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
     {
-        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSceneActionList: to {}", m_participantAddress.getParticipantName(), to);
+        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSceneActionList: to {} participants", m_participantAddress.getParticipantName(), to.size());
 
         static_assert(SceneActionDataSize < 1000000, "SceneActionDataSize too big");
 
+        // lane is known only when update needs more than one packet, so every packet is posted when next one is written
         std::vector<std::byte> buffer(SceneActionDataSize);
-        return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
+        std::optional<OutMessage> previousPacket;
+        const bool written = serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
 
             const auto usedSize = static_cast<uint32_t>(size);
             OutMessage msg(to, EMessageId::SendSceneUpdate);
+            msg.lane = previousPacket ? ESendLane::Bulk : ESendLane::SceneUpdate;
+            msg.sceneIds = { sceneId };
             msg.stream << sceneId.getValue()
                        << usedSize;
             msg.stream.write(buffer.data(), usedSize);
 
-            return postMessageForSending(std::move(msg));
+            if (previousPacket)
+            {
+                previousPacket->lane = ESendLane::Bulk;
+                if (!postMessageForSending(std::move(*previousPacket)))
+                    return false;
+            }
+            previousPacket.emplace(std::move(msg));
+            return true;
         });
+
+        if (!written)
+            return false;
+        return !previousPacket || postMessageForSending(std::move(*previousPacket));
     }
 
 
@@ -920,13 +1152,17 @@ namespace ramses::internal
             uint32_t dataSize = 0;
             stream >> dataSize;
 
-            std::vector<std::byte> data(dataSize);
-            stream.read(data.data(), dataSize);
+            if (dataSize > pp->receiveBuffer.size() - stream.getCurrentReadBytes())
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneUpdate: Invalid data size {} from {}", m_participantAddress.getParticipantName(), dataSize, pp->address.getParticipantId());
+                return;
+            }
 
             LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneActionList: from {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId());
 
+            // packet is handed over directly from receive buffer, it is reused for next message and thus must not be referenced after handler returns
             PlatformGuard guard(m_frameworkLock);
-            m_sceneRendererHandler->handleSceneUpdate(sceneId, data, pp->address.getParticipantId());
+            m_sceneRendererHandler->handleSceneUpdate(sceneId, absl::Span<const std::byte>(stream.readPosition(), dataSize), pp->address.getParticipantId());
         }
     }
 
@@ -944,6 +1180,7 @@ namespace ramses::internal
         msg.stream << static_cast<uint32_t>(newScenes.size());
         for (const auto& s : newScenes)
         {
+            msg.sceneIds.push_back(s.sceneID);
             msg.stream << s.sceneID.getValue()
                        << s.friendlyName;
         }
@@ -964,6 +1201,7 @@ namespace ramses::internal
         msg.stream << static_cast<uint32_t>(availableScenes.size());
         for (const auto& s : availableScenes)
         {
+            msg.sceneIds.push_back(s.sceneID);
             msg.stream << s.sceneID.getValue()
                        << s.friendlyName;
         }
@@ -1019,6 +1257,7 @@ namespace ramses::internal
         msg.stream << static_cast<uint32_t>(unavailableScenes.size());
         for (const auto& s : unavailableScenes)
         {
+            msg.sceneIds.push_back(s.sceneID);
             msg.stream << s.sceneID.getValue()
                        << s.friendlyName;
         }
@@ -1065,6 +1304,7 @@ namespace ramses::internal
             return false;
         }
         OutMessage msg(to, EMessageId::RendererEvent);
+        msg.sceneIds = { sceneId };
         msg.stream << sceneId.getValue()
                    << static_cast<uint32_t>(data.size());
         msg.stream.write(data.data(), static_cast<uint32_t>(data.size()));
@@ -1211,7 +1451,7 @@ namespace ramses::internal
         if (socket.is_open())
         {
             asio::error_code ec;
-            socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+            socket.shutdown(asio::socket_base::shutdown_both, ec);
             if (ec)
                 LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem::~Participant({}): shutdown failed: {}", address.getParticipantName(), ec.message().c_str());
 
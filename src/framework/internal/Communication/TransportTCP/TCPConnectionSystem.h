@@ -12,13 +12,20 @@
 #include "internal/Communication/TransportCommon/ConnectionStatusUpdateNotifier.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Communication/TransportTCP/NetworkParticipantAddress.h"
+#include "internal/Communication/TransportCommon/EConnectionProtocol.h"
 #include "internal/Communication/TransportTCP/EMessageId.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/Communication/TransportTCP/AsioWrapper.h"
+#include "internal/Communication/TransportTCP/LocalSocketFile.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include <array>
 #include <deque>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 
 namespace ramses::internal
@@ -26,15 +33,23 @@ namespace ramses::internal
     class StatisticCollectionFramework;
     class BinaryInputStream;
 
+    // Connects participants with TCP or, for EConnectionProtocol::Local, with Unix domain sockets on same host.
+    // Both use same framing, discovery and message handling, for Local the ip of a participant address is the path
+    // of the socket file it listens on and port is only used to identify daemon.
     class TCPConnectionSystem final : public Runnable, public ICommunicationSystem
     {
     public:
         TCPConnectionSystem(NetworkParticipantAddress  participantAddress, uint32_t protocolVersion, NetworkParticipantAddress  daemonAddress, bool pureDaemon,
                             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
-                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout, uint32_t sendCoalescingSize,
+                            EConnectionProtocol protocol = EConnectionProtocol::TCP);
         ~TCPConnectionSystem() override;
 
         static Guid GetDaemonId();
+        // path of socket file a participant listens on when using EConnectionProtocol::Local, participants with
+        // port (daemons) use path derived from port to be found by others, all others use path derived from their id.
+        // Empty directory selects LocalSocketFile::GetDefaultDirectory()
+        static std::string GetLocalSocketPath(const std::string& directory, const Guid& participantId, uint16_t port);
 
         bool connectServices() override;
         bool disconnectServices() override;
@@ -50,7 +65,7 @@ namespace ramses::internal
         bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) override;
 
         bool sendInitializeScene(const Guid& to, const SceneId& sceneId) override;
-        bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
+        bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
 
         bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) override;
 
@@ -78,6 +93,16 @@ namespace ramses::internal
             PureDaemon
         };
 
+        // messages queued for a participant are sent by priority of their lane, lanes are interleaved per message
+        // (scene updates are split into packets) so that control messages are not delayed by large scene transfers
+        enum class ESendLane
+        {
+            Control,        // connection handling, scene availability, subscriptions, renderer events
+            SceneUpdate,    // scene initialization and scene updates fitting into a single packet
+            Bulk,           // scene updates split into multiple packets (large flushes, resources)
+        };
+        static constexpr size_t NumSendLanes = 3u;
+
         struct OutMessage
         {
             OutMessage(const Guid& to_, EMessageId messageType_)
@@ -102,7 +127,13 @@ namespace ramses::internal
 
             std::vector<Guid> to;
             EMessageId messageType;
+            ESendLane lane = ESendLane::Control;
+            // scenes the message refers to, messages of same scene are kept in order across all lanes
+            std::vector<SceneId> sceneIds;
+            std::chrono::steady_clock::time_point queuedTime;
             BinaryOutputStream stream;
+            // set when message is finalized, shared between all receivers of the message
+            std::shared_ptr<const std::vector<std::byte>> data;
         };
 
         struct Participant
@@ -112,11 +143,14 @@ namespace ramses::internal
             ~Participant();
 
             NetworkParticipantAddress address;
-            asio::ip::tcp::socket socket;
+            asio::generic::stream_protocol::socket socket;
             asio::steady_timer connectTimer;
 
-            std::deque<OutMessage> outQueue;
-            std::vector<std::byte> currentOutBuffer;
+            std::array<std::deque<OutMessage>, NumSendLanes> outQueues;
+            // number of messages per scene currently queued in each lane (not counted for control lane)
+            std::array<HashMap<SceneId, uint32_t>, NumSendLanes> queuedMessagesPerScene;
+            // data of messages currently being written to socket with one gather write
+            std::vector<std::shared_ptr<const std::vector<std::byte>>> currentOutBuffers;
 
             uint32_t lengthReceiveBuffer;
             std::vector<std::byte> receiveBuffer;
@@ -135,9 +169,10 @@ namespace ramses::internal
         {
             RunState();
 
-            asio::io_service        m_io;
-            asio::ip::tcp::acceptor m_acceptor;
-            asio::ip::tcp::socket   m_acceptorSocket;
+            asio::io_service                                             m_io;
+            asio::basic_socket_acceptor<asio::generic::stream_protocol> m_acceptor;
+            asio::generic::stream_protocol::socket                       m_acceptorSocket;
+            std::unique_ptr<LocalSocketFile>                             m_localSocketFile;
         };
 
         void run() override;
@@ -145,14 +180,21 @@ namespace ramses::internal
         void doConnect(const ParticipantPtr& pp);
         void sendConnectionDescriptionOnNewConnection(const ParticipantPtr& pp);
         void doSendQueuedMessage(const ParticipantPtr& pp);
+        void writeCurrentOutBuffers(const ParticipantPtr& pp);
         void doTrySendAliveMessage(const ParticipantPtr& pp);
         void doReadHeader(const ParticipantPtr& pp);
         void doReadContent(const ParticipantPtr& pp);
 
         bool openAcceptor();
+        void closeAcceptor();
         void doAcceptIncomingConnections();
+        [[nodiscard]] std::optional<asio::generic::stream_protocol::endpoint> getEndpoint(const NetworkParticipantAddress& address) const;
+        [[nodiscard]] uint16_t getAcceptorPort() const;
+        [[nodiscard]] std::string endpointToString(const asio::generic::stream_protocol::endpoint& endpoint) const;
 
+        void finalizeMessage(OutMessage& msg) const;
         void sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg);
+        void enqueueMessage(const ParticipantPtr& pp, OutMessage msg);
         void removeParticipant(const ParticipantPtr& pp, bool reconnectWithBackoff = false);
         void addNewParticipantByAddress(const NetworkParticipantAddress& address);
         void initializeNewlyConnectedParticipant(const ParticipantPtr& pp);
@@ -176,6 +218,7 @@ namespace ramses::internal
 
         static const char* EnumToString(EParticipantState e);
         static const char* EnumToString(EParticipantType e);
+        static const char* EnumToString(ESendLane e);
 
         const NetworkParticipantAddress m_participantAddress;
         const uint32_t m_protocolVersion;
@@ -185,6 +228,8 @@ namespace ramses::internal
         const EParticipantType m_participantType;
         const std::chrono::milliseconds m_aliveInterval;
         const std::chrono::milliseconds m_aliveIntervalTimeout;
+        const uint32_t m_sendCoalescingSize;
+        const EConnectionProtocol m_protocol;
 
         PlatformLock& m_frameworkLock;
         PlatformThread m_thread;
@@ -21,7 +21,10 @@ namespace ramses::internal
     {
         // own address
         const bool isDaemon = true;
-        const NetworkParticipantAddress participantNetworkAddress(TCPConnectionSystem::GetDaemonId(), "SM", config.m_tcpConfig.getIPAddress(), config.m_tcpConfig.getPort(isDaemon));
+        const EConnectionProtocol protocol = config.getUsedProtocol();
+        const uint16_t port = config.m_tcpConfig.getPort(isDaemon);
+        const std::string ip = (protocol == EConnectionProtocol::Local) ? TCPConnectionSystem::GetLocalSocketPath(config.m_tcpConfig.getLocalSocketDirectory(), TCPConnectionSystem::GetDaemonId(), port) : config.m_tcpConfig.getIPAddress();
+        const NetworkParticipantAddress participantNetworkAddress(TCPConnectionSystem::GetDaemonId(), "SM", ip, port);
 
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TcpDiscoveryDaemon::TcpDiscoveryDaemon: My Address: {}:{}", participantNetworkAddress.getIp(), participantNetworkAddress.getPort());
 
@@ -30,7 +33,7 @@ namespace ramses::internal
                                                                       daemonNetworkAddress, true,
                                                                       frameworkLock,
                                                                       statisticCollection,
-                                                                      config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout());
+                                                                      config.m_tcpConfig.getAliveInterval(), config.m_tcpConfig.getAliveTimeout(), config.m_tcpConfig.getSendCoalescingSize(), protocol);
 
         if (optionalRamsh)
         {
@@ -105,7 +105,7 @@ namespace ramses::internal
         return result;
     }
 
-    void ClientSceneLogicBase::sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    void ClientSceneLogicBase::sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, const SceneActionCollection* sceneSnapshot)
     {
         if (m_subscribersWaitingForScene.empty())
         {
@@ -113,9 +113,17 @@ namespace ramses::internal
             return;
         }
 
+        const uint64_t startTime = PlatformTime::GetMillisecondsMonotonic();
         SceneUpdate sceneUpdate;
-        SceneActionCollectionCreator creator(sceneUpdate.actions);
-        SceneDescriber::describeScene<IScene>(scene, creator);
+        if (sceneSnapshot)
+        {
+            sceneUpdate.actions = sceneSnapshot->copy();
+        }
+        else
+        {
+            SceneActionCollectionCreator creator(sceneUpdate.actions);
+            SceneDescriber::describeScene<IScene>(scene, creator);
+        }
 
         m_resourceChangesSinceLastFlush.clear();
         size_t sceneResourcesSize = 0u;
@@ -128,10 +136,10 @@ namespace ramses::internal
             sceneUpdate.resources = m_resourceComponent.resolveResources(m_resourceChangesSinceLastFlush.m_resourcesAdded);
         assert(sceneUpdate.resources.size() == m_resourceChangesSinceLastFlush.m_resourcesAdded.size());
         sceneUpdate.flushInfos = { m_flushCounter, versionTag, scene.getSceneSizeInformation(), m_resourceChangesSinceLastFlush, {}, flushTimeInfo, true, true };
-        LOG_INFO(CONTEXT_CLIENT, "Sending scene {} to {} subscribers, {} scene actions ({} bytes), {} client resources, {} scene resource actions ({} bytes in total used by scene resources)",
+        LOG_INFO(CONTEXT_CLIENT, "Sending scene {} to {} subscribers, {} scene actions ({} bytes, {}), {} client resources, {} scene resource actions ({} bytes in total used by scene resources), prepared in {} ms",
             scene.getSceneId(), m_subscribersWaitingForScene.size(), sceneUpdate.actions.numberOfActions(),
-            sceneUpdate.actions.collectionData().size(), m_resourceChangesSinceLastFlush.m_resourcesAdded.size(),
-            m_resourceChangesSinceLastFlush.m_sceneResourceActions.size(), sceneResourcesSize);
+            sceneUpdate.actions.collectionData().size(), sceneSnapshot ? "cached snapshot" : "described", m_resourceChangesSinceLastFlush.m_resourcesAdded.size(),
+            m_resourceChangesSinceLastFlush.m_sceneResourceActions.size(), sceneResourcesSize, PlatformTime::GetMillisecondsMonotonic() - startTime);
 
         assert(m_scenePublicationMode.has_value());
         for(const auto& subscriber : m_subscribersWaitingForScene)
@@ -244,6 +252,12 @@ namespace ramses::internal
         }
     }
 
+    void ClientSceneLogicBase::coalesceSceneActions(SceneActionCollection& actions)
+    {
+        const uint32_t numRemovedActions = m_sceneActionCoalescer.coalesce(actions);
+        m_scene.getStatisticCollection().statSceneActionsCoalesced.incCounter(numRemovedActions);
+    }
+
     bool ClientSceneLogicBase::updateExpirationAndCheckIfChanged(const FlushTimeInformation& flushTimeInfo)
     {
         const bool hasExpirationTSChange = (flushTimeInfo.expirationTimestamp != m_lastFlushedExpirationTimestamp);
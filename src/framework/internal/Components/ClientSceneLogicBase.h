@@ -11,6 +11,7 @@
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
 #include <optional>
 
 namespace ramses::internal
@@ -47,11 +48,13 @@ namespace ramses::internal
         };
 
         virtual void postAddSubscriber() {};
-        void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
+        // sends given scene to waiting subscribers, scene actions are generated from scene unless a snapshot describing it is provided
+        void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag, const SceneActionCollection* sceneSnapshot = nullptr);
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneUpdate& update) const;
         ResourceChangeState verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions);
         void updateResourceStatistics();
         void fillStatisticsCollection();
+        void coalesceSceneActions(SceneActionCollection& actions);
         bool updateExpirationAndCheckIfChanged(const FlushTimeInformation& flushTimeInfo);
         [[nodiscard]] bool canSkipSceneActionSend(uint32_t numSceneActions, SceneVersionTag versionTag, bool expirationChanged, bool isEffectTimeSync) const;
 
@@ -72,6 +75,7 @@ namespace ramses::internal
 
         ResourceChanges m_resourceChangesSinceLastFlush; // keep container memory allocated
         ResourceContentHashVector m_currentFlushResourcesInUse; // keep container memory allocated
+        SceneActionCoalescer m_sceneActionCoalescer; // keep container memory allocated
 
         // resource statistics gathered while flushing the last time
         std::array<uint64_t, EResourceStatisticIndex_NumIndices> m_resourceCount{};
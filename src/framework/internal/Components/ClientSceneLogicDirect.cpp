@@ -45,6 +45,7 @@ namespace ramses::internal
 
         // swap out of ClientScene and reserve new memory there
         sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
+        coalesceSceneActions(sceneUpdate.actions);
 
         if (m_flushCounter == 0)
         {
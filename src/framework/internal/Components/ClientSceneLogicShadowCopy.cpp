@@ -11,6 +11,7 @@
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/SceneDescriber.h"
 #include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/Core/Utils/StatisticCollection.h"
@@ -20,9 +21,10 @@
 
 namespace ramses::internal
 {
-    ClientSceneLogicShadowCopy::ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress)
+    ClientSceneLogicShadowCopy::ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, bool sceneSnapshotCachingEnabled)
         : ClientSceneLogicBase(sceneGraphSender, scene, res, clientAddress)
         , m_sceneShadowCopy(SceneInfo(scene.getSceneId(), scene.getName()))
+        , m_sceneSnapshotCachingEnabled(sceneSnapshotCachingEnabled)
     {
         m_sceneShadowCopy.preallocateSceneSize(m_scene.getSceneSizeInformation());
     }
@@ -50,6 +52,7 @@ namespace ramses::internal
 
         // swap out of ClientScene and reserve new memory there
         sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
+        coalesceSceneActions(sceneUpdate.actions);
         if (resourceChangeState == ResourceChangeState::HasChanges)
             m_lastFlushUsedResources = m_resourceComponent.resolveResources(m_lastFlushResourcesInUse); // keep ll resources alive, in case we need to send a scene update to a new subscriber
 
@@ -83,6 +86,8 @@ namespace ramses::internal
         {
             m_sceneShadowCopy.preallocateSceneSize(sceneSizes);
             SceneActionApplier::ApplyActionsOnScene(m_sceneShadowCopy, sceneUpdate.actions);
+            if (m_sceneSnapshotCachingEnabled)
+                updateSceneSnapshot(sceneUpdate.actions);
             m_scene.getStatisticCollection().statSceneActionsGenerated.incCounter(sceneUpdate.actions.numberOfActions());
             m_scene.getStatisticCollection().statSceneActionsGeneratedSize.incCounter(static_cast<uint32_t>(sceneUpdate.actions.collectionData().size()));
         }
@@ -138,6 +143,24 @@ namespace ramses::internal
             m_flushTimeInfoOfLastFlush.isEffectTimeSync = true;
         }
 
-        sendSceneToWaitingSubscribers(m_sceneShadowCopy, m_flushTimeInfoOfLastFlush, m_lastVersionTag);
+        sendSceneToWaitingSubscribers(m_sceneShadowCopy, m_flushTimeInfoOfLastFlush, m_lastVersionTag, m_sceneSnapshotCachingEnabled ? &m_sceneSnapshot : nullptr);
+    }
+
+    void ClientSceneLogicShadowCopy::updateSceneSnapshot(const SceneActionCollection& flushedActions)
+    {
+        // flushed actions applied on top of snapshot lead to same scene as applied on top of shadow copy,
+        // describe shadow copy anew only once appended actions outgrow described part to keep snapshot size bounded
+        const size_t snapshotSize = m_sceneSnapshot.collectionData().size() + flushedActions.collectionData().size();
+        if (m_sceneSnapshot.empty() || snapshotSize > 2u * m_sceneSnapshotDescribedSize)
+        {
+            m_sceneSnapshot.clear();
+            SceneActionCollectionCreator creator(m_sceneSnapshot);
+            SceneDescriber::describeScene<IScene>(m_sceneShadowCopy, creator);
+            m_sceneSnapshotDescribedSize = m_sceneSnapshot.collectionData().size();
+        }
+        else
+        {
+            m_sceneSnapshot.append(flushedActions);
+        }
     }
 }
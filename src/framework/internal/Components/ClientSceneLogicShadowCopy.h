@@ -17,18 +17,25 @@ namespace ramses::internal
     class ClientSceneLogicShadowCopy final : public ClientSceneLogicBase
     {
     public:
-        ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress);
+        ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, bool sceneSnapshotCachingEnabled = false);
 
         bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
 
     private:
         void postAddSubscriber() override;
         void sendShadowCopySceneToWaitingSubscribers();
+        void updateSceneSnapshot(const SceneActionCollection& flushedActions);
 
         SceneWithExplicitMemory m_sceneShadowCopy;
         FlushTimeInformation m_flushTimeInfoOfLastFlush;
         FlushTime::Clock::time_point m_effectTimeSync{FlushTime::InvalidTimestamp};
         SceneVersionTag m_lastVersionTag;
         ManagedResourceVector m_lastFlushUsedResources;
+
+        // scene actions describing shadow copy, ready to be sent to new subscribers:
+        // shadow copy described at some flush followed by actions of all flushes since
+        const bool m_sceneSnapshotCachingEnabled;
+        SceneActionCollection m_sceneSnapshot;
+        size_t m_sceneSnapshotDescribedSize = 0u;
     };
 }
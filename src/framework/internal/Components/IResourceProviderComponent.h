@@ -31,6 +31,7 @@ namespace ramses::internal
         virtual ResourceHashUsage getResourceHashUsage(const ResourceContentHash& hash) = 0;
         virtual SceneFileHandle addResourceFile(InputStreamContainerSPtr resourceFileInputStream, const ResourceTableOfContents& toc) = 0;
         virtual void loadResourceFromFile(SceneFileHandle handle) = 0;
+        virtual ManagedResourceVector prefetchResourceFile(SceneFileHandle handle) = 0;
         virtual void removeResourceFile(SceneFileHandle handle) = 0;
         [[nodiscard]] virtual bool hasResourceFile(SceneFileHandle handle) const = 0;
 
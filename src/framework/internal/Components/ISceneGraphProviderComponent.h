@@ -26,7 +26,7 @@ namespace ramses::internal
     {
     public:
         virtual ~ISceneGraphProviderComponent() = default;
-        virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventInterface) = 0;
+        virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneSnapshotCaching, ISceneProviderEventConsumer& eventInterface) = 0;
         virtual void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) = 0;
         virtual void handleUnpublishScene(SceneId sceneId) = 0;
         virtual bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
@@ -0,0 +1,37 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/InputStreamContainer.h"
+#include "internal/Core/Utils/BinaryMappedFileInputStream.h"
+
+#include <string_view>
+
+namespace ramses::internal
+{
+    class MappedFileInputStreamContainer : public IInputStreamContainer
+    {
+    public:
+        explicit MappedFileInputStreamContainer(std::string_view filename)
+            : m_stream(filename)
+        {}
+
+        MappedFileInputStreamContainer(int fd, size_t offset, size_t length)
+            : m_stream(fd, offset, length)
+        {}
+
+        IInputStream& getStream() override
+        {
+            return m_stream;
+        }
+
+    private:
+        BinaryMappedFileInputStream m_stream;
+    };
+}
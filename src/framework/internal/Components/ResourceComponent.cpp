@@ -10,18 +10,28 @@
 #include "internal/Components/ResourceTableOfContents.h"
 #include "internal/Components/ResourceFilesRegistry.h"
 #include "internal/Components/SceneFileHandle.h"
+#include "internal/Components/ResourcePersistation.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/PlatformAbstraction/Collections/HashSet.h"
+
+#include <unordered_map>
 
 namespace ramses::internal
 {
-    ResourceComponent::ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock)
+    ResourceComponent::ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock, uint32_t resourceProcessingThreadCount)
         : m_resourceStorage(frameworkLock, statistics)
+        , m_resourceCompressionThreadPool(resourceProcessingThreadCount)
         , m_statistics(statistics)
     {
     }
 
     ResourceComponent::~ResourceComponent() = default;
 
+    ResourceCompressionThreadPool& ResourceComponent::getResourceCompressionThreadPool()
+    {
+        return m_resourceCompressionThreadPool;
+    }
+
     ManagedResource ResourceComponent::getResource(ResourceContentHash hash)
     {
         return m_resourceStorage.getResource(hash);
@@ -74,18 +84,42 @@ namespace ramses::internal
             return;
         }
 
+        ResourceContentHashVector inUse;
+        ResourceContentHashVector toLoad;
         for (auto const& entry : *content)
         {
             auto const& id = entry.key;
             if (m_resourceStorage.isFileResourceInUseAnywhereElse(id))
             {
-                ManagedResource res;
+                inUse.push_back(id);
                 if (!m_resourceStorage.getResource(id))
-                    res = loadResource(id);
-
-                m_resourceStorage.markDeletionDisallowed(id);
+                    toLoad.push_back(id);
             }
         }
+
+        // keep loaded resources alive until they are marked to be kept
+        const ManagedResourceVector loaded = loadResources(toLoad);
+        for (const auto& id : inUse)
+            m_resourceStorage.markDeletionDisallowed(id);
+    }
+
+    ManagedResourceVector ResourceComponent::prefetchResourceFile(SceneFileHandle handle)
+    {
+        const FileContentsMap* content = m_resourceFiles.getContentsOfResourceFile(handle);
+        if (!content)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "ResourceComponent::prefetchResourceFile: handle {} unknown, can't prefetch", handle);
+            return {};
+        }
+
+        ResourceContentHashVector hashes;
+        hashes.reserve(content->size());
+        for (auto const& entry : *content)
+            hashes.push_back(entry.key);
+
+        ManagedResourceVector prefetched = resolveResources(hashes);
+        LOG_INFO(CONTEXT_FRAMEWORK, "ResourceComponent::prefetchResourceFile: prefetched {} of {} resources from file {}", prefetched.size(), hashes.size(), handle);
+        return prefetched;
     }
 
     void ResourceComponent::removeResourceFile(SceneFileHandle handle)
@@ -144,22 +178,38 @@ namespace ramses::internal
 
     ManagedResourceVector ResourceComponent::resolveResources(ResourceContentHashVector& hashes)
     {
+        ManagedResourceVector resolved(hashes.size());
+        ResourceContentHashVector toLoad;
+        for (size_t i = 0u; i < hashes.size(); ++i)
+        {
+            resolved[i] = getResource(hashes[i]);
+            if (!resolved[i])
+                toLoad.push_back(hashes[i]);
+        }
+
+        if (!toLoad.empty())
+        {
+            const ManagedResourceVector loaded = loadResources(toLoad);
+            auto loadedIt = loaded.cbegin();
+            for (auto& mr : resolved)
+            {
+                if (!mr)
+                    mr = *loadedIt++;
+            }
+        }
+
         ManagedResourceVector result;
         result.reserve(hashes.size());
         ResourceContentHashVector failed;
-        for (auto& hash : hashes)
+        for (size_t i = 0u; i < hashes.size(); ++i)
         {
-            ManagedResource mr = getResource(hash);
-            if (!mr)
-                mr = loadResource(hash);
-
-            if (mr)
+            if (resolved[i])
             {
-                result.push_back(mr);
+                result.push_back(std::move(resolved[i]));
             }
             else
             {
-                failed.push_back(hash);
+                failed.push_back(hashes[i]);
             }
         }
 
@@ -169,6 +219,82 @@ namespace ramses::internal
         return result;
     }
 
+    ManagedResourceVector ResourceComponent::loadResources(const ResourceContentHashVector& hashes)
+    {
+        if (hashes.size() <= 1u)
+        {
+            ManagedResourceVector result;
+            for (const auto& hash : hashes)
+                result.push_back(loadResource(hash));
+            return result;
+        }
+
+        // load resources of every file in one batch, ordered by file offset and with neighbouring resources read together
+        struct FileEntries
+        {
+            IInputStream* stream = nullptr;
+            std::vector<ResourceFileEntry> entries;
+        };
+        std::unordered_map<SceneFileHandle, FileEntries> entriesPerFile;
+        // same hash may be requested several times, it must be read and managed only once
+        HashSet<ResourceContentHash> requestedHashes(hashes.size());
+        for (const auto& hash : hashes)
+        {
+            if (requestedHashes.contains(hash))
+                continue;
+            requestedHashes.put(hash);
+
+            IInputStream* resourceStream = nullptr;
+            ResourceFileEntry entry;
+            SceneFileHandle fileHandle;
+            if (EStatus::Ok == m_resourceFiles.getEntry(hash, resourceStream, entry, fileHandle))
+            {
+                auto& fileEntries = entriesPerFile[fileHandle];
+                fileEntries.stream = resourceStream;
+                fileEntries.entries.push_back(entry);
+            }
+        }
+
+        HashMap<ResourceContentHash, ManagedResource> loadedResources(hashes.size());
+        for (auto& fileEntries : entriesPerFile)
+        {
+            auto& entries = fileEntries.second.entries;
+            std::vector<std::unique_ptr<IResource>> lowLevelResources;
+            try
+            {
+                lowLevelResources = ResourcePersistation::RetrieveResourcesFromStream(*fileEntries.second.stream, entries, m_resourceCompressionThreadPool);
+            }
+            catch (std::exception const& e)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceComponent::loadResources: RetrieveResourcesFromStream CRITICALLY failed with a std::exception ('{}') for {} resources"
+                    " from fileHandle {}. No resources created, expect further errors.", e.what(), entries.size(), fileEntries.first);
+                continue;
+            }
+            for (size_t i = 0u; i < entries.size(); ++i)
+            {
+                if (!lowLevelResources[i])
+                {
+                    LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceComponent::loadResources: RetrieveResourcesFromStream failed for type {}, hash {}, fileHandle {}, offset {}, size {}. Expect further errors.",
+                        entries[i].resourceInfo.type, entries[i].resourceInfo.hash, fileEntries.first, entries[i].offsetInBytes, entries[i].sizeInBytes);
+                    continue;
+                }
+
+                m_statistics.statResourcesLoadedFromFileNumber.incCounter(1);
+                m_statistics.statResourcesLoadedFromFileSize.incCounter(entries[i].sizeInBytes);
+                loadedResources.put(entries[i].resourceInfo.hash, m_resourceStorage.manageResource(*lowLevelResources[i].release(), true));
+            }
+        }
+
+        ManagedResourceVector result;
+        result.reserve(hashes.size());
+        for (const auto& hash : hashes)
+        {
+            const ManagedResource* loaded = loadedResources.get(hash);
+            result.push_back(loaded ? *loaded : ManagedResource{});
+        }
+        return result;
+    }
+
     ResourceInfo const& ResourceComponent::getResourceInfo(ResourceContentHash const& hash)
     {
         return m_resourceStorage.getResourceInfo(hash);
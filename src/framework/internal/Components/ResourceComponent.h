@@ -11,6 +11,7 @@
 #include "ResourceStorage.h"
 #include "internal/Components/ResourceHashUsage.h"
 #include "ResourceFilesRegistry.h"
+#include "ResourceCompressionThreadPool.h"
 
 #include "IResourceProviderComponent.h"
 #include "internal/Core/Utils/StatisticCollection.h"
@@ -20,7 +21,7 @@ namespace ramses::internal
     class ResourceComponent : public IResourceProviderComponent
     {
     public:
-        ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock);
+        ResourceComponent(StatisticCollectionFramework& statistics, PlatformLock& frameworkLock, uint32_t resourceProcessingThreadCount);
         ~ResourceComponent() override;
 
         // implement IResourceProviderComponent
@@ -31,6 +32,7 @@ namespace ramses::internal
         ResourceHashUsage getResourceHashUsage(const ResourceContentHash& hash) override;
         SceneFileHandle addResourceFile(InputStreamContainerSPtr resourceFileInputStream, const ResourceTableOfContents& toc) override;
         void loadResourceFromFile(SceneFileHandle handle) override;
+        ManagedResourceVector prefetchResourceFile(SceneFileHandle handle) override;
         void removeResourceFile(SceneFileHandle handle) override;
         [[nodiscard]] bool hasResourceFile(SceneFileHandle handle) const override;
 
@@ -44,9 +46,16 @@ namespace ramses::internal
 
         ManagedResource manageResourceDeletionAllowed(const IResource& resource);
 
+        // shared with scene graph component which compresses resources of scene updates on same threads
+        ResourceCompressionThreadPool& getResourceCompressionThreadPool();
+
     private:
+        // result has same order as hashes, resources which could not be loaded are empty
+        ManagedResourceVector loadResources(const ResourceContentHashVector& hashes);
+
         ResourceStorage m_resourceStorage;
         ResourceFilesRegistry m_resourceFiles;
+        ResourceCompressionThreadPool m_resourceCompressionThreadPool;
 
         StatisticCollectionFramework& m_statistics;
     };
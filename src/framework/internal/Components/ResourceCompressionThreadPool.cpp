@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Components/ResourceCompressionThreadPool.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace ramses::internal
+{
+    void ResourceCompressionThreadPool::compress(const ManagedResourceVector& resources, IResource::CompressionLevel level)
+    {
+        execute(resources.size(), [&](size_t idx) {
+            const auto& resource = resources[idx];
+            // hash is needed for serialization anyway, calculate it here even if resource is not compressed
+            resource->getHash();
+            if (!IsCompressedInBlocks(*resource, level))
+                resource->compress(level);
+        });
+
+        // a single large resource would keep one thread busy while others are idle, compress its blocks concurrently instead.
+        // Done after all tasks finished, pool must not be used from within its own tasks
+        for (const auto& resource : resources)
+        {
+            if (IsCompressedInBlocks(*resource, level))
+                resource->compress(level, *this);
+        }
+    }
+
+    bool ResourceCompressionThreadPool::IsCompressedInBlocks(const IResource& resource, IResource::CompressionLevel level)
+    {
+        // only realtime compression uses block format, see ResourceBase::compress
+        return level == IResource::CompressionLevel::Realtime && resource.getDecompressedDataSize() > LZ4CompressionUtils::BlockSize;
+    }
+
+    uint32_t ResourceCompressionThreadPool::GetDefaultWorkerCount()
+    {
+        // leave one core to calling thread, which also compresses, and keep footprint small on many-core systems
+        const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 1u ? std::min(hardwareThreads - 1u, 4u) : 0u;
+    }
+}
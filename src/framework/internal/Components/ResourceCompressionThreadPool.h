@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/ManagedResource.h"
+#include "internal/SceneGraph/Resource/IResource.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
+
+namespace ramses::internal
+{
+    // Computes hash and compresses given resources concurrently on a set of worker threads.
+    // Calling thread helps processing and returns only once all resources are done. Each resource
+    // is compressed independently, so the result is identical to compressing them one after another.
+    // Resources compressed in LZ4 blocks are compressed one after another, each with its blocks compressed concurrently.
+    // Same threads are used for other per resource work (e.g. deserializing resources loaded from file) via execute().
+    class ResourceCompressionThreadPool : public WorkerThreadPool
+    {
+    public:
+        using WorkerThreadPool::WorkerThreadPool;
+
+        void compress(const ManagedResourceVector& resources, IResource::CompressionLevel level);
+
+        [[nodiscard]] static uint32_t GetDefaultWorkerCount();
+
+    private:
+        [[nodiscard]] static bool IsCompressedInBlocks(const IResource& resource, IResource::CompressionLevel level);
+    };
+}
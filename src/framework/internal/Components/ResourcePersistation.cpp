@@ -16,13 +16,98 @@
 #include "internal/Core/Utils/BinaryFileOutputStream.h"
 #include "internal/Components/ManagedResource.h"
 #include "internal/Components/ResourceTableOfContents.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
 #include "internal/SceneGraph/Resource/ResourceInfo.h"
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/Components/SingleResourceSerialization.h"
 #include "internal/Core/Utils/LogMacros.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace ramses::internal
 {
+    namespace
+    {
+        // stream over resource data within chunk, reading beyond resource data fails instead of reading past chunk
+        class ChunkInputStream final : public IInputStream
+        {
+        public:
+            ChunkInputStream(const std::byte* data, size_t size)
+                : m_data(data)
+                , m_size(size)
+            {
+            }
+
+            IInputStream& read(void* buffer, size_t size) override
+            {
+                if (m_state != EStatus::Ok || size > m_size - m_pos)
+                {
+                    m_state = EStatus::Error;
+                    if (size != 0u)
+                        std::memset(buffer, 0, size);
+                    return *this;
+                }
+                if (size != 0u)
+                    std::memcpy(buffer, m_data + m_pos, size);
+                m_pos += size;
+                return *this;
+            }
+
+            EStatus seek(int64_t /*numberOfBytesToSeek*/, Seek /*origin*/) override
+            {
+                return EStatus::Error;
+            }
+
+            EStatus getPos(size_t& position) const override
+            {
+                position = m_pos;
+                return EStatus::Ok;
+            }
+
+            [[nodiscard]] EStatus getState() const override
+            {
+                return m_state;
+            }
+
+        private:
+            const std::byte* m_data;
+            size_t m_size;
+            size_t m_pos = 0u;
+            EStatus m_state = EStatus::Ok;
+        };
+
+        std::unique_ptr<IResource> DeserializeResourceFromChunk(const std::byte* data, const ResourceFileEntry& fileEntry)
+        {
+            ChunkInputStream stream(data, fileEntry.sizeInBytes);
+            std::unique_ptr<IResource> resource;
+            try
+            {
+                // called on worker thread, exception (e.g. allocation failure for invalid data) must not leave it
+                resource = ResourcePersistation::ReadOneResourceFromStream(stream, fileEntry.resourceInfo.hash);
+            }
+            catch (std::exception const& e)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourcesFromStream: resource deserialization failed with exception ('{}') for {}",
+                    e.what(), fileEntry.resourceInfo.hash);
+                return {};
+            }
+            if (!resource)
+                return {};
+
+            size_t currentPosAfterRead = 0;
+            stream.getPos(currentPosAfterRead);
+            if (stream.getState() != EStatus::Ok || currentPosAfterRead != fileEntry.sizeInBytes)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourcesFromStream: resource deserialization failed for {}, state {} (resSize {}, readSize {})",
+                    fileEntry.resourceInfo.hash, stream.getState(), fileEntry.sizeInBytes, currentPosAfterRead);
+                return {};
+            }
+
+            return resource;
+        }
+    }
+
     void ResourcePersistation::WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource)
     {
         SingleResourceSerialization::SerializeResource(outStream, *resource.get());
@@ -33,7 +118,8 @@ namespace ramses::internal
         return SingleResourceSerialization::DeserializeResource(inStream, hash);
     }
 
-    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress)
+    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress,
+        ResourceCompressionThreadPool* compressionThreadPool)
     {
         // achieve maximum resource file loading speed by reading in increasing file position order
         // so store TOC first followed by all resources, as the toc is read before the resources
@@ -50,9 +136,17 @@ namespace ramses::internal
         uint32_t currentPosAfterWrite = 0;
 
         // possible compress all resources before writing
-        for (const auto& res : resourcesForFile)
+        const auto compressionLevel = compress ? IResource::CompressionLevel::Offline : IResource::CompressionLevel::None;
+        if (compressionThreadPool)
+        {
+            compressionThreadPool->compress(resourcesForFile, compressionLevel);
+        }
+        else
         {
-            res->compress(compress ? IResource::CompressionLevel::Offline : IResource::CompressionLevel::None);
+            for (const auto& res : resourcesForFile)
+            {
+                res->compress(compressionLevel);
+            }
         }
 
         for (const auto& res : resourcesForFile)
@@ -123,4 +217,60 @@ namespace ramses::internal
 
         return resource;
     }
+
+    std::vector<std::unique_ptr<IResource>> ResourcePersistation::RetrieveResourcesFromStream(IInputStream& inStream, std::vector<ResourceFileEntry>& entries,
+        ResourceCompressionThreadPool& threadPool)
+    {
+        std::sort(entries.begin(), entries.end(), [](const auto& e1, const auto& e2) { return e1.offsetInBytes < e2.offsetInBytes; });
+        std::vector<std::unique_ptr<IResource>> resources(entries.size());
+
+        size_t entryIdx = 0u;
+        while (entryIdx < entries.size())
+        {
+            // read chunks of neighbouring entries in increasing file offset order, remember where data of every entry is
+            std::vector<std::vector<std::byte>> chunks;
+            std::vector<std::pair<size_t, const std::byte*>> entriesInChunks;
+            size_t chunksSize = 0u;
+            while (entryIdx < entries.size() && chunksSize < MaxChunksSizeInBatch)
+            {
+                const size_t chunkStart = entries[entryIdx].offsetInBytes;
+                size_t chunkEnd = chunkStart + entries[entryIdx].sizeInBytes;
+                size_t chunkEndIdx = entryIdx + 1u;
+                for (; chunkEndIdx < entries.size(); ++chunkEndIdx)
+                {
+                    const size_t entryStart = entries[chunkEndIdx].offsetInBytes;
+                    const size_t entryEnd = entryStart + entries[chunkEndIdx].sizeInBytes;
+                    if (entryStart > chunkEnd + MaxGapInChunk || entryEnd - chunkStart > MaxChunkSize)
+                        break;
+                    chunkEnd = std::max(chunkEnd, entryEnd);
+                }
+
+                LOG_DEBUG(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourcesFromStream: {} resources, Size {}, Offset {}", chunkEndIdx - entryIdx, chunkEnd - chunkStart, chunkStart);
+
+                // moving chunk into chunks vector keeps its data, so pointers into it stay valid
+                std::vector<std::byte> chunk(chunkEnd - chunkStart);
+                if (inStream.seek(static_cast<int64_t>(chunkStart), IInputStream::Seek::FromBeginning) == EStatus::Ok &&
+                    inStream.read(chunk.data(), chunk.size()).getState() == EStatus::Ok)
+                {
+                    for (size_t i = entryIdx; i < chunkEndIdx; ++i)
+                        entriesInChunks.emplace_back(i, chunk.data() + (entries[i].offsetInBytes - chunkStart));
+                    chunksSize += chunk.size();
+                    chunks.push_back(std::move(chunk));
+                }
+                else
+                {
+                    LOG_ERROR(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourcesFromStream: reading {} resources failed, state {} (offset {}, size {})",
+                        chunkEndIdx - entryIdx, inStream.getState(), chunkStart, chunkEnd - chunkStart);
+                }
+                entryIdx = chunkEndIdx;
+            }
+
+            threadPool.execute(entriesInChunks.size(), [&](size_t idx) {
+                const auto& entryInChunk = entriesInChunks[idx];
+                resources[entryInChunk.first] = DeserializeResourceFromChunk(entryInChunk.second, entries[entryInChunk.first]);
+            });
+        }
+
+        return resources;
+    }
 }
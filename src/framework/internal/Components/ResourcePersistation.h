@@ -19,14 +19,29 @@ namespace ramses::internal
     class IInputStream;
     class BinaryFileOutputStream;
     struct ResourceFileEntry;
+    class ResourceCompressionThreadPool;
 
     class ResourcePersistation
     {
     public:
-        static void WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress);
+        static void WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress,
+            ResourceCompressionThreadPool* compressionThreadPool = nullptr);
         static void WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource);
 
         static std::unique_ptr<IResource> ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash);
         static std::unique_ptr<IResource> RetrieveResourceFromStream(IInputStream& inStream, const ResourceFileEntry& entry);
+
+        // Retrieves multiple resources with as few reads as possible: entries are sorted by file offset (in place) and
+        // neighbouring entries are read together in chunks, which are then deserialized on given thread pool.
+        // Returned resources correspond to sorted entries, resources which failed to load are nullptr.
+        static std::vector<std::unique_ptr<IResource>> RetrieveResourcesFromStream(IInputStream& inStream, std::vector<ResourceFileEntry>& entries,
+            ResourceCompressionThreadPool& threadPool);
+
+        // entries separated by at most this many bytes are read in one chunk (gap is read and dropped)
+        static constexpr size_t MaxGapInChunk = 64u * 1024u;
+        // maximum size of a chunk unless single entry is larger
+        static constexpr size_t MaxChunkSize = 8u * 1024u * 1024u;
+        // chunks are read until this size is reached before they are deserialized, limits additional memory used while loading
+        static constexpr size_t MaxChunksSizeInBatch = 64u * 1024u * 1024u;
     };
 }
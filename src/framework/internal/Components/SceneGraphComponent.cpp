@@ -30,6 +30,7 @@ namespace ramses::internal
         ICommunicationSystem& communicationSystem,
         IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier,
         IResourceProviderComponent& res,
+        ResourceCompressionThreadPool& resourceCompressionThreadPool,
         PlatformLock& frameworkLock,
         EFeatureLevel featureLevel)
         : m_sceneRendererHandler(nullptr)
@@ -39,6 +40,7 @@ namespace ramses::internal
         , m_frameworkLock(frameworkLock)
         , m_resourceComponent(res)
         , m_featureLevel{ featureLevel }
+        , m_resourceCompressionThreadPool(resourceCompressionThreadPool)
     {
         m_connectionStatusUpdateNotifier.registerForConnectionUpdates(this);
         m_communicationSystem.setSceneProviderServiceHandler(this);
@@ -126,25 +128,21 @@ namespace ramses::internal
     {
         // send to network (no ownership transfer)
         bool sendToSelf = false;
-        bool alreadyCompressed = false;
+        std::vector<Guid> remoteSubscribers;
+        remoteSubscribers.reserve(toVec.size());
         for (const auto& to : toVec)
         {
             if (m_myID == to)
-            {
                 sendToSelf = true;
-            }
             else
-            {
-                if (!alreadyCompressed)
-                {
-                    for (auto& resource : sceneUpdate.resources)
-                    {
-                        resource->compress(IResource::CompressionLevel::Realtime);
-                    }
-                    alreadyCompressed = true;
-                }
-                m_communicationSystem.sendSceneUpdate(to, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics));
-            }
+                remoteSubscribers.push_back(to);
+        }
+
+        if (!remoteSubscribers.empty())
+        {
+            m_resourceCompressionThreadPool.compress(sceneUpdate.resources, IResource::CompressionLevel::Realtime);
+            // serialize once, resulting packets are shared by all remote subscribers
+            m_communicationSystem.sendSceneUpdate(remoteSubscribers, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics));
         }
 
         // send to self last to move sceneUpdate to local renderer
@@ -293,7 +291,7 @@ namespace ramses::internal
         }
     }
 
-    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer)
+    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneSnapshotCaching, ISceneProviderEventConsumer& eventConsumer)
     {
         const SceneId sceneId = scene.getSceneId();
         assert(!m_clientSceneLogicMap.contains(sceneId));
@@ -305,8 +303,8 @@ namespace ramses::internal
         }
         else
         {
-            LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene {} (shadow copy)", scene.getSceneId());
-            sceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_resourceComponent, m_myID);
+            LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene {} (shadow copy, snapshot caching {})", scene.getSceneId(), enableSceneSnapshotCaching);
+            sceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_resourceComponent, m_myID, enableSceneSnapshotCaching);
         }
         m_sceneEventConsumers.put(sceneId, &eventConsumer);
         m_clientSceneLogicMap.put(sceneId, sceneLogic);
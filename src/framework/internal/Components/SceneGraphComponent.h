@@ -19,6 +19,7 @@
 #include "ISceneProviderEventConsumer.h"
 #include "ERendererToClientEventType.h"
 #include "ramses/framework/EFeatureLevel.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
 #include "internal/Core/Utils/IPeriodicLogSupplier.h"
 #include "internal/PlatformAbstraction/PlatformLock.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
@@ -51,6 +52,7 @@ namespace ramses::internal
             ICommunicationSystem& communicationSystem,
             IConnectionStatusUpdateNotifier& connectionStatusUpdateNotifier,
             IResourceProviderComponent& res,
+            ResourceCompressionThreadPool& resourceCompressionThreadPool,
             PlatformLock& frameworkLock,
             EFeatureLevel featureLevel);
         ~SceneGraphComponent() override;
@@ -74,7 +76,7 @@ namespace ramses::internal
         void participantHasDisconnected(const Guid& disconnnectedParticipant) override;
 
         // ISceneGraphProviderComponent
-        void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer) override;
+        void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneSnapshotCaching, ISceneProviderEventConsumer& eventConsumer) override;
         void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) override;
         void handleUnpublishScene(SceneId sceneId) override;
         bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
@@ -124,6 +126,8 @@ namespace ramses::internal
 
         EFeatureLevel m_featureLevel = EFeatureLevel_01;
 
+        ResourceCompressionThreadPool& m_resourceCompressionThreadPool;
+
         struct ReceivedScene
         {
             SceneInfo info;
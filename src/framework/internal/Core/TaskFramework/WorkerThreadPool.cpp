@@ -0,0 +1,122 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
+#include "internal/Core/TaskFramework/ThreadedTaskExecutor.h"
+#include "internal/Core/TaskFramework/ITask.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+
+namespace ramses::internal
+{
+    struct WorkerThreadPool::Batch
+    {
+        Batch(size_t itemCount_, const TaskFunc& itemFunc_, size_t taskCount)
+            : itemCount(itemCount_)
+            , itemFunc(itemFunc_)
+            , runningTasks(taskCount)
+        {
+        }
+
+        size_t itemCount;
+        const TaskFunc& itemFunc;
+        std::atomic<size_t> nextItemIdx{ 0u };
+
+        std::mutex lock;
+        std::condition_variable tasksFinished;
+        size_t runningTasks;
+    };
+
+    class WorkerThreadPool::BatchTask final : public ITask
+    {
+    public:
+        explicit BatchTask(Batch& batch)
+            : m_batch(batch)
+        {
+        }
+
+        void execute() override
+        {
+            ProcessBatch(m_batch);
+
+            // batch is owned by thread waiting for all tasks, it must not be accessed after notification
+            std::lock_guard<std::mutex> guard(m_batch.lock);
+            --m_batch.runningTasks;
+            m_batch.tasksFinished.notify_one();
+        }
+
+    private:
+        Batch& m_batch;
+    };
+
+    WorkerThreadPool::WorkerThreadPool(uint32_t workerCount)
+        : m_workerCount(workerCount)
+    {
+    }
+
+    WorkerThreadPool::~WorkerThreadPool() = default;
+
+    void WorkerThreadPool::execute(size_t taskCount, const TaskFunc& taskFunc)
+    {
+        // one item is processed by calling thread itself
+        const size_t workerTaskCount = std::min<size_t>(m_workerCount, taskCount - std::min<size_t>(taskCount, 1u));
+        Batch batch{ taskCount, taskFunc, workerTaskCount };
+        enqueueWorkerTasks(batch, workerTaskCount);
+
+        ProcessBatch(batch);
+        WaitForWorkerTasks(batch);
+    }
+
+    void WorkerThreadPool::execute(size_t taskCount, const TaskFunc& taskFunc, const CallingThreadFunc& callingThreadFunc)
+    {
+        // calling thread is busy with its own work first, so workers may take all items
+        const size_t workerTaskCount = std::min<size_t>(m_workerCount, taskCount);
+        Batch batch{ taskCount, taskFunc, workerTaskCount };
+        enqueueWorkerTasks(batch, workerTaskCount);
+
+        callingThreadFunc();
+        ProcessBatch(batch);
+        WaitForWorkerTasks(batch);
+    }
+
+    uint32_t WorkerThreadPool::getWorkerCount() const
+    {
+        return m_workerCount;
+    }
+
+    void WorkerThreadPool::enqueueWorkerTasks(Batch& batch, size_t workerTaskCount)
+    {
+        if (workerTaskCount == 0u)
+            return;
+
+        std::lock_guard<std::mutex> guard(m_taskExecutorLock);
+        if (!m_taskExecutor)
+            m_taskExecutor = std::make_unique<ThreadedTaskExecutor>(static_cast<uint16_t>(m_workerCount));
+
+        for (size_t i = 0u; i < workerTaskCount; ++i)
+        {
+            auto task = new BatchTask(batch);
+            m_taskExecutor->enqueue(*task);
+            task->release();
+        }
+    }
+
+    void WorkerThreadPool::ProcessBatch(Batch& batch)
+    {
+        for (size_t idx = batch.nextItemIdx++; idx < batch.itemCount; idx = batch.nextItemIdx++)
+            batch.itemFunc(idx);
+    }
+
+    void WorkerThreadPool::WaitForWorkerTasks(Batch& batch)
+    {
+        std::unique_lock<std::mutex> l(batch.lock);
+        batch.tasksFinished.wait(l, [&batch]() { return batch.runningTasks == 0u; });
+    }
+}
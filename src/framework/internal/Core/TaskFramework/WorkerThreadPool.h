@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace ramses::internal
+{
+    class ThreadedTaskExecutor;
+
+    // Executes indexed work concurrently on a set of worker threads.
+    // Calling thread takes part in execution and returns only once work for all indices is finished,
+    // so the caller is responsible for passing only work items which can be processed independently.
+    // Worker threads are only created on first use which needs them.
+    // execute() must not be called from a task of the same pool: the nested call waits for worker tasks it enqueued,
+    // which cannot start while all workers are blocked in such nested calls, so the pool deadlocks.
+    class WorkerThreadPool
+    {
+    public:
+        using TaskFunc = std::function<void(size_t)>;
+        using CallingThreadFunc = std::function<void()>;
+
+        explicit WorkerThreadPool(uint32_t workerCount);
+        ~WorkerThreadPool();
+
+        WorkerThreadPool(const WorkerThreadPool&) = delete;
+        WorkerThreadPool& operator=(const WorkerThreadPool&) = delete;
+
+        // calls taskFunc for every index in [0, taskCount) and returns once all calls are done
+        void execute(size_t taskCount, const TaskFunc& taskFunc);
+        // same as above, but calling thread first executes callingThreadFunc (work which must stay on calling thread)
+        // and only then helps with remaining indices
+        void execute(size_t taskCount, const TaskFunc& taskFunc, const CallingThreadFunc& callingThreadFunc);
+
+        [[nodiscard]] uint32_t getWorkerCount() const;
+
+    private:
+        struct Batch;
+        class BatchTask;
+
+        void enqueueWorkerTasks(Batch& batch, size_t workerTaskCount);
+        static void ProcessBatch(Batch& batch);
+        static void WaitForWorkerTasks(Batch& batch);
+
+        uint32_t m_workerCount;
+        std::mutex m_taskExecutorLock;
+        std::unique_ptr<ThreadedTaskExecutor> m_taskExecutor;
+    };
+}
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/BinaryMappedFileInputStream.h"
+#include <cstring>
+
+namespace ramses::internal
+{
+    BinaryMappedFileInputStream::BinaryMappedFileInputStream(std::string_view filename)
+        : m_mappedFile(filename)
+        , m_state(m_mappedFile.isValid() ? EStatus::Ok : EStatus::Error)
+    {
+    }
+
+    BinaryMappedFileInputStream::BinaryMappedFileInputStream(int fd, size_t offset, size_t length)
+        : m_mappedFile(fd, offset, length)
+        , m_state(m_mappedFile.isValid() ? EStatus::Ok : EStatus::Error)
+    {
+    }
+
+    IInputStream& BinaryMappedFileInputStream::read(void* buffer, size_t size)
+    {
+        if (EStatus::Ok != m_state)
+            return *this;
+        if (buffer == nullptr)
+        {
+            m_state = EStatus::Error;
+            return *this;
+        }
+        if (size > m_mappedFile.size() - m_pos)
+        {
+            m_state = EStatus::Eof;
+            return *this;
+        }
+
+        std::memcpy(buffer, m_mappedFile.data() + m_pos, size);
+        m_pos += size;
+
+        return *this;
+    }
+
+    EStatus BinaryMappedFileInputStream::seek(int64_t numberOfBytesToSeek, Seek origin)
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+
+        int64_t newPos = 0;
+        switch (origin)
+        {
+        case Seek::FromBeginning:
+            newPos = numberOfBytesToSeek;
+            break;
+        case Seek::Relative:
+            newPos = static_cast<int64_t>(m_pos) + numberOfBytesToSeek;
+            break;
+        }
+        if (newPos < 0 || newPos > static_cast<int64_t>(m_mappedFile.size()))
+            return EStatus::Error;
+
+        // seek precedes reading another section (scene objects, resources), possibly long after file was mapped.
+        // Reading pages of a file truncated meanwhile would crash, so fail instead.
+        if (!m_mappedFile.isFileComplete())
+        {
+            m_state = EStatus::Error;
+            return EStatus::Error;
+        }
+
+        m_pos = static_cast<size_t>(newPos);
+
+        return EStatus::Ok;
+    }
+
+    EStatus BinaryMappedFileInputStream::getPos(size_t& position) const
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+        position = m_pos;
+        return EStatus::Ok;
+    }
+
+    EStatus BinaryMappedFileInputStream::getState() const
+    {
+        return m_state;
+    }
+}
@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/PlatformAbstraction/Collections/IInputStream.h"
+#include "internal/Core/Utils/MemoryMappedFile.h"
+
+namespace ramses::internal
+{
+    /*
+     * Input stream reading from a memory mapped file (or range within a filedescriptor, see BinaryOffsetFileInputStream).
+     * Reads are plain copies from mapped memory, no system call or stdio buffering is involved.
+     * Every seek checks that the file was not truncated since it was mapped, see MemoryMappedFile.
+     *
+     * State is Error if file could not be mapped, in that case the filedescriptor is not taken over.
+     */
+    class BinaryMappedFileInputStream final : public IInputStream
+    {
+    public:
+        explicit BinaryMappedFileInputStream(std::string_view filename);
+        BinaryMappedFileInputStream(int fd, size_t offset, size_t length);
+
+        IInputStream& read(void* buffer, size_t size) override;
+
+        EStatus seek(int64_t numberOfBytesToSeek, Seek origin) override;
+        EStatus getPos(size_t& position) const override;
+
+        [[nodiscard]] EStatus getState() const override;
+
+    private:
+        MemoryMappedFile m_mappedFile;
+        EStatus m_state;
+        size_t m_pos = 0u;
+    };
+}
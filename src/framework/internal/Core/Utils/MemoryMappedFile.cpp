@@ -0,0 +1,172 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/MemoryMappedFile.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ramses::internal
+{
+    namespace
+    {
+#ifdef _WIN32
+        int OpenReadOnly(const std::string& filename)
+        {
+            return ::_open(filename.c_str(), _O_RDONLY | _O_BINARY);
+        }
+
+        void CloseFd(int fd)
+        {
+            ::_close(fd);
+        }
+
+        size_t GetMappingGranularity()
+        {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return info.dwAllocationGranularity;
+        }
+#else
+        int OpenReadOnly(const std::string& filename)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
+            return ::open(filename.c_str(), O_RDONLY);
+        }
+
+        void CloseFd(int fd)
+        {
+            ::close(fd);
+        }
+
+        size_t GetMappingGranularity()
+        {
+            return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+    }
+
+    MemoryMappedFile::MemoryMappedFile(std::string_view filename)
+    {
+        const int fd = OpenReadOnly(std::string{ filename });
+        if (fd < 0)
+            return;
+
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 || !map(fd, 0u, static_cast<size_t>(fileStat.st_size)))
+            CloseFd(fd);
+    }
+
+    MemoryMappedFile::MemoryMappedFile(int fd, size_t offset, size_t length)
+    {
+        if (fd < 0 || length == 0u)
+            return;
+
+        // mapping beyond end of file would fault on access instead of reporting an error on read
+        struct stat fileStat {};
+        if (fstat(fd, &fileStat) != 0 || offset + length > static_cast<size_t>(fileStat.st_size))
+            return;
+
+        map(fd, offset, length);
+    }
+
+    bool MemoryMappedFile::map(int fd, size_t offset, size_t length)
+    {
+        // mapping has to start at multiple of page size (allocation granularity on windows)
+        const size_t granularity = GetMappingGranularity();
+        const size_t mappingOffset = offset - offset % granularity;
+        const size_t mappingSize = length + (offset - mappingOffset);
+
+#ifdef _WIN32
+        // NOLINTNEXTLINE(performance-no-int-to-ptr) windows handle from CRT
+        const auto fileHandle = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return false;
+        HANDLE fileMapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (fileMapping == nullptr)
+            return false;
+        void* mapping = MapViewOfFile(fileMapping, FILE_MAP_READ, static_cast<DWORD>(static_cast<uint64_t>(mappingOffset) >> 32u),
+            static_cast<DWORD>(mappingOffset & 0xFFFFFFFFu), mappingSize);
+        // view keeps mapping object alive
+        CloseHandle(fileMapping);
+        if (mapping == nullptr)
+            return false;
+#else
+        void* mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(mappingOffset));
+        if (mapping == MAP_FAILED)
+        {
+            LOG_DEBUG(CONTEXT_FRAMEWORK, "MemoryMappedFile::map: mapping of fd {} failed, errno {}", fd, errno);
+            return false;
+        }
+        // content is read mostly in increasing file position order
+        madvise(mapping, mappingSize, MADV_SEQUENTIAL);
+#endif
+
+        m_fd = fd;
+        m_fileEnd = offset + length;
+        m_mapping = mapping;
+        m_mappingSize = mappingSize;
+        m_data = static_cast<const std::byte*>(mapping) + (offset - mappingOffset);
+        m_size = length;
+        return true;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (!m_mapping)
+            return;
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+#else
+        munmap(m_mapping, m_mappingSize);
+#endif
+        CloseFd(m_fd);
+    }
+
+    bool MemoryMappedFile::isValid() const
+    {
+        return m_data != nullptr;
+    }
+
+    const std::byte* MemoryMappedFile::data() const
+    {
+        return m_data;
+    }
+
+    size_t MemoryMappedFile::size() const
+    {
+        return m_size;
+    }
+
+    bool MemoryMappedFile::isFileComplete() const
+    {
+        if (!m_mapping)
+            return false;
+
+        struct stat fileStat {};
+        if (fstat(m_fd, &fileStat) != 0 || fileStat.st_size < 0 || static_cast<size_t>(fileStat.st_size) < m_fileEnd)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "MemoryMappedFile::isFileComplete: file of fd {} was truncated after mapping, expected at least {} bytes", m_fd, m_fileEnd);
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace ramses::internal
+{
+    /*
+     * Read only memory mapping of a whole file or of a range within an already open filedescriptor.
+     * Mapping stays valid until object is destroyed.
+     *
+     * The filedescriptor is closed (ownership taken) only if mapping succeeds, so that caller
+     * can fall back to regular file reading otherwise. It is kept open while mapped to check
+     * the file size: accessing mapped pages beyond the end of a file which was truncated after
+     * mapping raises SIGBUS instead of a read error, so callers check isFileComplete() before
+     * touching a range of pages. Truncation between the check and the access cannot be detected.
+     */
+    class MemoryMappedFile final
+    {
+    public:
+        explicit MemoryMappedFile(std::string_view filename);
+        MemoryMappedFile(int fd, size_t offset, size_t length);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        [[nodiscard]] bool isValid() const;
+        [[nodiscard]] const std::byte* data() const;
+        [[nodiscard]] size_t size() const;
+        // false if file is now smaller than mapped range
+        [[nodiscard]] bool isFileComplete() const;
+
+    private:
+        bool map(int fd, size_t offset, size_t length);
+
+        int m_fd = -1;
+        size_t m_fileEnd = 0u;
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0u;
+        const std::byte* m_data = nullptr;
+        size_t m_size = 0u;
+    };
+}
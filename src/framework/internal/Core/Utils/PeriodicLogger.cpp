@@ -155,6 +155,26 @@ namespace ramses::internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileNumber.getSummary(), numberTimeIntervals);
                     output << " resFS ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileSize.getSummary(), numberTimeIntervals);
+                    output << " sockW ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statSocketWrites.getSummary(), numberTimeIntervals);
+                    const uint32_t numWrites = m_statisticCollection.statSocketWrites.getSummary().sum;
+                    if (numWrites > 0u)
+                    {
+                        output << " msgPerW " << static_cast<float>(m_statisticCollection.statSocketWriteMessages.getSummary().sum) / static_cast<float>(numWrites);
+                        output << " bytesPerW " << m_statisticCollection.statSocketWriteBytes.getSummary().sum / numWrites;
+                    }
+                    static const std::array<const char*, ESendLaneStatisticIndex_NumIndices> laneNames = { "ctrl", "scene", "bulk" };
+                    for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+                    {
+                        const uint32_t numLaneMessages = m_statisticCollection.statSendLaneMessages[lane].getSummary().sum;
+                        if (numLaneMessages > 0u)
+                        {
+                            output << " " << laneNames[lane] << " msg " << numLaneMessages;
+                            output << " qMax " << m_statisticCollection.statSendLaneMaxQueueDepth[lane].getSummary().maxValue;
+                            output << " latUs " << m_statisticCollection.statSendLaneLatencySumUs[lane].getSummary().sum / numLaneMessages;
+                            output << "/" << m_statisticCollection.statSendLaneMaxLatencyUs[lane].getSummary().maxValue;
+                        }
+                    }
         }));
 
         m_statisticCollection.resetSummaries();
@@ -178,6 +198,8 @@ namespace ramses::internal
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsGenerated.getSummary(), numberTimeIntervals);
                             output << " actGS ";
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsGeneratedSize.getSummary(), numberTimeIntervals);
+                            output << " actC ";
+                            logStatisticSummaryEntry(output, entry.value->statSceneActionsCoalesced.getSummary(), numberTimeIntervals);
                             output << " actO ";
                             logStatisticSummaryEntry(output, entry.value->statSceneActionsSent.getSummary(), numberTimeIntervals);
                             output << " actSkp ";
@@ -42,6 +42,17 @@ namespace ramses::internal
         statResourcesNumber.reset();
         statResourcesLoadedFromFileNumber.reset();
         statResourcesLoadedFromFileSize.reset();
+        statSocketWrites.reset();
+        statSocketWriteMessages.reset();
+        statSocketWriteBytes.reset();
+
+        for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+        {
+            statSendLaneMessages[lane].reset();
+            statSendLaneLatencySumUs[lane].reset();
+            statSendLaneMaxLatencyUs[lane].reset();
+            statSendLaneMaxQueueDepth[lane].reset();
+        }
     }
 
     void StatisticCollectionFramework::resetSummaries()
@@ -55,6 +66,17 @@ namespace ramses::internal
         statResourcesNumber.getSummary().reset();
         statResourcesLoadedFromFileNumber.getSummary().reset();
         statResourcesLoadedFromFileSize.getSummary().reset();
+        statSocketWrites.getSummary().reset();
+        statSocketWriteMessages.getSummary().reset();
+        statSocketWriteBytes.getSummary().reset();
+
+        for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+        {
+            statSendLaneMessages[lane].getSummary().reset();
+            statSendLaneLatencySumUs[lane].getSummary().reset();
+            statSendLaneMaxLatencyUs[lane].getSummary().reset();
+            statSendLaneMaxQueueDepth[lane].getSummary().reset();
+        }
     }
 
     void StatisticCollectionFramework::nextTimeInterval()
@@ -67,6 +89,17 @@ namespace ramses::internal
         const uint32_t resourcesDestroyed = statResourcesDestroyed.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileNumber.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileSize.updateSummaryAndResetCounter();
+        statSocketWrites.updateSummaryAndResetCounter();
+        statSocketWriteMessages.updateSummaryAndResetCounter();
+        statSocketWriteBytes.updateSummaryAndResetCounter();
+
+        for (size_t lane = 0; lane < ESendLaneStatisticIndex_NumIndices; lane++)
+        {
+            statSendLaneMessages[lane].updateSummaryAndResetCounter();
+            statSendLaneLatencySumUs[lane].updateSummaryAndResetCounter();
+            statSendLaneMaxLatencyUs[lane].updateSummaryAndResetCounter();
+            statSendLaneMaxQueueDepth[lane].updateSummaryAndResetCounter();
+        }
 
         statResourcesNumber.incCounter(resourcesCreated);
         statResourcesNumber.decCounter(resourcesDestroyed);
@@ -85,6 +118,7 @@ namespace ramses::internal
         statSceneActionsSentSkipped.reset();
         statSceneActionsGenerated.reset();
         statSceneActionsGeneratedSize.reset();
+        statSceneActionsCoalesced.reset();
         statSceneUpdatesGeneratedPackets.reset();
         statSceneUpdatesGeneratedSize.reset();
         statMaximumSizeSingleSceneUpdate.reset();
@@ -109,6 +143,7 @@ namespace ramses::internal
         statSceneActionsSentSkipped.getSummary().reset();
         statSceneActionsGenerated.getSummary().reset();
         statSceneActionsGeneratedSize.getSummary().reset();
+        statSceneActionsCoalesced.getSummary().reset();
         statSceneUpdatesGeneratedPackets.getSummary().reset();
         statSceneUpdatesGeneratedSize.getSummary().reset();
         statMaximumSizeSingleSceneUpdate.getSummary().reset();
@@ -133,6 +168,7 @@ namespace ramses::internal
         statSceneActionsSentSkipped.updateSummaryAndResetCounter();
         statSceneActionsGenerated.updateSummaryAndResetCounter();
         statSceneActionsGeneratedSize.updateSummaryAndResetCounter();
+        statSceneActionsCoalesced.updateSummaryAndResetCounter();
         statSceneUpdatesGeneratedPackets.updateSummaryAndResetCounter();
         statSceneUpdatesGeneratedSize.updateSummaryAndResetCounter();
 
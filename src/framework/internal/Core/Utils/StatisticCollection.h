@@ -163,6 +163,15 @@ namespace ramses::internal
         uint32_t m_numberTimeIntervalsSinceLastSummaryReset{0u};
     };
 
+    enum ESendLaneStatisticIndex : std::size_t // deliberately not enum class, supposed to be implicitly convertible
+    {
+        ESendLaneStatisticIndex_Control,
+        ESendLaneStatisticIndex_SceneUpdate,
+        ESendLaneStatisticIndex_Bulk,
+
+        ESendLaneStatisticIndex_NumIndices
+    };
+
     class StatisticCollectionFramework : public StatisticCollection
     {
     public:
@@ -177,6 +186,15 @@ namespace ramses::internal
         StatisticEntry<uint32_t, SummaryEntry> statResourcesNumber; //updated by values of statResourcesCreated and statResourcesDestroyed
         StatisticEntry<uint32_t, SummaryEntry> statResourcesLoadedFromFileNumber;
         StatisticEntry<uint32_t, SummaryEntry> statResourcesLoadedFromFileSize;
+        StatisticEntry<uint32_t, SummaryEntry> statSocketWrites;
+        StatisticEntry<uint32_t, SummaryEntry> statSocketWriteMessages; // messages written with statSocketWrites, several per write when coalesced
+        StatisticEntry<uint64_t, SummaryEntry> statSocketWriteBytes;
+
+        // per send lane of connection system: messages written, their accumulated and maximum time in queue, maximum queue length
+        std::array<StatisticEntry<uint32_t, SummaryEntry>, ESendLaneStatisticIndex_NumIndices> statSendLaneMessages;
+        std::array<StatisticEntry<uint64_t, SummaryEntry>, ESendLaneStatisticIndex_NumIndices> statSendLaneLatencySumUs;
+        std::array<StatisticEntry<uint64_t, SummaryEntry>, ESendLaneStatisticIndex_NumIndices> statSendLaneMaxLatencyUs;
+        std::array<StatisticEntry<uint32_t, SummaryEntry>, ESendLaneStatisticIndex_NumIndices> statSendLaneMaxQueueDepth;
     };
 
     enum EResourceStatisticIndex : std::size_t // deliberately not enum class, supposed to be implicitly convertible
@@ -206,6 +224,7 @@ namespace ramses::internal
         StatisticEntry<uint32_t, SummaryEntry> statSceneActionsSentSkipped;
         StatisticEntry<uint32_t, SummaryEntry> statSceneActionsGenerated;
         StatisticEntry<uint32_t, SummaryEntry> statSceneActionsGeneratedSize;
+        StatisticEntry<uint32_t, SummaryEntry> statSceneActionsCoalesced;
         StatisticEntry<uint32_t, SummaryEntry> statSceneUpdatesGeneratedPackets;
         StatisticEntry<uint32_t, SummaryEntry> statSceneUpdatesGeneratedSize;
         StatisticEntry<uint64_t, FirstFiveElements> statMaximumSizeSingleSceneUpdate;
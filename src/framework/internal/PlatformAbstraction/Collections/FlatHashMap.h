@@ -0,0 +1,623 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/PlatformAbstraction/PlatformError.h"
+#include "internal/PlatformAbstraction/Hash.h"
+#include "internal/PlatformAbstraction/Macros.h"
+#include "internal/Core/Utils/AssertMovable.h"
+
+#include <cstdint>
+#include <cassert>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace ramses::internal
+{
+    /**
+     * Open addressing hash table with the same interface as HashMap.
+     *
+     * Key/value pairs are stored densely in a vector and referenced from a power of two sized bucket
+     * array which is probed linearly using robin hood hashing. Every bucket stores the probe distance
+     * and a fingerprint of the hash, so most mismatches are rejected without touching the key itself.
+     * Lookups, inserts and iteration therefore mostly run over contiguous memory.
+     *
+     * Differences to HashMap:
+     *  - removing an element moves the last element into its place, i.e. it invalidates pointers, references
+     *    and iterators to the last element (and remove(Iterator) returns the same position, which then holds
+     *    the moved element or end())
+     *  - growing invalidates all pointers, references and iterators (as with HashMap)
+     *  - a default constructed map does not allocate memory
+     */
+    template <class Key, class T>
+    class FlatHashMap final
+    {
+    public:
+        /// defines the maximum ratio of elements to buckets after which the table is grown
+        static constexpr double MaxLoadFactor = 0.8;
+
+        /// bucket count allocated on first insertion
+        static constexpr size_t InitialBucketCount = 16u;
+
+        class Pair final
+        {
+        public:
+            Pair(Key key_, T value_)
+                : key(std::move(key_))
+                , value(std::move(value_))
+            {
+            }
+
+            // not const to allow moving pairs within the storage, must not be modified by user
+            Key key;
+            T value;
+        };
+
+        class ConstIterator final
+        {
+        public:
+            friend class FlatHashMap;
+
+            explicit ConstIterator(const Pair* pair)
+                : m_pair(pair)
+            {
+            }
+
+            const Pair& operator*() const
+            {
+                return *m_pair;
+            }
+
+            const Pair* operator->() const
+            {
+                return m_pair;
+            }
+
+            bool operator==(const ConstIterator& iter) const
+            {
+                return m_pair == iter.m_pair;
+            }
+
+            bool operator!=(const ConstIterator& iter) const
+            {
+                return m_pair != iter.m_pair;
+            }
+
+            ConstIterator& operator++()
+            {
+                ++m_pair;
+                return *this;
+            }
+
+            const ConstIterator operator++(int32_t)
+            {
+                ConstIterator oldValue(*this);
+                ++m_pair;
+                return oldValue;
+            }
+
+        private:
+            const Pair* m_pair;
+        };
+
+        class Iterator final
+        {
+        public:
+            friend class FlatHashMap;
+
+            explicit Iterator(Pair* pair)
+                : m_pair(pair)
+            {
+            }
+
+            /**
+             * Convert Constructor
+             * @param iter ConstIterator to convert from
+             */
+            Iterator(const ConstIterator& iter)  // NOLINT(google-explicit-constructor) const to non-const iterator should be implicit
+                : m_pair(const_cast<Pair*>(iter.m_pair))
+            {
+            }
+
+            Pair& operator*()
+            {
+                return *m_pair;
+            }
+
+            const Pair& operator*() const
+            {
+                return *m_pair;
+            }
+
+            Pair* operator->()
+            {
+                return m_pair;
+            }
+
+            const Pair* operator->() const
+            {
+                return m_pair;
+            }
+
+            bool operator==(const Iterator& iter) const
+            {
+                return m_pair == iter.m_pair;
+            }
+
+            bool operator!=(const Iterator& iter) const
+            {
+                return m_pair != iter.m_pair;
+            }
+
+            Iterator& operator++()
+            {
+                ++m_pair;
+                return *this;
+            }
+
+            const Iterator operator++(int32_t)
+            {
+                Iterator oldValue(*this);
+                ++m_pair;
+                return oldValue;
+            }
+
+        private:
+            Pair* m_pair;
+        };
+
+        FlatHashMap() = default;
+        FlatHashMap(const FlatHashMap& other) = default;
+        FlatHashMap(FlatHashMap&& other) noexcept;
+
+        /**
+         * Constructor.
+         * Allocates enough buckets to insert given number of elements without growing.
+         */
+        explicit FlatHashMap(size_t minimumCapacity);
+
+        ~FlatHashMap() = default;
+
+        FlatHashMap& operator=(const FlatHashMap& other) = default;
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept;
+
+        /**
+         * overloading subscript operator to get read and write access to element referenced by given key.
+         *
+         * @param key Key value
+         * @return value Value referenced by key. If no value is stored for given key, a default constructed object is added and returned
+         */
+        T& operator[](const Key& key);
+
+        /**
+         * Inserts a new key/value pair or overwrites value of an existing key.
+         * @return iterator to the inserted or updated element
+         */
+        Iterator put(const Key& key, const T& value);
+
+        EStatus get(const Key& key, T& value) const;
+        RNODISCARD T* get(const Key& key) const;
+
+        RNODISCARD Iterator find(const Key& key);
+        RNODISCARD ConstIterator find(const Key& key) const;
+        RNODISCARD bool contains(const Key& key) const;
+
+        /**
+         * Removes the value associated with key.
+         * Moves last element into the place of the removed one.
+         *
+         * @param key               Key value.
+         * @param value_old         Buffer which will be used to store value of removed element.
+         *                          Default value is nullptr to indicate that it should be discarded.
+         *
+         * @return true if remove is successful
+         *         false if the key was not found in the map.
+         */
+        bool remove(const Key& key, T* value_old = nullptr);
+
+        /**
+         * Remove the element where the iterator is pointing to.
+         * Moves last element into the place of the removed one.
+         * @param the iterator to the element to remove
+         * @param out parameter to the removed element
+         * @return iterator to the next element to visit (same position as removed element)
+         */
+        Iterator remove(Iterator iter, T* value_old = nullptr);
+
+        RNODISCARD size_t size() const;
+
+        /**
+         * Removes all elements, keeps allocated memory.
+         */
+        void clear();
+
+        RNODISCARD Iterator begin();
+        RNODISCARD ConstIterator begin() const;
+        RNODISCARD Iterator end();
+        RNODISCARD ConstIterator end() const;
+
+        /**
+         * Makes sure given number of elements can be stored without growing.
+         */
+        void reserve(size_t requestedCapacity);
+
+        /**
+         * @return number of elements which can be stored without growing
+         */
+        RNODISCARD size_t capacity() const;
+
+        void swap(FlatHashMap& other) noexcept;
+
+    private:
+        struct Bucket
+        {
+            // 0 marks an empty bucket, otherwise upper bits hold probe distance + 1, lower bits the fingerprint
+            uint32_t distAndFingerprint = 0u;
+            uint32_t valueIndex = 0u;
+        };
+
+        static constexpr uint32_t DistInc = 1u << 8u;
+        static constexpr size_t InvalidBucket = ~size_t{ 0u };
+
+        [[nodiscard]] static uint64_t CalcHash(const Key& key);
+        [[nodiscard]] static uint32_t DistAndFingerprintFromHash(uint64_t hash);
+        [[nodiscard]] static size_t BucketCountForCapacity(size_t capacity);
+        [[nodiscard]] size_t bucketIndexFromHash(uint64_t hash) const;
+        [[nodiscard]] size_t nextBucketIndex(size_t bucketIndex) const;
+        [[nodiscard]] size_t findBucket(const Key& key) const;
+        [[nodiscard]] size_t findBucketOfValue(uint32_t valueIndex) const;
+        void placeAndShiftUp(Bucket bucket, size_t bucketIndex);
+        void insertBucketForValue(uint32_t valueIndex);
+        void eraseBucket(size_t bucketIndex, T* value_old);
+        void rebuildBuckets(size_t bucketCount);
+
+        std::vector<Pair> m_values;
+        std::vector<Bucket> m_buckets;
+        size_t m_threshold = 0u;
+    };
+
+    template <class Key, class T>
+    inline void swap(FlatHashMap<Key, T>& first, FlatHashMap<Key, T>& second)
+    {
+        first.swap(second);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>::FlatHashMap(FlatHashMap&& other) noexcept
+    {
+        ASSERT_MOVABLE(FlatHashMap)
+        swap(other);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>::FlatHashMap(size_t minimumCapacity)
+    {
+        reserve(minimumCapacity);
+    }
+
+    template <class Key, class T>
+    inline FlatHashMap<Key, T>& FlatHashMap<Key, T>::operator=(FlatHashMap&& other) noexcept
+    {
+        if (&other == this)
+        {
+            // self assignment
+            return *this;
+        }
+        FlatHashMap tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    template <class Key, class T>
+    inline T& FlatHashMap<Key, T>::operator[](const Key& key)
+    {
+        const size_t bucketIndex = findBucket(key);
+        if (bucketIndex != InvalidBucket)
+            return m_values[m_buckets[bucketIndex].valueIndex].value;
+        return put(key, T{})->value;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::put(const Key& key, const T& value)
+    {
+        if (!m_buckets.empty())
+        {
+            const uint64_t hash = CalcHash(key);
+            uint32_t distAndFingerprint = DistAndFingerprintFromHash(hash);
+            size_t bucketIndex = bucketIndexFromHash(hash);
+
+            // robin hood invariant: an existing key cannot be stored behind a bucket with lower probe distance
+            while (distAndFingerprint <= m_buckets[bucketIndex].distAndFingerprint)
+            {
+                if (distAndFingerprint == m_buckets[bucketIndex].distAndFingerprint)
+                {
+                    Pair& pair = m_values[m_buckets[bucketIndex].valueIndex];
+                    if (pair.key == key)
+                    {
+                        pair.value = value;
+                        return Iterator(&pair);
+                    }
+                }
+                distAndFingerprint += DistInc;
+                bucketIndex = nextBucketIndex(bucketIndex);
+            }
+
+            if (m_values.size() < m_threshold)
+            {
+                m_values.emplace_back(key, value);
+                placeAndShiftUp({ distAndFingerprint, static_cast<uint32_t>(m_values.size() - 1u) }, bucketIndex);
+                return Iterator(&m_values.back());
+            }
+        }
+
+        // table is full (or not allocated yet), grow and insert into new buckets
+        m_values.emplace_back(key, value);
+        rebuildBuckets(m_buckets.empty() ? InitialBucketCount : m_buckets.size() * 2u);
+        return Iterator(&m_values.back());
+    }
+
+    template <class Key, class T>
+    inline EStatus FlatHashMap<Key, T>::get(const Key& key, T& value) const
+    {
+        const size_t bucketIndex = findBucket(key);
+        if (bucketIndex == InvalidBucket)
+            return EStatus::NotExist;
+        value = m_values[m_buckets[bucketIndex].valueIndex].value;
+        return EStatus::Ok;
+    }
+
+    template <class Key, class T>
+    inline T* FlatHashMap<Key, T>::get(const Key& key) const
+    {
+        const size_t bucketIndex = findBucket(key);
+        if (bucketIndex == InvalidBucket)
+            return nullptr;
+        // same constness semantics as HashMap::get
+        return const_cast<T*>(&m_values[m_buckets[bucketIndex].valueIndex].value);
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::find(const Key& key)
+    {
+        const size_t bucketIndex = findBucket(key);
+        if (bucketIndex == InvalidBucket)
+            return end();
+        return Iterator(m_values.data() + m_buckets[bucketIndex].valueIndex);
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::ConstIterator FlatHashMap<Key, T>::find(const Key& key) const
+    {
+        const size_t bucketIndex = findBucket(key);
+        if (bucketIndex == InvalidBucket)
+            return end();
+        return ConstIterator(m_values.data() + m_buckets[bucketIndex].valueIndex);
+    }
+
+    template <class Key, class T>
+    inline bool FlatHashMap<Key, T>::contains(const Key& key) const
+    {
+        return findBucket(key) != InvalidBucket;
+    }
+
+    template <class Key, class T>
+    inline bool FlatHashMap<Key, T>::remove(const Key& key, T* value_old)
+    {
+        const size_t bucketIndex = findBucket(key);
+        if (bucketIndex == InvalidBucket)
+            return false;
+        eraseBucket(bucketIndex, value_old);
+        return true;
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::remove(Iterator iter, T* value_old)
+    {
+        const auto valueIndex = static_cast<uint32_t>(iter.m_pair - m_values.data());
+        assert(valueIndex < m_values.size());
+        eraseBucket(findBucketOfValue(valueIndex), value_old);
+        return Iterator(m_values.data() + valueIndex);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::size() const
+    {
+        return m_values.size();
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::clear()
+    {
+        m_values.clear();
+        std::fill(m_buckets.begin(), m_buckets.end(), Bucket{});
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::begin()
+    {
+        return Iterator(m_values.data());
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::ConstIterator FlatHashMap<Key, T>::begin() const
+    {
+        return ConstIterator(m_values.data());
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::Iterator FlatHashMap<Key, T>::end()
+    {
+        return Iterator(m_values.data() + m_values.size());
+    }
+
+    template <class Key, class T>
+    inline typename FlatHashMap<Key, T>::ConstIterator FlatHashMap<Key, T>::end() const
+    {
+        return ConstIterator(m_values.data() + m_values.size());
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::reserve(size_t requestedCapacity)
+    {
+        if (requestedCapacity <= capacity())
+            return;
+
+        m_values.reserve(requestedCapacity);
+        rebuildBuckets(BucketCountForCapacity(requestedCapacity));
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::capacity() const
+    {
+        return m_threshold;
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::swap(FlatHashMap& other) noexcept
+    {
+        using std::swap;
+        swap(m_values, other.m_values);
+        swap(m_buckets, other.m_buckets);
+        swap(m_threshold, other.m_threshold);
+    }
+
+    template <class Key, class T>
+    inline uint64_t FlatHashMap<Key, T>::CalcHash(const Key& key)
+    {
+        size_t seed = 0u;
+        HashCombine(seed, key);
+        // bucket index is taken from lower bits, fold upper bits in to make use of all bits of wide hashes
+        // (e.g. ResourceContentHash) while keeping consecutive handles in consecutive buckets
+        auto hash = static_cast<uint64_t>(seed);
+        hash ^= hash >> 32u;
+        return hash;
+    }
+
+    template <class Key, class T>
+    inline uint32_t FlatHashMap<Key, T>::DistAndFingerprintFromHash(uint64_t hash)
+    {
+        // fingerprint must not correlate with bucket index, derive it from mixed upper bits
+        return DistInc | static_cast<uint32_t>((hash * 0x9E3779B97F4A7C15ull) >> 56u);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::BucketCountForCapacity(size_t capacity)
+    {
+        size_t bucketCount = InitialBucketCount;
+        while (static_cast<size_t>(static_cast<double>(bucketCount) * MaxLoadFactor) < capacity)
+            bucketCount *= 2u;
+        return bucketCount;
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::bucketIndexFromHash(uint64_t hash) const
+    {
+        return static_cast<size_t>(hash) & (m_buckets.size() - 1u);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::nextBucketIndex(size_t bucketIndex) const
+    {
+        return (bucketIndex + 1u) & (m_buckets.size() - 1u);
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::findBucket(const Key& key) const
+    {
+        if (m_values.empty())
+            return InvalidBucket;
+
+        const uint64_t hash = CalcHash(key);
+        uint32_t distAndFingerprint = DistAndFingerprintFromHash(hash);
+        size_t bucketIndex = bucketIndexFromHash(hash);
+        while (distAndFingerprint <= m_buckets[bucketIndex].distAndFingerprint)
+        {
+            if (distAndFingerprint == m_buckets[bucketIndex].distAndFingerprint && m_values[m_buckets[bucketIndex].valueIndex].key == key)
+                return bucketIndex;
+            distAndFingerprint += DistInc;
+            bucketIndex = nextBucketIndex(bucketIndex);
+        }
+        return InvalidBucket;
+    }
+
+    template <class Key, class T>
+    inline size_t FlatHashMap<Key, T>::findBucketOfValue(uint32_t valueIndex) const
+    {
+        size_t bucketIndex = bucketIndexFromHash(CalcHash(m_values[valueIndex].key));
+        while (m_buckets[bucketIndex].valueIndex != valueIndex || m_buckets[bucketIndex].distAndFingerprint == 0u)
+            bucketIndex = nextBucketIndex(bucketIndex);
+        return bucketIndex;
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::placeAndShiftUp(Bucket bucket, size_t bucketIndex)
+    {
+        // displaced buckets move one step further from their ideal position
+        while (m_buckets[bucketIndex].distAndFingerprint != 0u)
+        {
+            std::swap(bucket, m_buckets[bucketIndex]);
+            bucket.distAndFingerprint += DistInc;
+            bucketIndex = nextBucketIndex(bucketIndex);
+        }
+        m_buckets[bucketIndex] = bucket;
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::insertBucketForValue(uint32_t valueIndex)
+    {
+        const uint64_t hash = CalcHash(m_values[valueIndex].key);
+        uint32_t distAndFingerprint = DistAndFingerprintFromHash(hash);
+        size_t bucketIndex = bucketIndexFromHash(hash);
+        while (distAndFingerprint < m_buckets[bucketIndex].distAndFingerprint)
+        {
+            distAndFingerprint += DistInc;
+            bucketIndex = nextBucketIndex(bucketIndex);
+        }
+        placeAndShiftUp({ distAndFingerprint, valueIndex }, bucketIndex);
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::eraseBucket(size_t bucketIndex, T* value_old)
+    {
+        const uint32_t valueIndex = m_buckets[bucketIndex].valueIndex;
+        if (value_old)
+            *value_old = std::move(m_values[valueIndex].value);
+
+        // backward shift deletion, following buckets which are not at their ideal position move one step back
+        size_t nextIndex = nextBucketIndex(bucketIndex);
+        while (m_buckets[nextIndex].distAndFingerprint >= 2u * DistInc)
+        {
+            m_buckets[bucketIndex] = { m_buckets[nextIndex].distAndFingerprint - DistInc, m_buckets[nextIndex].valueIndex };
+            bucketIndex = nextIndex;
+            nextIndex = nextBucketIndex(nextIndex);
+        }
+        m_buckets[bucketIndex] = {};
+
+        // keep values dense by moving last value into the freed slot
+        const auto lastIndex = static_cast<uint32_t>(m_values.size() - 1u);
+        if (valueIndex != lastIndex)
+        {
+            m_buckets[findBucketOfValue(lastIndex)].valueIndex = valueIndex;
+            m_values[valueIndex] = std::move(m_values.back());
+        }
+        m_values.pop_back();
+    }
+
+    template <class Key, class T>
+    inline void FlatHashMap<Key, T>::rebuildBuckets(size_t bucketCount)
+    {
+        assert(bucketCount >= InitialBucketCount && (bucketCount & (bucketCount - 1u)) == 0u);
+        m_buckets.assign(bucketCount, Bucket{});
+        m_threshold = static_cast<size_t>(static_cast<double>(bucketCount) * MaxLoadFactor);
+
+        for (uint32_t valueIndex = 0u; valueIndex < static_cast<uint32_t>(m_values.size()); ++valueIndex)
+            insertBucketForValue(valueIndex);
+    }
+}
@@ -16,6 +16,7 @@
 namespace ramses::internal
 {
     class IOutputStream;
+    class WorkerThreadPool;
 
     class IResource
     {
@@ -47,7 +48,11 @@ namespace ramses::internal
         [[nodiscard]] virtual EResourceType getTypeID() const = 0;
         [[nodiscard]] virtual const ResourceContentHash& getHash() const = 0;
         virtual void compress(CompressionLevel level) const = 0;
+        // large resources are compressed concurrently using given thread pool, must not be called from a task of that pool
+        virtual void compress(CompressionLevel level, WorkerThreadPool& threadPool) const = 0;
         virtual void decompress() const = 0;
+        // large resources are decompressed concurrently using given thread pool, must not be called from a task of that pool
+        virtual void decompress(WorkerThreadPool& threadPool) const = 0;
         [[nodiscard]] virtual bool isCompressedAvailable() const = 0;
         [[nodiscard]] virtual bool isDeCompressedAvailable() const = 0;
         [[nodiscard]] virtual const std::string& getName() const = 0;
@@ -7,67 +7,286 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
 #include "lz4.h"
 #include "lz4hc.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstring>
 
 namespace ramses::internal
 {
     namespace LZ4CompressionUtils
     {
-        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level)
+        namespace
         {
-            const int plainSize = static_cast<int>(plainBuffer.size());
-            if (plainSize == 0)
-                return CompressedResourceBlob();
+            constexpr std::array<std::byte, 4> BlockFormatMagic{ std::byte{ 0x00 }, std::byte{ 'L' }, std::byte{ 'Z' }, std::byte{ 'B' } };
+            constexpr size_t BlockIndexFixedSize = BlockFormatMagic.size() + 2u * sizeof(uint32_t);
 
-            CompressedResourceBlob compressedBuffer(LZ4_compressBound(plainSize));
-            int realCompressedSize = 0;
+            void WriteUInt32(std::byte* dst, uint32_t value)
+            {
+                std::memcpy(dst, &value, sizeof(value));
+            }
 
-            if (level == CompressionLevel::Fast)
+            uint32_t ReadUInt32(const std::byte* src)
             {
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                realCompressedSize = LZ4_compress_default(reinterpret_cast<const char*>(plainBuffer.data()),
-                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                    reinterpret_cast<char*>(compressedBuffer.data()),
-                    plainSize,
-                    static_cast<int>(compressedBuffer.size()));
+                uint32_t value = 0u;
+                std::memcpy(&value, src, sizeof(value));
+                return value;
             }
-            else
+
+            int CompressBlock(const std::byte* plainData, int plainSize, std::byte* compressedData, int compressedCapacity, CompressionLevel level)
             {
+                if (level == CompressionLevel::Fast)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                    return LZ4_compress_default(reinterpret_cast<const char*>(plainData),
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                        reinterpret_cast<char*>(compressedData),
+                        plainSize,
+                        compressedCapacity);
+                }
+
                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                realCompressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(plainBuffer.data()),
+                return LZ4_compress_HC(reinterpret_cast<const char*>(plainData),
                     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                    reinterpret_cast<char*>(compressedBuffer.data()),
+                    reinterpret_cast<char*>(compressedData),
                     plainSize,
-                    static_cast<int>(compressedBuffer.size()),
+                    compressedCapacity,
                     // using higher compression causes too excessive times to be able to use
                     LZ4HC_CLEVEL_DEFAULT);
             }
 
-            if (realCompressedSize <= 0)
-                return CompressedResourceBlob();
+            ResourceBlob DecompressData(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize, WorkerThreadPool* threadPool)
+            {
+                if ((compressedData.size() == 0u) || (uncompressedSize == 0u))
+                    return ResourceBlob();
+
+                ResourceBlob plainBuffer(uncompressedSize);
+                const absl::Span<const std::byte> compressedSpan = compressedData.span();
+                if (!isBlockFormat(compressedSpan))
+                {
+                    if (!decompressBlock(compressedSpan, { plainBuffer.data(), plainBuffer.size() }))
+                        return ResourceBlob();
+                    return plainBuffer;
+                }
+
+                BlockIndex index;
+                if (!readBlockIndex(compressedSpan, uncompressedSize, index))
+                    return ResourceBlob();
+
+                // offsets of all blocks are needed upfront to decompress them in any order
+                const size_t blockCount = index.compressedBlockSizes.size();
+                std::vector<size_t> compressedOffsets(blockCount);
+                size_t compressedOffset = index.dataOffset;
+                for (size_t i = 0u; i < blockCount; ++i)
+                {
+                    compressedOffsets[i] = compressedOffset;
+                    compressedOffset += index.compressedBlockSizes[i];
+                }
+                if (compressedOffset > compressedSpan.size())
+                    return ResourceBlob();
+
+                std::atomic<bool> failed{ false };
+                const auto decompressBlockAtIndex = [&](size_t i) {
+                    const size_t plainOffset = i * index.blockSize;
+                    const size_t blockPlainSize = std::min<size_t>(index.blockSize, uncompressedSize - plainOffset);
+                    if (!decompressBlock(compressedSpan.subspan(compressedOffsets[i], index.compressedBlockSizes[i]), { plainBuffer.data() + plainOffset, blockPlainSize }))
+                        failed = true;
+                };
+
+                if (threadPool)
+                {
+                    threadPool->execute(blockCount, decompressBlockAtIndex);
+                }
+                else
+                {
+                    for (size_t i = 0u; i < blockCount && !failed; ++i)
+                        decompressBlockAtIndex(i);
+                }
+
+                if (failed)
+                    return ResourceBlob();
+                return plainBuffer;
+            }
+
+            CompressedResourceBlob CompressData(const ResourceBlob& plainBuffer, CompressionLevel level, BlockFormat blockFormat, WorkerThreadPool* threadPool)
+            {
+                const size_t plainSize = plainBuffer.size();
+                if (plainSize == 0)
+                    return CompressedResourceBlob();
+
+                if (plainSize <= BlockSize || blockFormat == BlockFormat::Disabled)
+                {
+                    CompressedResourceBlob compressedBuffer(LZ4_compressBound(static_cast<int>(plainSize)));
+                    const int realCompressedSize = CompressBlock(plainBuffer.data(), static_cast<int>(plainSize), compressedBuffer.data(), static_cast<int>(compressedBuffer.size()), level);
+                    if (realCompressedSize <= 0)
+                        return CompressedResourceBlob();
+
+                    // compressedBuffer size might be too large, create properly sized result
+                    return CompressedResourceBlob(realCompressedSize, std::move(compressedBuffer));
+                }
+
+                const auto blockCount = static_cast<uint32_t>((plainSize + BlockSize - 1u) / BlockSize);
+                const size_t indexSize = BlockIndexFixedSize + blockCount * sizeof(uint32_t);
+                const auto blockCompressBound = static_cast<size_t>(LZ4_compressBound(static_cast<int>(BlockSize)));
+                // every block is compressed into own slot of maximum compressed size, so blocks can be compressed in any order
+                CompressedResourceBlob compressedBuffer(indexSize + static_cast<size_t>(blockCount) * blockCompressBound);
+                std::byte* out = compressedBuffer.data();
+
+                std::vector<int> compressedBlockSizes(blockCount, 0);
+                const auto compressBlockAtIndex = [&](size_t i) {
+                    const size_t plainOffset = i * BlockSize;
+                    const auto blockPlainSize = static_cast<int>(std::min<size_t>(BlockSize, plainSize - plainOffset));
+                    compressedBlockSizes[i] = CompressBlock(plainBuffer.data() + plainOffset, blockPlainSize, out + indexSize + i * blockCompressBound, static_cast<int>(blockCompressBound), level);
+                };
+
+                if (threadPool)
+                {
+                    threadPool->execute(blockCount, compressBlockAtIndex);
+                }
+                else
+                {
+                    for (size_t i = 0u; i < blockCount; ++i)
+                        compressBlockAtIndex(i);
+                }
+
+                std::memcpy(out, BlockFormatMagic.data(), BlockFormatMagic.size());
+                WriteUInt32(out + BlockFormatMagic.size(), BlockSize);
+                WriteUInt32(out + BlockFormatMagic.size() + sizeof(uint32_t), blockCount);
+
+                // move blocks from their slots right behind each other, compacted position never lies behind slot
+                size_t compressedOffset = indexSize;
+                for (uint32_t i = 0u; i < blockCount; ++i)
+                {
+                    const int compressedBlockSize = compressedBlockSizes[i];
+                    if (compressedBlockSize <= 0)
+                        return CompressedResourceBlob();
+
+                    WriteUInt32(out + BlockIndexFixedSize + i * sizeof(uint32_t), static_cast<uint32_t>(compressedBlockSize));
+                    std::memmove(out + compressedOffset, out + indexSize + i * blockCompressBound, static_cast<size_t>(compressedBlockSize));
+                    compressedOffset += static_cast<size_t>(compressedBlockSize);
+                }
 
-            // compressedBuffer size might be too large, create properly sized result
-            return CompressedResourceBlob(realCompressedSize, std::move(compressedBuffer));
+                // compressedBuffer size might be too large, create properly sized result
+                return CompressedResourceBlob(compressedOffset, std::move(compressedBuffer));
+            }
+        }
+
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level, BlockFormat blockFormat)
+        {
+            return CompressData(plainBuffer, level, blockFormat, nullptr);
+        }
+
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level, BlockFormat blockFormat, WorkerThreadPool& threadPool)
+        {
+            return CompressData(plainBuffer, level, blockFormat, &threadPool);
         }
 
         ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize)
         {
-            if ((compressedData.size() == 0u) || (uncompressedSize == 0u))
-                return ResourceBlob();
+            return DecompressData(compressedData, uncompressedSize, nullptr);
+        }
+
+        ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize, WorkerThreadPool& threadPool)
+        {
+            return DecompressData(compressedData, uncompressedSize, &threadPool);
+        }
+
+        bool isBlockFormat(absl::Span<const std::byte> compressedData)
+        {
+            return compressedData.size() >= BlockFormatMagic.size() &&
+                std::equal(BlockFormatMagic.cbegin(), BlockFormatMagic.cend(), compressedData.cbegin());
+        }
+
+        bool readBlockIndex(absl::Span<const std::byte> compressedData, uint32_t uncompressedSize, BlockIndex& index)
+        {
+            if (!isBlockFormat(compressedData) || compressedData.size() < BlockIndexFixedSize)
+                return false;
+
+            const uint32_t blockSize = ReadUInt32(compressedData.data() + BlockFormatMagic.size());
+            const uint32_t blockCount = ReadUInt32(compressedData.data() + BlockFormatMagic.size() + sizeof(uint32_t));
+            if (blockSize == 0u || blockCount != (static_cast<uint64_t>(uncompressedSize) + blockSize - 1u) / blockSize)
+                return false;
 
-            ResourceBlob plainBuffer(uncompressedSize);
+            const size_t dataOffset = BlockIndexFixedSize + static_cast<size_t>(blockCount) * sizeof(uint32_t);
+            if (compressedData.size() < dataOffset)
+                return false;
+
+            index.blockSize = blockSize;
+            index.dataOffset = dataOffset;
+            index.compressedBlockSizes.resize(blockCount);
+            for (uint32_t i = 0u; i < blockCount; ++i)
+                index.compressedBlockSizes[i] = ReadUInt32(compressedData.data() + BlockIndexFixedSize + i * sizeof(uint32_t));
+
+            return true;
+        }
+
+        bool decompressBlock(absl::Span<const std::byte> compressedBlock, absl::Span<std::byte> plainBlock)
+        {
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-            int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.data()),
-                                                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                                                        reinterpret_cast<char*>(plainBuffer.data()),
-                                                        static_cast<int>(compressedData.size()),
-                                                        static_cast<int>(plainBuffer.size()));
+            const int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedBlock.data()),
+                                                              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                                                              reinterpret_cast<char*>(plainBlock.data()),
+                                                              static_cast<int>(compressedBlock.size()),
+                                                              static_cast<int>(plainBlock.size()));
+
+            return bytesDecompressed == static_cast<int>(plainBlock.size());
+        }
+
+        IncrementalDecompressor::IncrementalDecompressor(uint32_t uncompressedSize)
+            : m_uncompressedSize(uncompressedSize)
+        {
+        }
+
+        bool IncrementalDecompressor::update(absl::Span<const std::byte> compressedData)
+        {
+            if (!m_hasIndex)
+            {
+                const size_t receivedMagicSize = std::min(compressedData.size(), BlockFormatMagic.size());
+                if (!std::equal(BlockFormatMagic.cbegin(), BlockFormatMagic.cbegin() + receivedMagicSize, compressedData.cbegin()))
+                    return false;
 
-            if (bytesDecompressed != static_cast<int>(plainBuffer.size()))
-                return ResourceBlob();
+                // wait until fixed part of index and then sizes of all blocks arrived
+                if (compressedData.size() < BlockIndexFixedSize)
+                    return true;
+                const uint32_t blockCount = ReadUInt32(compressedData.data() + BlockFormatMagic.size() + sizeof(uint32_t));
+                if (compressedData.size() < BlockIndexFixedSize + static_cast<size_t>(blockCount) * sizeof(uint32_t))
+                    return true;
+
+                if (!readBlockIndex(compressedData, m_uncompressedSize, m_index))
+                    return false;
+                m_hasIndex = true;
+                m_nextBlockOffset = m_index.dataOffset;
+                m_plainData = ResourceBlob(m_uncompressedSize);
+            }
+
+            while (m_nextBlock < m_index.compressedBlockSizes.size() &&
+                   m_nextBlockOffset + m_index.compressedBlockSizes[m_nextBlock] <= compressedData.size())
+            {
+                const size_t plainOffset = m_nextBlock * m_index.blockSize;
+                const size_t blockPlainSize = std::min<size_t>(m_index.blockSize, m_uncompressedSize - plainOffset);
+                if (!decompressBlock(compressedData.subspan(m_nextBlockOffset, m_index.compressedBlockSizes[m_nextBlock]), { m_plainData.data() + plainOffset, blockPlainSize }))
+                    return false;
 
-            return plainBuffer;
+                m_nextBlockOffset += m_index.compressedBlockSizes[m_nextBlock];
+                ++m_nextBlock;
+            }
+
+            return true;
+        }
+
+        bool IncrementalDecompressor::isFinished() const
+        {
+            return m_hasIndex && m_nextBlock == m_index.compressedBlockSizes.size();
+        }
+
+        ResourceBlob IncrementalDecompressor::release()
+        {
+            assert(isFinished());
+            return std::move(m_plainData);
         }
     }
 }
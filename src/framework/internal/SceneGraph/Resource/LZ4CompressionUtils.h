@@ -10,9 +10,13 @@
 
 #include "internal/PlatformAbstraction/Collections/HeapArray.h"
 #include "internal/SceneGraph/Resource/ResourceTypes.h"
+#include "absl/types/span.h"
+#include <vector>
 
 namespace ramses::internal
 {
+    class WorkerThreadPool;
+
     namespace LZ4CompressionUtils
     {
         enum class CompressionLevel : int
@@ -21,8 +25,64 @@ namespace ramses::internal
             High
         };
 
-        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level);
+        // Data larger than BlockSize is compressed in independent blocks, preceded by an index of their compressed sizes:
+        //   [magic][block size][block count][compressed size of each block][compressed blocks]
+        // Blocks can be compressed and decompressed concurrently, and decompressed one by one while data still arrives.
+        // Magic starts with a zero byte which can never be the first byte of a single LZ4 block (match without
+        // preceding literals), so data compressed as one block by older versions stays readable.
+        // Older runtimes of same major/minor version cannot read block format, so it must only be written where
+        // reader version is checked (transport protocol version), but not to files.
+        constexpr uint32_t BlockSize = 1024u * 1024u;
+
+        enum class BlockFormat
+        {
+            Disabled,
+            Enabled
+        };
+
+        struct BlockIndex
+        {
+            uint32_t blockSize = 0u;
+            std::vector<uint32_t> compressedBlockSizes;
+            // offset of first compressed block
+            size_t dataOffset = 0u;
+        };
+
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level, BlockFormat blockFormat);
+        // blocks of block format are compressed concurrently using given thread pool, result is identical to serial compression
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level, BlockFormat blockFormat, WorkerThreadPool& threadPool);
         ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize);
+        // blocks of block format are decompressed concurrently using given thread pool
+        ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize, WorkerThreadPool& threadPool);
+
+        [[nodiscard]] bool isBlockFormat(absl::Span<const std::byte> compressedData);
+        // fails if data does not contain (yet) a complete and consistent index for given uncompressed size
+        bool readBlockIndex(absl::Span<const std::byte> compressedData, uint32_t uncompressedSize, BlockIndex& index);
+        // plainBlock must have exactly the uncompressed size of the block
+        bool decompressBlock(absl::Span<const std::byte> compressedBlock, absl::Span<std::byte> plainBlock);
+
+        // Decompresses block format data block by block while it still arrives, so that only the last block
+        // remains to be decompressed when all data is there.
+        class IncrementalDecompressor
+        {
+        public:
+            explicit IncrementalDecompressor(uint32_t uncompressedSize);
+
+            // compressedData is all data received so far, decompresses every block completed since last call.
+            // Fails if data is not block format or is corrupted, data then has to be decompressed as a whole.
+            bool update(absl::Span<const std::byte> compressedData);
+            [[nodiscard]] bool isFinished() const;
+            // decompressed data, must only be taken once finished
+            ResourceBlob release();
+
+        private:
+            const uint32_t m_uncompressedSize;
+            BlockIndex m_index;
+            bool m_hasIndex = false;
+            size_t m_nextBlock = 0u;
+            size_t m_nextBlockOffset = 0u;
+            ResourceBlob m_plainData;
+        };
     }
 }
 
@@ -8,6 +8,7 @@
 
 #include "internal/SceneGraph/Resource/ResourceBase.h"
 #include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
 #include <city.h>
 
@@ -46,6 +47,16 @@ namespace ramses::internal
     }
 
     void ResourceBase::compress(CompressionLevel level) const
+    {
+        compressData(level, nullptr);
+    }
+
+    void ResourceBase::compress(CompressionLevel level, WorkerThreadPool& threadPool) const
+    {
+        compressData(level, &threadPool);
+    }
+
+    void ResourceBase::compressData(CompressionLevel level, WorkerThreadPool* threadPool) const
     {
         std::unique_lock<std::mutex> l(m_compressionLock);
         if (level > m_currentCompression &&
@@ -56,7 +67,13 @@ namespace ramses::internal
             const auto lz4Level = (level == CompressionLevel::Realtime) ?
                 LZ4CompressionUtils::CompressionLevel::Fast :
                 LZ4CompressionUtils::CompressionLevel::High;
-            m_compressedData = LZ4CompressionUtils::compress(m_data, lz4Level);
+            // files must stay readable by older runtimes of same version, block format only used for transport
+            const auto blockFormat = (level == CompressionLevel::Realtime) ?
+                LZ4CompressionUtils::BlockFormat::Enabled :
+                LZ4CompressionUtils::BlockFormat::Disabled;
+            m_compressedData = threadPool ?
+                LZ4CompressionUtils::compress(m_data, lz4Level, blockFormat, *threadPool) :
+                LZ4CompressionUtils::compress(m_data, lz4Level, blockFormat);
             m_currentCompression = level;
         }
     }
@@ -72,4 +89,16 @@ namespace ramses::internal
             m_data = LZ4CompressionUtils::decompress(m_compressedData, m_uncompressedSize);
         }
     }
+
+    void ResourceBase::decompress(WorkerThreadPool& threadPool) const
+    {
+        std::unique_lock<std::mutex> l(m_compressionLock);
+        if (!m_data.data())
+        {
+            assert(m_compressedData.data());
+            assert(m_compressedData.size());
+
+            m_data = LZ4CompressionUtils::decompress(m_compressedData, m_uncompressedSize, threadPool);
+        }
+    }
 }
@@ -96,8 +96,10 @@ namespace ramses::internal
         }
 
         void compress(CompressionLevel level) const final override;
+        void compress(CompressionLevel level, WorkerThreadPool& threadPool) const final override;
 
         void decompress() const final override;
+        void decompress(WorkerThreadPool& threadPool) const final override;
 
         bool isCompressedAvailable() const final override
         {
@@ -125,6 +127,8 @@ namespace ramses::internal
         void updateHash() const;
 
     private:
+        void compressData(CompressionLevel level, WorkerThreadPool* threadPool) const;
+
         const EResourceType m_typeID;
         mutable ResourceBlob m_data;
         mutable CompressedResourceBlob m_compressedData;
@@ -23,6 +23,12 @@ namespace ramses::internal
         m_creator.preallocateSceneSize(sizeInfo);
     }
 
+    void ActionCollectingScene::setTransformationUpdateMode(ETransformationUpdateMode mode)
+    {
+        ResourceChangeCollectingScene::setTransformationUpdateMode(mode);
+        m_creator.setTransformationUpdateMode(mode);
+    }
+
     void ActionCollectingScene::setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride)
     {
         ResourceChangeCollectingScene::setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
@@ -355,6 +361,12 @@ namespace ramses::internal
         m_creator.setRenderableStartVertex(renderableHandle, startVertex);
     }
 
+    void ActionCollectingScene::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        ResourceChangeCollectingScene::setRenderableBoundingBox(renderableHandle, boundingBox);
+        m_creator.setRenderableBoundingBox(renderableHandle, boundingBox);
+    }
+
     void ActionCollectingScene::setRenderableUniformsDataInstanceAndState(RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle)
     {
         ResourceChangeCollectingScene::setRenderableDataInstance(renderableHandle, ERenderableDataSlotType_Uniforms, newDataInstance);
@@ -470,6 +482,12 @@ namespace ramses::internal
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
+    void ActionCollectingScene::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        ResourceChangeCollectingScene::setRenderPassStateSorting(passHandle, enable);
+        m_creator.setRenderPassStateSorting(passHandle, enable);
+    }
+
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         ResourceChangeCollectingScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -20,6 +20,7 @@ namespace ramses::internal
         explicit ActionCollectingScene(const SceneInfo& sceneInfo = SceneInfo());
 
         void                        preallocateSceneSize            (const SceneSizeInformation& sizeInfo) override;
+        void                        setTransformationUpdateMode     (ETransformationUpdateMode mode) override;
 
         // Renderable allocation
         RenderableHandle            allocateRenderable              (NodeHandle nodeHandle, RenderableHandle handle) override;
@@ -33,6 +34,7 @@ namespace ramses::internal
         void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) override;
         void                        setRenderableUniformsDataInstanceAndState (RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle);
 
         // Render state
@@ -115,6 +117,7 @@ namespace ramses::internal
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
 
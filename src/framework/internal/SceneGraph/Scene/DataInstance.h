@@ -11,6 +11,8 @@
 #include "internal/SceneGraph/Scene/DataLayout.h"
 #include "internal/Core/Utils/AssertMovable.h"
 
+#include <vector>
+
 namespace ramses::internal
 {
     class DataInstance
@@ -20,12 +22,45 @@ namespace ramses::internal
 
         DataInstance(DataLayoutHandle dataLayoutHandle, uint32_t size)
             : m_dataLayoutHandle(dataLayoutHandle)
-            , m_data(size)
+            , m_ownedData(size)
+            , m_data(m_ownedData.data())
+            , m_size(size)
+        {
+        }
+
+        // data is stored in external memory (e.g. DataInstanceArena) which must outlive this instance,
+        // memory is expected to be initialized by caller
+        DataInstance(DataLayoutHandle dataLayoutHandle, uint32_t size, std::byte* externalData)
+            : m_dataLayoutHandle(dataLayoutHandle)
+            , m_data(externalData)
+            , m_size(size)
+            , m_hasExternalData(true)
         {
         }
 
-        DataInstance(const DataInstance&) = default;
-        DataInstance& operator=(const  DataInstance&) = default;
+        // copy always owns its data, also if copied from instance using external memory
+        DataInstance(const DataInstance& other)
+            : m_dataLayoutHandle(other.m_dataLayoutHandle)
+            , m_ownedData(other.m_data, other.m_data + other.m_size)
+            , m_data(m_ownedData.data())
+            , m_size(other.m_size)
+        {
+        }
+
+        DataInstance& operator=(const DataInstance& other)
+        {
+            if (this != &other)
+            {
+                m_dataLayoutHandle = other.m_dataLayoutHandle;
+                m_ownedData.assign(other.m_data, other.m_data + other.m_size);
+                m_data = m_ownedData.data();
+                m_size = other.m_size;
+                m_hasExternalData = false;
+            }
+            return *this;
+        }
+
+        // moving vector keeps its memory, data pointer stays valid
         DataInstance(DataInstance&&) noexcept = default;
         DataInstance& operator=(DataInstance&&) noexcept = default;
 
@@ -40,7 +75,7 @@ namespace ramses::internal
         void setTypedData(uint32_t fieldOffset, uint32_t elementCount, const DATATYPE* value)
         {
             const uint32_t fieldSizeInByte = sizeof(DATATYPE) * elementCount;
-            assert(fieldOffset + fieldSizeInByte <= m_data.size());
+            assert(fieldOffset + fieldSizeInByte <= m_size);
             void* dest = &m_data[fieldOffset];
             if (dest != value)
             {
@@ -53,9 +88,22 @@ namespace ramses::internal
             return m_dataLayoutHandle;
         }
 
+        [[nodiscard]] std::byte* getExternalData() const
+        {
+            return m_hasExternalData ? m_data : nullptr;
+        }
+
+        [[nodiscard]] uint32_t getSize() const
+        {
+            return m_size;
+        }
+
     private:
         DataLayoutHandle m_dataLayoutHandle;
-        std::vector<std::byte> m_data;
+        std::vector<std::byte> m_ownedData;
+        std::byte* m_data = nullptr;
+        uint32_t m_size = 0u;
+        bool m_hasExternalData = false;
     };
 
     ASSERT_MOVABLE(DataInstance)
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/DataInstanceArena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace ramses::internal
+{
+    DataInstanceArena::DataInstanceArena(size_t chunkSize)
+        : m_chunkSize(chunkSize)
+    {
+    }
+
+    std::byte* DataInstanceArena::allocate(uint32_t size)
+    {
+        const size_t alignedSize = GetAlignedSize(size);
+
+        auto freeIt = m_freeBlocks.find(alignedSize);
+        if (freeIt != m_freeBlocks.end() && !freeIt->second.empty())
+        {
+            std::byte* data = freeIt->second.back();
+            freeIt->second.pop_back();
+            std::memset(data, 0, alignedSize);
+            return data;
+        }
+
+        if (m_currentChunkUsed + alignedSize > m_currentChunkSize)
+        {
+            // payloads bigger than chunk get chunk of their own
+            m_currentChunkSize = std::max(m_chunkSize, alignedSize);
+            m_chunks.emplace_back(new std::byte[m_currentChunkSize]()); // NOLINT(modernize-avoid-c-arrays)
+            m_currentChunkUsed = 0u;
+        }
+
+        std::byte* data = m_chunks.back().get() + m_currentChunkUsed;
+        m_currentChunkUsed += alignedSize;
+        return data;
+    }
+
+    void DataInstanceArena::release(std::byte* data, uint32_t size)
+    {
+        assert(data != nullptr);
+        m_freeBlocks[GetAlignedSize(size)].push_back(data);
+    }
+
+    size_t DataInstanceArena::getChunkCount() const
+    {
+        return m_chunks.size();
+    }
+
+    size_t DataInstanceArena::GetAlignedSize(uint32_t size)
+    {
+        constexpr size_t alignment = alignof(std::max_align_t);
+        return std::max<size_t>((size + alignment - 1u) / alignment * alignment, alignment);
+    }
+}
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Packs data instance payloads into few large memory chunks instead of one heap block per instance,
+    // so that data of instances allocated together is also close together in memory.
+    // Chunks are never moved or freed before arena is destroyed, allocated memory keeps its address until released.
+    // Released memory is reused for allocations of same size (typically instances of same layout).
+    class DataInstanceArena
+    {
+    public:
+        static constexpr size_t DefaultChunkSize = 64u * 1024u;
+
+        explicit DataInstanceArena(size_t chunkSize = DefaultChunkSize);
+
+        // returns zero initialized memory of given size, suitably aligned for any scalar type
+        [[nodiscard]] std::byte* allocate(uint32_t size);
+        void release(std::byte* data, uint32_t size);
+
+        [[nodiscard]] size_t getChunkCount() const;
+
+    private:
+        [[nodiscard]] static size_t GetAlignedSize(uint32_t size);
+
+        const size_t m_chunkSize;
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks; // NOLINT(modernize-avoid-c-arrays)
+        size_t m_currentChunkUsed = 0u;
+        size_t m_currentChunkSize = 0u;
+        std::unordered_map<size_t, std::vector<std::byte*>> m_freeBlocks;
+    };
+}
@@ -10,7 +10,7 @@
 
 #include "internal/SceneGraph/Scene/ActionCollectingScene.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
-#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
 
 namespace ramses::internal
 {
@@ -36,7 +36,7 @@ namespace ramses::internal
         DataLayoutHandle findDataLayoutEntry(const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutCacheEntry*& entryOut);
 
         // Cache entries are stored in groups, each group has data layouts with same number of fields to speed up searching
-        using DataLayoutCacheGroup = HashMap<DataLayoutHandle, DataLayoutCacheEntry>;
+        using DataLayoutCacheGroup = FlatHashMap<DataLayoutHandle, DataLayoutCacheEntry>;
         std::vector<DataLayoutCacheGroup> m_dataLayoutCache;
     };
 }
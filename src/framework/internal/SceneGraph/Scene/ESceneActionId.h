@@ -190,6 +190,10 @@ namespace ramses::internal
         CompoundRenderableEffectData,
         CompoundState,
 
+        SetRenderableBoundingBox,
+        SetRenderPassStateSorting,
+        SetTransformationUpdateMode,
+
         Incomplete,
 
         NUMBER_OF_TYPES
@@ -380,6 +384,10 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::CompoundRenderableEffectData);
             CreateNameForEnumID(ESceneActionId::CompoundState);
 
+            CreateNameForEnumID(ESceneActionId::SetRenderableBoundingBox);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassStateSorting);
+            CreateNameForEnumID(ESceneActionId::SetTransformationUpdateMode);
+
             CreateNameForEnumID(ESceneActionId::Incomplete);
 
         case ESceneActionId::NUMBER_OF_TYPES:
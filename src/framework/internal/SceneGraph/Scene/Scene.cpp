@@ -31,6 +31,12 @@ namespace ramses::internal
         m_effectTimeSync = t;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setTransformationUpdateMode(ETransformationUpdateMode mode)
+    {
+        m_transformationUpdateMode = mode;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     RenderPassHandle SceneT<MEMORYPOOL>::allocateRenderPass(uint32_t renderGroupCount, RenderPassHandle handle)
     {
@@ -100,6 +106,12 @@ namespace ramses::internal
         // implemented on renderer side only in a derived scene
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isStateSortingEnabled = enable;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
@@ -636,6 +648,12 @@ namespace ramses::internal
         m_renderables.getMemory(renderableHandle)->startVertex = startVertex;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        m_renderables.getMemory(renderableHandle)->boundingBox = boundingBox;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     const Renderable& SceneT<MEMORYPOOL>::getRenderable(RenderableHandle renderableHandle) const
     {
@@ -884,7 +902,10 @@ namespace ramses::internal
 
         uint32_t dataInstanceSize = layout.getTotalSize();
         DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
-        *instance = DataInstance(layoutHandle, dataInstanceSize);
+        if (m_dataInstanceArena)
+            *instance = DataInstance(layoutHandle, dataInstanceSize, m_dataInstanceArena->allocate(dataInstanceSize));
+        else
+            *instance = DataInstance(layoutHandle, dataInstanceSize);
 
         // initialize data instance fields
         // TODO violin this can be generalized further, e.g. via templated static inplace contructor
@@ -931,10 +952,27 @@ namespace ramses::internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataInstance(DataInstanceHandle containerHandle)
     {
-        assert(isDataLayoutAllocated(m_dataInstanceMemory.getMemory(containerHandle)->getLayoutHandle()));
+        const DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
+        assert(isDataLayoutAllocated(instance->getLayoutHandle()));
+        // instances allocated before arena was enabled own their data
+        if (m_dataInstanceArena && instance->getExternalData() != nullptr)
+            m_dataInstanceArena->release(instance->getExternalData(), instance->getSize());
         m_dataInstanceMemory.release(containerHandle);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::enableDataInstanceArena()
+    {
+        if (!m_dataInstanceArena)
+            m_dataInstanceArena = std::make_unique<DataInstanceArena>();
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    const DataInstanceArena* SceneT<MEMORYPOOL>::getDataInstanceArena() const
+    {
+        return m_dataInstanceArena.get();
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataLayout(DataLayoutHandle layoutHandle)
     {
@@ -28,6 +28,7 @@
 #include "internal/SceneGraph/Scene/TopologyTransform.h"
 #include "internal/SceneGraph/Scene/DataLayout.h"
 #include "internal/SceneGraph/Scene/DataInstance.h"
+#include "internal/SceneGraph/Scene/DataInstanceArena.h"
 
 #include "internal/Core/Utils/MemoryPool.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
@@ -73,6 +74,9 @@ namespace ramses::internal
         void setEffectTimeSync(FlushTime::Clock::time_point t) override;
         [[nodiscard]] FlushTime::Clock::time_point getEffectTimeSync() const override;
 
+        void setTransformationUpdateMode(ETransformationUpdateMode mode) override;
+        [[nodiscard]] ETransformationUpdateMode getTransformationUpdateMode() const final override;
+
         // Renderables
         RenderableHandle            allocateRenderable              (NodeHandle nodeHandle, RenderableHandle handle) override;
         void                        releaseRenderable               (RenderableHandle renderableHandle) override;
@@ -85,6 +89,7 @@ namespace ramses::internal
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) override;
         [[nodiscard]] const Renderable& getRenderable               (RenderableHandle renderableHandle) const final override;
         [[nodiscard]] const RenderableMemoryPool& getRenderables    () const;
 
@@ -155,6 +160,9 @@ namespace ramses::internal
         [[nodiscard]] uint32_t      getDataInstanceCount            () const final override;
         [[nodiscard]] DataLayoutHandle getLayoutOfDataInstance      (DataInstanceHandle containerHandle) const final override;
         [[nodiscard]] const DataInstanceMemoryPool& getDataInstances() const;
+        // Data instances allocated after this call store their data in arena owned by scene instead of individual heap blocks
+        void enableDataInstanceArena();
+        [[nodiscard]] const DataInstanceArena* getDataInstanceArena() const;
 
         [[nodiscard]] const float*         getDataFloatArray            (DataInstanceHandle containerHandle, DataFieldHandle field) const final override;
         [[nodiscard]] const glm::vec2*     getDataVector2fArray         (DataInstanceHandle containerHandle, DataFieldHandle field) const final override;
@@ -248,6 +256,7 @@ namespace ramses::internal
         void                    setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                    setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                    retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                    setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                    addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                    removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         [[nodiscard]] const RenderPass& getRenderPass           (RenderPassHandle passHandle) const final override;
@@ -352,6 +361,7 @@ namespace ramses::internal
         TransformMemoryPool         m_transforms;
         DataLayoutMemoryPool        m_dataLayoutMemory;
         DataInstanceMemoryPool      m_dataInstanceMemory;
+        std::unique_ptr<DataInstanceArena> m_dataInstanceArena;
         RenderGroupMemoryPool       m_renderGroups;
         RenderPassMemoryPool        m_renderPasses;
         BlitPassMemoryPool          m_blitPasses;
@@ -368,6 +378,7 @@ namespace ramses::internal
         const SceneId               m_sceneId;
 
         FlushTime::Clock::time_point m_effectTimeSync;
+        ETransformationUpdateMode   m_transformationUpdateMode = ETransformationUpdateMode::Lazy;
     };
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -525,6 +536,12 @@ namespace ramses::internal
         return m_effectTimeSync;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    inline ETransformationUpdateMode SceneT<MEMORYPOOL>::getTransformationUpdateMode() const
+    {
+        return m_transformationUpdateMode;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     inline const DataLayout& SceneT<MEMORYPOOL>::getDataLayout(DataLayoutHandle layoutHandle) const
     {
@@ -416,6 +416,16 @@ namespace ramses::internal
             scene.setRenderableStartVertex(renderable, startVertex);
             break;
         }
+        case ESceneActionId::SetRenderableBoundingBox:
+        {
+            RenderableHandle renderable;
+            BoundingBox boundingBox;
+            action.read(renderable);
+            action.read(boundingBox.min);
+            action.read(boundingBox.max);
+            scene.setRenderableBoundingBox(renderable, boundingBox);
+            break;
+        }
         case ESceneActionId::AllocateRenderGroup:
         {
             uint32_t renderableCount = 0u;
@@ -729,6 +739,15 @@ namespace ramses::internal
             scene.retriggerRenderPassRenderOnce(passHandle);
             break;
         }
+        case ESceneActionId::SetRenderPassStateSorting:
+        {
+            RenderPassHandle passHandle;
+            bool enabled = false;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassStateSorting(passHandle, enabled);
+            break;
+        }
         case ESceneActionId::AddRenderGroupToRenderPass:
         {
             RenderPassHandle passHandle;
@@ -1130,6 +1149,13 @@ namespace ramses::internal
             scene.preallocateSceneSize(sizeInfos);
             break;
         }
+        case ESceneActionId::SetTransformationUpdateMode:
+        {
+            ETransformationUpdateMode mode = ETransformationUpdateMode::Lazy;
+            action.read(mode);
+            scene.setTransformationUpdateMode(mode);
+            break;
+        }
         case ESceneActionId::TestAction:
         {
             break;
@@ -28,9 +28,9 @@ namespace ramses::internal
         using ResourceVector = std::vector<std::unique_ptr<IResource>>;
 
         static void ApplyActionsOnScene(IScene& scene, const SceneActionCollection& actions);
+        static void ApplySingleActionOnScene(IScene& scene, SceneActionCollection::SceneActionReader& action);
 
     private:
         static void GetSceneSizeInformation(SceneActionCollection::SceneActionReader& action, SceneSizeInformation& sizeInfo);
-        static void ApplySingleActionOnScene(IScene& scene, SceneActionCollection::SceneActionReader& action);
     };
 }
@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include "internal/PlatformAbstraction/Hash.h"
+
+namespace ramses::internal
+{
+    bool SceneActionCoalescer::ActionTarget::operator==(const ActionTarget& other) const
+    {
+        return type == other.type && handle == other.handle && field == other.field && elementCount == other.elementCount;
+    }
+
+    size_t SceneActionCoalescer::ActionTargetHash::operator()(const ActionTarget& target) const
+    {
+        return HashValue(static_cast<uint32_t>(target.type), target.handle, target.field, target.elementCount);
+    }
+
+    uint32_t SceneActionCoalescer::coalesce(SceneActionCollection& actions)
+    {
+        const uint32_t numActions = actions.numberOfActions();
+        m_writtenTargets.clear();
+        m_keepAction.assign(numActions, true);
+
+        // walk backwards, any action targeting state which is set again later is redundant
+        uint32_t numRemoved = 0u;
+        ActionTarget target{};
+        for (uint32_t i = numActions; i > 0u; --i)
+        {
+            if (GetActionTarget(actions[i - 1u], target) && !m_writtenTargets.insert(target).second)
+            {
+                m_keepAction[i - 1u] = false;
+                ++numRemoved;
+            }
+        }
+
+        if (numRemoved == 0u)
+            return 0u;
+
+        m_coalescedActions.clear();
+        m_coalescedActions.reserveAdditionalCapacity(actions.collectionData().size(), numActions - numRemoved);
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            if (m_keepAction[i])
+            {
+                const auto action = actions[i];
+                m_coalescedActions.beginWriteSceneAction(action.type());
+                m_coalescedActions.appendRawData(action.data(), action.size());
+            }
+        }
+        // original collection stays in member, its memory is reused next time
+        actions.swap(m_coalescedActions);
+
+        return numRemoved;
+    }
+
+    bool SceneActionCoalescer::GetActionTarget(SceneActionCollection::SceneActionReader action, ActionTarget& target)
+    {
+        target = { action.type(), 0u, 0u, 0u };
+        switch (action.type())
+        {
+        case ESceneActionId::SetTranslation:
+        case ESceneActionId::SetRotation:
+        case ESceneActionId::SetScaling:
+        {
+            TransformHandle transform;
+            action.read(transform);
+            target.handle = transform.asMemoryHandle();
+            return true;
+        }
+        case ESceneActionId::SetRenderableVisibility:
+        {
+            RenderableHandle renderable;
+            action.read(renderable);
+            target.handle = renderable.asMemoryHandle();
+            return true;
+        }
+        case ESceneActionId::SetDataBooleanArray:
+        case ESceneActionId::SetDataIntegerArray:
+        case ESceneActionId::SetDataFloatArray:
+        case ESceneActionId::SetDataVector2fArray:
+        case ESceneActionId::SetDataVector3fArray:
+        case ESceneActionId::SetDataVector4fArray:
+        case ESceneActionId::SetDataVector2iArray:
+        case ESceneActionId::SetDataVector3iArray:
+        case ESceneActionId::SetDataVector4iArray:
+        case ESceneActionId::SetDataMatrix22fArray:
+        case ESceneActionId::SetDataMatrix33fArray:
+        case ESceneActionId::SetDataMatrix44fArray:
+        {
+            // later write overwrites earlier one only if it sets at least as many elements,
+            // element count is part of target so that only writes with same count are merged
+            DataInstanceHandle dataInstance;
+            DataFieldHandle field;
+            action.read(dataInstance);
+            action.read(field);
+            action.read(target.elementCount);
+            target.handle = dataInstance.asMemoryHandle();
+            target.field = field.asMemoryHandle();
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/Scene/SceneActionCollection.h"
+
+#include <unordered_set>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Removes scene actions which are overwritten by a later action in the same collection,
+    // e.g. multiple SetTranslation of same transform within one flush are reduced to the last one.
+    // Only actions which fully replace the state they set are removed (last write wins),
+    // the resulting collection applied on a scene produces same scene state as the original one.
+    class SceneActionCoalescer
+    {
+    public:
+        // returns number of actions removed from collection
+        uint32_t coalesce(SceneActionCollection& actions);
+
+    private:
+        struct ActionTarget
+        {
+            ESceneActionId type;
+            uint32_t handle;
+            uint32_t field;
+            uint32_t elementCount;
+
+            bool operator==(const ActionTarget& other) const;
+        };
+
+        struct ActionTargetHash
+        {
+            size_t operator()(const ActionTarget& target) const;
+        };
+
+        static bool GetActionTarget(SceneActionCollection::SceneActionReader action, ActionTarget& target);
+
+        // keep memory allocated between flushes
+        std::unordered_set<ActionTarget, ActionTargetHash> m_writtenTargets;
+        std::vector<bool> m_keepAction;
+        SceneActionCollection m_coalescedActions;
+    };
+}
@@ -36,6 +36,12 @@ namespace ramses::internal
         putSceneSizeInformation(sizeInfo);
     }
 
+    void SceneActionCollectionCreator::setTransformationUpdateMode(ETransformationUpdateMode mode)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetTransformationUpdateMode);
+        collection.write(mode);
+    }
+
     void SceneActionCollectionCreator::setTranslation(TransformHandle node, const glm::vec3& newValue)
     {
         collection.beginWriteSceneAction(ESceneActionId::SetTranslation);
@@ -285,6 +291,14 @@ namespace ramses::internal
         collection.write(startVertex);
     }
 
+    void SceneActionCollectionCreator::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableBoundingBox);
+        collection.write(renderableHandle);
+        collection.write(boundingBox.min);
+        collection.write(boundingBox.max);
+    }
+
     void SceneActionCollectionCreator::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         collection.beginWriteSceneAction(ESceneActionId::SetRenderableDataInstance);
@@ -537,6 +551,13 @@ namespace ramses::internal
         collection.write(pass);
     }
 
+    void SceneActionCollectionCreator::setRenderPassStateSorting(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassStateSorting);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
     void SceneActionCollectionCreator::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         collection.beginWriteSceneAction(ESceneActionId::AddRenderGroupToRenderPass);
@@ -49,6 +49,7 @@ namespace ramses::internal
         explicit SceneActionCollectionCreator(SceneActionCollection& collection_);
 
         void preallocateSceneSize(const SceneSizeInformation& sizeInfo);
+        void setTransformationUpdateMode(ETransformationUpdateMode mode);
 
         // Renderable allocation
         void allocateRenderable(NodeHandle nodeHandle, RenderableHandle handle);
@@ -62,6 +63,7 @@ namespace ramses::internal
         void setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible);
         void setRenderableInstanceCount(RenderableHandle renderableHandle, uint32_t instanceCount);
         void setRenderableStartVertex(RenderableHandle renderableHandle, uint32_t startVertex);
+        void setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox);
 
         // Render state allocation
         void allocateRenderState(RenderStateHandle stateHandle);
@@ -145,6 +147,7 @@ namespace ramses::internal
         void setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled);
         void setRenderPassRenderOnce(RenderPassHandle pass, bool enabled);
         void retriggerRenderPassRenderOnce(RenderPassHandle pass);
+        void setRenderPassStateSorting(RenderPassHandle pass, bool enabled);
         void addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order);
         void removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle);
 
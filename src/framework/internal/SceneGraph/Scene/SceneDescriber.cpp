@@ -29,6 +29,8 @@ namespace ramses::internal
         const size_t sizeOfSceneActionsEstimate = 30u * numberOfSceneActionsEstimate;
         collector.collection.reserveAdditionalCapacity(sizeOfSceneActionsEstimate, numberOfSceneActionsEstimate);
 
+        if (source.getTransformationUpdateMode() != ETransformationUpdateMode::Lazy)
+            collector.setTransformationUpdateMode(source.getTransformationUpdateMode());
         RecreateNodes(                   source, collector);
         RecreateTransformNodes(          source, collector);
         RecreateTransformations(         source, collector);
@@ -132,7 +134,10 @@ namespace ramses::internal
         {
             if (source.isRenderableAllocated(r))
             {
-                collector.compoundRenderable(r, source.getRenderable(r));
+                const Renderable& renderable = source.getRenderable(r);
+                collector.compoundRenderable(r, renderable);
+                if (renderable.boundingBox.isValid())
+                    collector.setRenderableBoundingBox(r, renderable.boundingBox);
             }
         }
     }
@@ -384,6 +389,8 @@ namespace ramses::internal
                 collector.setRenderPassEnabled(renderPass, rp.isEnabled);
                 if (rp.isRenderOnce)
                     collector.setRenderPassRenderOnce(renderPass, true);
+                if (rp.isStateSortingEnabled)
+                    collector.setRenderPassStateSorting(renderPass, true);
                 for (const auto& rgEntry : rp.renderGroups)
                     collector.addRenderGroupToRenderPass(renderPass, rgEntry.renderGroup, rgEntry.order);
             }
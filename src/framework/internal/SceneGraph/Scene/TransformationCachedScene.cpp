@@ -12,6 +12,8 @@
 #include "internal/Core/Math3d/Rotation.h"
 #include "glm/gtx/transform.hpp"
 
+#include <algorithm>
+
 namespace
 {
     const auto Identity = glm::identity<glm::mat4>();
@@ -37,6 +39,7 @@ namespace ramses::internal
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::removeChildFromNode(NodeHandle parent, NodeHandle child)
     {
+        invalidateBreadthFirstOrder();
         propagateDirty(child);
         SceneT<MEMORYPOOL>::removeChildFromNode(parent, child);
     }
@@ -44,6 +47,7 @@ namespace ramses::internal
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::addChildToNode(NodeHandle parent, NodeHandle child)
     {
+        invalidateBreadthFirstOrder();
         propagateDirty(child);
         SceneT<MEMORYPOOL>::addChildToNode(parent, child);
     }
@@ -52,6 +56,7 @@ namespace ramses::internal
     TransformHandle TransformationCachedSceneT<MEMORYPOOL>::allocateTransform(NodeHandle nodeHandle, TransformHandle handle)
     {
         assert(nodeHandle.isValid());
+        invalidateBreadthFirstOrder();
         const TransformHandle actualHandle = SceneT<MEMORYPOOL>::allocateTransform(nodeHandle, handle);
         m_nodeToTransformMap.put(nodeHandle, actualHandle);
         propagateDirty(nodeHandle);
@@ -63,6 +68,7 @@ namespace ramses::internal
     {
         const NodeHandle nodeHandle = this->getTransformNode(transform);
         assert(nodeHandle.isValid());
+        invalidateBreadthFirstOrder();
         SceneT<MEMORYPOOL>::releaseTransform(transform);
         propagateDirty(nodeHandle);
     }
@@ -75,6 +81,12 @@ namespace ramses::internal
         getMatrixCacheEntry(nodeTransformIsConnectedTo).m_isIdentity = false;
         propagateDirty(nodeTransformIsConnectedTo);
         SceneT<MEMORYPOOL>::setTranslation(transform, translation);
+
+        if (m_breadthFirstOrderValid)
+        {
+            const uint32_t index = getBreadthFirstIndex(nodeTransformIsConnectedTo);
+            m_breadthFirstTranslations[index] = translation;
+        }
     }
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -85,6 +97,13 @@ namespace ramses::internal
         getMatrixCacheEntry(nodeTransformIsConnectedTo).m_isIdentity = false;
         propagateDirty(nodeTransformIsConnectedTo);
         SceneT<MEMORYPOOL>::setRotation(transform, rotation, rotationType);
+
+        if (m_breadthFirstOrderValid)
+        {
+            const uint32_t index = getBreadthFirstIndex(nodeTransformIsConnectedTo);
+            m_breadthFirstRotations[index] = rotation;
+            m_breadthFirstRotationTypes[index] = rotationType;
+        }
     }
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -95,6 +114,12 @@ namespace ramses::internal
         getMatrixCacheEntry(nodeTransformIsConnectedTo).m_isIdentity = false;
         propagateDirty(nodeTransformIsConnectedTo);
         SceneT<MEMORYPOOL>::setScaling(transform, scaling);
+
+        if (m_breadthFirstOrderValid)
+        {
+            const uint32_t index = getBreadthFirstIndex(nodeTransformIsConnectedTo);
+            m_breadthFirstScalings[index] = scaling;
+        }
     }
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -102,12 +127,14 @@ namespace ramses::internal
     {
         const NodeHandle _node = SceneT<MEMORYPOOL>::allocateNode(childrenCount, node);
         m_matrixCachePool.allocate(_node);
+        invalidateBreadthFirstOrder();
         return _node;
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::releaseNode(NodeHandle node)
     {
+        invalidateBreadthFirstOrder();
         m_matrixCachePool.release(node);
         m_nodeToTransformMap.remove(node);
         SceneT<MEMORYPOOL>::releaseNode(node);
@@ -155,6 +182,14 @@ namespace ramses::internal
     template <template<typename, typename> class MEMORYPOOL>
     glm::mat4 TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const
     {
+        // clean cache is only read, this allows concurrent reads of clean matrices (e.g. from linked scenes updated in parallel)
+        if (node.isValid())
+        {
+            const MatrixCacheEntry& cacheEntry = getMatrixCacheEntry(node);
+            if (!cacheEntry.m_matrixDirty[matrixType])
+                return cacheEntry.m_matrix[matrixType];
+        }
+
         auto chainMatrix = findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(matrixType, node, m_dirtyNodes);
         updateMatrixCacheForDirtyNodes(matrixType, chainMatrix, m_dirtyNodes);
 
@@ -185,6 +220,13 @@ namespace ramses::internal
         MatrixCacheEntry& cacheEntry = getMatrixCacheEntry(node);
         const bool wasDirty = cacheEntry.m_matrixDirty[ETransformationMatrixType_Object] && cacheEntry.m_matrixDirty[ETransformationMatrixType_World];
         cacheEntry.setDirty();
+
+        if (m_breadthFirstOrderValid)
+        {
+            m_breadthFirstDirty[getBreadthFirstIndex(node)] = 1u;
+            m_breadthFirstAnyDirty = true;
+        }
+
         return wasDirty;
     }
 
@@ -255,6 +297,129 @@ namespace ramses::internal
         }
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::setTransformationUpdateMode(ETransformationUpdateMode mode)
+    {
+        SceneT<MEMORYPOOL>::setTransformationUpdateMode(mode);
+        invalidateBreadthFirstOrder();
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::updateWorldMatricesBreadthFirst()
+    {
+        if (this->getTransformationUpdateMode() != ETransformationUpdateMode::BreadthFirst)
+            return;
+
+        if (!m_breadthFirstOrderValid)
+            rebuildBreadthFirstOrder();
+
+        if (!m_breadthFirstAnyDirty)
+            return;
+
+        // parent is always before its children, so dirtiness and parent world matrix are final when child is processed
+        const size_t nodeCount = m_breadthFirstNodes.size();
+        for (size_t i = 0u; i < nodeCount; ++i)
+        {
+            const uint32_t parentIndex = m_breadthFirstParentIndices[i];
+            if (parentIndex != InvalidIndex && m_breadthFirstDirty[parentIndex] != 0u)
+                m_breadthFirstDirty[i] = 1u;
+
+            if (m_breadthFirstDirty[i] == 0u)
+                continue;
+
+            glm::mat4& worldMatrix = m_breadthFirstWorldMatrices[i];
+            worldMatrix = (parentIndex != InvalidIndex ? m_breadthFirstWorldMatrices[parentIndex] : Identity);
+            if (m_breadthFirstHasTransform[i] != 0u)
+            {
+                worldMatrix *=
+                    glm::translate(m_breadthFirstTranslations[i]) *
+                    Math3d::Rotation(m_breadthFirstRotations[i], m_breadthFirstRotationTypes[i]) *
+                    glm::scale(m_breadthFirstScalings[i]);
+            }
+
+            setMatrixCache(ETransformationMatrixType_World, getMatrixCacheEntry(m_breadthFirstNodes[i]), worldMatrix);
+        }
+
+        std::fill(m_breadthFirstDirty.begin(), m_breadthFirstDirty.end(), uint8_t{ 0u });
+        m_breadthFirstAnyDirty = false;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::invalidateBreadthFirstOrder()
+    {
+        m_breadthFirstOrderValid = false;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::rebuildBreadthFirstOrder()
+    {
+        const uint32_t nodeCount = SceneT<MEMORYPOOL>::getNodeCount();
+        m_nodeToBreadthFirstIndex.assign(nodeCount, InvalidIndex);
+        m_breadthFirstNodes.clear();
+        m_breadthFirstParentIndices.clear();
+        m_breadthFirstHasTransform.clear();
+        m_breadthFirstTranslations.clear();
+        m_breadthFirstRotations.clear();
+        m_breadthFirstRotationTypes.clear();
+        m_breadthFirstScalings.clear();
+        m_breadthFirstWorldMatrices.clear();
+
+        for (NodeHandle node(0u); node < nodeCount; ++node)
+        {
+            if (SceneT<MEMORYPOOL>::isNodeAllocated(node) && !SceneT<MEMORYPOOL>::getParent(node).isValid())
+                addNodeToBreadthFirstOrder(node, InvalidIndex);
+        }
+
+        // nodes vector grows while being traversed, each node appends its children
+        for (uint32_t i = 0u; i < static_cast<uint32_t>(m_breadthFirstNodes.size()); ++i)
+        {
+            const NodeHandleVector& children = SceneT<MEMORYPOOL>::getNode(m_breadthFirstNodes[i]).children;
+            for (const auto child : children)
+                addNodeToBreadthFirstOrder(child, i);
+        }
+
+        m_breadthFirstDirty.assign(m_breadthFirstNodes.size(), 1u);
+        m_breadthFirstAnyDirty = true;
+        m_breadthFirstOrderValid = true;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::addNodeToBreadthFirstOrder(NodeHandle node, uint32_t parentIndex)
+    {
+        m_nodeToBreadthFirstIndex[node.asMemoryHandle()] = static_cast<uint32_t>(m_breadthFirstNodes.size());
+        m_breadthFirstNodes.push_back(node);
+        m_breadthFirstParentIndices.push_back(parentIndex);
+        m_breadthFirstWorldMatrices.push_back(Identity);
+
+        const TransformHandle* transformHandlePtr = m_nodeToTransformMap.get(node);
+        if (transformHandlePtr != nullptr)
+        {
+            const auto& transform = SceneT<MEMORYPOOL>::getTransform(*transformHandlePtr);
+            m_breadthFirstHasTransform.push_back(1u);
+            m_breadthFirstTranslations.push_back(transform.translation);
+            m_breadthFirstRotations.push_back(transform.rotation);
+            m_breadthFirstRotationTypes.push_back(transform.rotationType);
+            m_breadthFirstScalings.push_back(transform.scaling);
+        }
+        else
+        {
+            m_breadthFirstHasTransform.push_back(0u);
+            m_breadthFirstTranslations.push_back(IScene::IdentityTranslation);
+            m_breadthFirstRotations.push_back(IScene::IdentityRotation);
+            m_breadthFirstRotationTypes.push_back(ERotationType::Euler_XYZ);
+            m_breadthFirstScalings.push_back(IScene::IdentityScaling);
+        }
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    uint32_t TransformationCachedSceneT<MEMORYPOOL>::getBreadthFirstIndex(NodeHandle node) const
+    {
+        assert(m_breadthFirstOrderValid);
+        assert(node.asMemoryHandle() < m_nodeToBreadthFirstIndex.size());
+        assert(m_nodeToBreadthFirstIndex[node.asMemoryHandle()] != InvalidIndex);
+        return m_nodeToBreadthFirstIndex[node.asMemoryHandle()];
+    }
+
     template class TransformationCachedSceneT < MemoryPool >;
     template class TransformationCachedSceneT < MemoryPoolExplicit >;
 }
@@ -12,8 +12,11 @@
 #include "internal/SceneGraph/Scene/MatrixCacheEntry.h"
 #include "internal/Core/Utils/MemoryPool.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
 
 #include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -48,6 +51,11 @@ namespace ramses::internal
         glm::mat4                       updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const;
         bool                            isMatrixCacheDirty(ETransformationMatrixType matrixType, NodeHandle node) const;
 
+        void                            setTransformationUpdateMode(ETransformationUpdateMode mode) override;
+        // Recomputes all dirty world matrices in one linear pass, only has effect in ETransformationUpdateMode::BreadthFirst.
+        // World matrix cache is clean afterwards so that following updateMatrixCache calls for world matrix are just lookups.
+        void                            updateWorldMatricesBreadthFirst();
+
     protected:
         MatrixCacheEntry&           getMatrixCacheEntry(NodeHandle nodeHandle) const;
         bool                        markDirty(NodeHandle node) const;
@@ -67,14 +75,36 @@ namespace ramses::internal
         void                        computeObjectMatrixForNode(NodeHandle node, glm::mat4& chainMatrix) const;
         void                        propagateDirty(NodeHandle node) const;
 
+        void                        invalidateBreadthFirstOrder();
+        void                        rebuildBreadthFirstOrder();
+        void                        addNodeToBreadthFirstOrder(NodeHandle node, uint32_t parentIndex);
+        [[nodiscard]] uint32_t      getBreadthFirstIndex(NodeHandle node) const;
+
         // Cache
         using MatrixCachePool = MEMORYPOOL<MatrixCacheEntry, NodeHandle>;
         mutable MatrixCachePool m_matrixCachePool;
 
-        HashMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
+        FlatHashMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
 
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        // Data for breadth first update stored as structure of arrays, all indexed by position of node
+        // in breadth first order, i.e. parent is always stored before any of its children.
+        // Order is rebuilt lazily whenever hierarchy or set of transforms changes.
+        static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+        bool                        m_breadthFirstOrderValid = false;
+        std::vector<uint32_t>       m_nodeToBreadthFirstIndex;
+        NodeHandleVector            m_breadthFirstNodes;
+        std::vector<uint32_t>       m_breadthFirstParentIndices;
+        std::vector<uint8_t>        m_breadthFirstHasTransform;
+        std::vector<glm::vec3>      m_breadthFirstTranslations;
+        std::vector<glm::vec4>      m_breadthFirstRotations;
+        std::vector<ERotationType>  m_breadthFirstRotationTypes;
+        std::vector<glm::vec3>      m_breadthFirstScalings;
+        std::vector<glm::mat4>      m_breadthFirstWorldMatrices;
+        mutable std::vector<uint8_t> m_breadthFirstDirty;
+        mutable bool                m_breadthFirstAnyDirty = false;
     };
 }
@@ -0,0 +1,39 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/DataTypesImpl.h"
+#include <limits>
+
+namespace ramses::internal
+{
+    // Axis aligned bounding box in local (model) space of a renderable.
+    // Default constructed box is invalid which means the renderable has no bounds
+    // and will never be culled.
+    struct BoundingBox
+    {
+        glm::vec3 min{ std::numeric_limits<float>::max() };
+        glm::vec3 max{ std::numeric_limits<float>::lowest() };
+
+        [[nodiscard]] bool isValid() const
+        {
+            return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+        }
+
+        bool operator==(const BoundingBox& other) const
+        {
+            return min == other.min && max == other.max;
+        }
+
+        bool operator!=(const BoundingBox& other) const
+        {
+            return !operator==(other);
+        }
+    };
+}
@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace ramses::internal
+{
+    enum class ETransformationUpdateMode : uint8_t
+    {
+        // world matrices are computed on demand by walking up the parent chain of a node
+        Lazy = 0,
+        // all dirty world matrices are computed in a single sweep over nodes sorted breadth first
+        BreadthFirst
+    };
+
+    inline const char* EnumToString(ETransformationUpdateMode mode)
+    {
+        switch (mode)
+        {
+        case ETransformationUpdateMode::Lazy:
+            return "Lazy";
+        case ETransformationUpdateMode::BreadthFirst:
+            return "BreadthFirst";
+        }
+        return "";
+    }
+}
@@ -22,6 +22,7 @@
 #include "internal/SceneGraph/SceneAPI/Renderable.h"
 #include "internal/SceneGraph/SceneAPI/RendererSceneState.h"
 #include "internal/SceneGraph/SceneAPI/ERotationType.h"
+#include "internal/SceneGraph/SceneAPI/ETransformationUpdateMode.h"
 
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
@@ -66,6 +67,9 @@ namespace ramses::internal
         virtual void setEffectTimeSync(FlushTime::Clock::time_point t) = 0;
         [[nodiscard]] virtual FlushTime::Clock::time_point getEffectTimeSync() const = 0;
 
+        virtual void setTransformationUpdateMode(ETransformationUpdateMode mode) = 0;
+        [[nodiscard]] virtual ETransformationUpdateMode getTransformationUpdateMode() const = 0;
+
         virtual void                        preallocateSceneSize            (const SceneSizeInformation& sizeInfo) = 0;
 
         // Renderable
@@ -80,6 +84,7 @@ namespace ramses::internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) = 0;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) = 0;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) = 0;
+        virtual void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) = 0;
         [[nodiscard]] virtual const Renderable& getRenderable               (RenderableHandle renderableHandle) const = 0;
 
         // Render state
@@ -238,6 +243,7 @@ namespace ramses::internal
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) = 0;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) = 0;
+        virtual void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) = 0;
         virtual void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) = 0;
         [[nodiscard]] virtual const RenderPass&           getRenderPass     (RenderPassHandle passHandle) const = 0;
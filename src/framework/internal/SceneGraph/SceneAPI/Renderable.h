@@ -11,6 +11,7 @@
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 #include "internal/SceneGraph/SceneAPI/Handles.h"
 #include "internal/SceneGraph/SceneAPI/ERenderableDataSlotType.h"
+#include "internal/SceneGraph/SceneAPI/BoundingBox.h"
 #include "ramses/framework/EVisibilityMode.h"
 #include <array>
 
@@ -30,5 +31,7 @@ namespace ramses::internal
 
         std::array<DataInstanceHandle, ERenderableDataSlotType_MAX_SLOTS> dataInstances;
         RenderStateHandle renderState;
+
+        BoundingBox boundingBox;
     };
 }
@@ -26,7 +26,7 @@ namespace ramses
         auto* fw = cli.add_option_group("Framework Options");
         auto* logger = cli.add_option_group("Logger Options");
 
-        std::map<std::string, EConnectionSystem> mapConn{{"tcp", EConnectionSystem::TCP}, {"off", EConnectionSystem::Off}};
+        std::map<std::string, EConnectionSystem> mapConn{{"tcp", EConnectionSystem::TCP}, {"off", EConnectionSystem::Off}, {"local", EConnectionSystem::Local}};
         fw->add_option_function<EConnectionSystem>(
             "--connection", [&](const EConnectionSystem value) { config.setConnectionSystem(value); }, "Connection system")
             ->transform(CLI::CheckedTransformer(mapConn, CLI::ignore_case));
@@ -63,6 +63,12 @@ namespace ramses
                 config.setConnectionKeepaliveSettings(value.first, value.second);
             },
             "TCP keepalive settings in milliseconds. 1st value: interval, 2nd value: timeout");
+        fw->add_option_function<uint32_t>(
+            "--tcp-send-coalescing", [&](uint32_t bytes) { config.setConnectionSendCoalescingSize(bytes); }, "Maximum bytes written with one TCP gather write (0 disables coalescing)");
+        fw->add_option_function<std::string>(
+            "--local-dir", [&](const std::string& dir) { config.setLocalConnectionDirectory(dir); }, "Directory of socket files for local connection");
+        fw->add_option_function<uint32_t>(
+            "--resource-threads", [&](uint32_t count) { config.setResourceProcessingThreadCount(count); }, "Number of worker threads compressing and loading resources (0 uses calling thread only)");
 
         // Logger options
         logger->add_option_function<std::chrono::seconds>(
@@ -136,6 +136,27 @@ namespace ramses
         return status;
     }
 
+    bool DisplayConfig::setAsyncResourceUploadEnabled(bool enabled)
+    {
+        const auto status = m_impl->setAsyncResourceUploadEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    bool DisplayConfig::setAsyncReadPixelsEnabled(bool enabled)
+    {
+        const auto status = m_impl->setAsyncReadPixelsEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    bool DisplayConfig::setRenderCommandRecordingEnabled(bool enabled)
+    {
+        const auto status = m_impl->setRenderCommandRecordingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
     void* DisplayConfig::getAndroidNativeWindow() const
     {
         return m_impl->getAndroidNativeWindow();
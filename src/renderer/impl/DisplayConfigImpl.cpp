@@ -211,6 +211,24 @@ namespace ramses::internal
         return true;
     }
 
+    bool DisplayConfigImpl::setAsyncResourceUploadEnabled(bool enabled)
+    {
+        m_internalConfig.setAsyncResourceUploadEnabled(enabled);
+        return true;
+    }
+
+    bool DisplayConfigImpl::setAsyncReadPixelsEnabled(bool enabled)
+    {
+        m_internalConfig.setAsyncReadPixelsEnabled(enabled);
+        return true;
+    }
+
+    bool DisplayConfigImpl::setRenderCommandRecordingEnabled(bool enabled)
+    {
+        m_internalConfig.setRenderCommandRecordingEnabled(enabled);
+        return true;
+    }
+
     bool DisplayConfigImpl::setWaylandEmbeddedCompositingSocketGroup(std::string_view groupname)
     {
         m_internalConfig.setWaylandEmbeddedCompositingSocketGroup(groupname);
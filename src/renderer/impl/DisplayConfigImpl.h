@@ -56,6 +56,9 @@ namespace ramses::internal
         [[nodiscard]] bool setWindowsWindowHandle(void* hwnd);
         [[nodiscard]] void*    getWindowsWindowHandle() const;
         [[nodiscard]] bool setAsyncEffectUploadEnabled(bool enabled);
+        [[nodiscard]] bool setAsyncResourceUploadEnabled(bool enabled);
+        [[nodiscard]] bool setAsyncReadPixelsEnabled(bool enabled);
+        [[nodiscard]] bool setRenderCommandRecordingEnabled(bool enabled);
 
         [[nodiscard]] bool setWaylandEmbeddedCompositingSocketGroup(std::string_view groupname);
         [[nodiscard]] std::string_view getWaylandSocketEmbeddedGroup() const;
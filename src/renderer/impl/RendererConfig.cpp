@@ -81,6 +81,18 @@ namespace ramses
         return m_impl->getRenderThreadLoopTimingReportingPeriod();
     }
 
+    bool RendererConfig::setSceneUpdateWorkerCount(uint32_t workerCount)
+    {
+        const auto status = m_impl->setSceneUpdateWorkerCount(workerCount);
+        LOG_HL_RENDERER_API1(status, workerCount);
+        return status;
+    }
+
+    uint32_t RendererConfig::getSceneUpdateWorkerCount() const
+    {
+        return m_impl->getSceneUpdateWorkerCount();
+    }
+
     internal::RendererConfigImpl& RendererConfig::impl()
     {
         return *m_impl;
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "impl/RendererConfigImpl.h"
+#include "internal/Core/Utils/LogMacros.h"
 
 namespace ramses::internal
 {
@@ -57,6 +58,23 @@ namespace ramses::internal
         return m_internalConfig.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    bool RendererConfigImpl::setSceneUpdateWorkerCount(uint32_t workerCount)
+    {
+        if (workerCount > RendererConfig::MaxSceneUpdateWorkerCount)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererConfig::setSceneUpdateWorkerCount failed - worker count cannot exceed {}!", RendererConfig::MaxSceneUpdateWorkerCount);
+            return false;
+        }
+
+        m_internalConfig.setSceneUpdateWorkerCount(workerCount);
+        return true;
+    }
+
+    uint32_t RendererConfigImpl::getSceneUpdateWorkerCount() const
+    {
+        return m_internalConfig.getSceneUpdateWorkerCount();
+    }
+
     const ramses::internal::RendererConfig& RendererConfigImpl::getInternalRendererConfig() const
     {
         return m_internalConfig;
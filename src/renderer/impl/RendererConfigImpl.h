@@ -35,6 +35,9 @@ namespace ramses::internal
         [[nodiscard]] bool setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period);
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        [[nodiscard]] bool setSceneUpdateWorkerCount(uint32_t workerCount);
+        [[nodiscard]] uint32_t getSceneUpdateWorkerCount() const;
+
         //impl methods
         [[nodiscard]] const ramses::internal::RendererConfig& getInternalRendererConfig() const;
 
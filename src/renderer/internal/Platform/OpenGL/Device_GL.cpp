@@ -29,6 +29,7 @@
 #include "internal/PlatformAbstraction/PlatformStringUtils.h"
 #include "internal/PlatformAbstraction/Macros.h"
 #include "glm/gtc/type_ptr.hpp"
+#include <cstring>
 
 #include "impl/TextureEnumsImpl.h"
 
@@ -105,6 +106,14 @@ namespace ramses::internal
         for (const auto& it : m_textureSamplerObjectsCache)
             deleteTextureSampler(it.second);
 
+        for (auto& pixelPackBuffer : m_pixelPackBuffers)
+        {
+            if (pixelPackBuffer.fence != nullptr)
+                glDeleteSync(static_cast<GLsync>(pixelPackBuffer.fence));
+            if (pixelPackBuffer.buffer != InvalidGLHandle)
+                glDeleteBuffers(1, &pixelPackBuffer.buffer);
+        }
+
         m_resourceMapper.deleteResource(m_framebufferRenderTarget);
     }
 
@@ -1499,6 +1508,84 @@ namespace ramses::internal
         glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, static_cast<void*>(buffer));
     }
 
+    DeviceResourceHandle Device_GL::readPixelsAsync(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        PixelPackBuffer& pixelPackBuffer = m_pixelPackBuffers[m_nextPixelPackBuffer];
+        if (pixelPackBuffer.fence != nullptr)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "Device_GL::readPixelsAsync: all {} readback buffers are in use", PixelPackBufferRingSize);
+            return DeviceResourceHandle::Invalid();
+        }
+
+        const uint32_t size = width * height * 4u;
+        if (pixelPackBuffer.buffer == InvalidGLHandle)
+            glGenBuffers(1, &pixelPackBuffer.buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelPackBuffer.buffer);
+        if (pixelPackBuffer.capacity < size)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+            pixelPackBuffer.capacity = size;
+        }
+        // with pixel pack buffer bound the transfer is only scheduled, data pointer is offset into the buffer
+        glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        pixelPackBuffer.size = size;
+        pixelPackBuffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (pixelPackBuffer.fence == nullptr)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::readPixelsAsync: failed to create fence");
+            return DeviceResourceHandle::Invalid();
+        }
+
+        const DeviceResourceHandle readback{ m_nextPixelPackBuffer };
+        m_nextPixelPackBuffer = (m_nextPixelPackBuffer + 1u) % PixelPackBufferRingSize;
+        return readback;
+    }
+
+    bool Device_GL::isReadPixelsAsyncFinished(DeviceResourceHandle readback)
+    {
+        assert(readback.asMemoryHandle() < PixelPackBufferRingSize);
+        const PixelPackBuffer& pixelPackBuffer = m_pixelPackBuffers[readback.asMemoryHandle()];
+        if (pixelPackBuffer.fence == nullptr)
+            return true;
+
+        // zero timeout only polls fence status
+        const GLenum status = glClientWaitSync(static_cast<GLsync>(pixelPackBuffer.fence), GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        return status != GL_TIMEOUT_EXPIRED;
+    }
+
+    void Device_GL::getReadPixelsAsyncResult(DeviceResourceHandle readback, uint8_t* buffer)
+    {
+        assert(readback.asMemoryHandle() < PixelPackBufferRingSize);
+        PixelPackBuffer& pixelPackBuffer = m_pixelPackBuffers[readback.asMemoryHandle()];
+        if (pixelPackBuffer.fence == nullptr)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::getReadPixelsAsyncResult: no readback in progress for {}", readback);
+            return;
+        }
+
+        if (buffer != nullptr)
+        {
+            if (glClientWaitSync(static_cast<GLsync>(pixelPackBuffer.fence), GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED) == GL_WAIT_FAILED)
+                LOG_ERROR(CONTEXT_RENDERER, "Device_GL::getReadPixelsAsyncResult: waiting for readback fence failed");
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelPackBuffer.buffer);
+            const void* mappedData = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, pixelPackBuffer.size, GL_MAP_READ_BIT);
+            if (mappedData != nullptr)
+            {
+                std::memcpy(buffer, mappedData, pixelPackBuffer.size);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            else
+                LOG_ERROR(CONTEXT_RENDERER, "Device_GL::getReadPixelsAsyncResult: failed to map readback buffer");
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+
+        glDeleteSync(static_cast<GLsync>(pixelPackBuffer.fence));
+        pixelPackBuffer.fence = nullptr;
+    }
+
     uint32_t Device_GL::getTotalGpuMemoryUsageInKB() const
     {
         return m_resourceMapper.getTotalGpuMemoryUsageInKB();
@@ -1541,4 +1628,25 @@ namespace ramses::internal
     {
         glFlush();
     }
+
+    bool Device_GL::insertFenceAndWait()
+    {
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (fence == nullptr)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::insertFenceAndWait: failed to create fence");
+            return false;
+        }
+
+        // flush bit makes sure fence is submitted, otherwise waiting could block forever
+        const GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        glDeleteSync(fence);
+
+        if (status == GL_WAIT_FAILED)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::insertFenceAndWait: waiting for fence failed");
+            return false;
+        }
+        return true;
+    }
 }
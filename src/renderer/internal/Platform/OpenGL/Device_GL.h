@@ -16,6 +16,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <array>
 
 namespace ramses::internal
 {
@@ -66,6 +67,9 @@ namespace ramses::internal
         bool setConstant(DataFieldHandle field, uint32_t count, const glm::mat4*  value) override;
 
         void readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        DeviceResourceHandle readPixelsAsync(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool isReadPixelsAsyncFinished(DeviceResourceHandle readback) override;
+        void getReadPixelsAsyncResult(DeviceResourceHandle readback, uint8_t* buffer) override;
 
         DeviceResourceHandle    allocateVertexBuffer  (uint32_t totalSizeInBytes) override;
         void                    uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
@@ -131,6 +135,7 @@ namespace ramses::internal
         uint32_t                  getTotalGpuMemoryUsageInKB() const override;
 
         void                    flush() override;
+        bool                    insertFenceAndWait() override;
 
     private:
         DeviceResourceHandle        m_framebufferRenderTarget;
@@ -159,6 +164,18 @@ namespace ramses::internal
 
         std::unordered_map<uint64_t, DeviceResourceHandle> m_textureSamplerObjectsCache;
 
+        // ring of pixel pack buffers used for async readback, buffer is in use while its fence is set
+        struct PixelPackBuffer
+        {
+            GLHandle buffer = InvalidGLHandle;
+            uint32_t capacity = 0u;
+            uint32_t size = 0u;
+            void* fence = nullptr; // GLsync, GL headers are not included here
+        };
+        static constexpr uint32_t PixelPackBufferRingSize = 3u;
+        std::array<PixelPackBuffer, PixelPackBufferRingSize> m_pixelPackBuffers;
+        uint32_t m_nextPixelPackBuffer = 0u;
+
         bool allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const;
         static void BindRenderBufferToRenderTarget(const RenderBufferGPUResource& renderBufferGpuResource, size_t colorBufferSlot);
         static void BindReadWriteRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle, bool multiSample);
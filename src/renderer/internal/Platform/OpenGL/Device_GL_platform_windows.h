@@ -113,6 +113,11 @@
 #define glCompressedTexSubImage3D(...)  glCompressedTexSubImage3DNative(__VA_ARGS__)
 #define glGetInternalformativ(...)      glGetInternalformativNative(__VA_ARGS__)
 #define glInvalidateFramebuffer(...)    glInvalidateFramebufferNative(__VA_ARGS__)
+#define glFenceSync(...)                glFenceSyncNative(__VA_ARGS__)
+#define glClientWaitSync(...)           glClientWaitSyncNative(__VA_ARGS__)
+#define glDeleteSync(...)               glDeleteSyncNative(__VA_ARGS__)
+#define glMapBufferRange(...)           glMapBufferRangeNative(__VA_ARGS__)
+#define glUnmapBuffer(...)              glUnmapBufferNative(__VA_ARGS__)
 
 #define DECLARE_ALL_API_PROCS                                                                   \
 DECLARE_API_PROC(PFNGLGETSTRINGIPROC, glGetStringi);                                            \
@@ -201,6 +206,11 @@ DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
 DECLARE_API_PROC(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);                          \
 DECLARE_API_PROC(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);                      \
+DECLARE_API_PROC(PFNGLFENCESYNCPROC, glFenceSync);                                              \
+DECLARE_API_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                    \
+DECLARE_API_PROC(PFNGLDELETESYNCPROC, glDeleteSync);                                            \
+DECLARE_API_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                    \
+DECLARE_API_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                          \
 
 #define LOAD_ALL_API_PROCS(CONTEXT)                                                               \
 LOAD_API_PROC(CONTEXT, PFNGLGETSTRINGIPROC, glGetStringi);                                        \
@@ -289,6 +299,11 @@ LOAD_API_PROC(CONTEXT, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage
 LOAD_API_PROC(CONTEXT, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);              \
 LOAD_API_PROC(CONTEXT, PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);                      \
 LOAD_API_PROC(CONTEXT, PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);                  \
+LOAD_API_PROC(CONTEXT, PFNGLFENCESYNCPROC, glFenceSync);                                          \
+LOAD_API_PROC(CONTEXT, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                \
+LOAD_API_PROC(CONTEXT, PFNGLDELETESYNCPROC, glDeleteSync);                                        \
+LOAD_API_PROC(CONTEXT, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                \
+LOAD_API_PROC(CONTEXT, PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                      \
 
 //In WGL (Windows), all api procs are static and need explicit definition in a source file
 #define DEFINE_ALL_API_PROCS                                                                   \
@@ -378,3 +393,8 @@ DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
 DEFINE_API_PROC(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);                          \
 DEFINE_API_PROC(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);                      \
+DEFINE_API_PROC(PFNGLFENCESYNCPROC, glFenceSync);                                              \
+DEFINE_API_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);                                    \
+DEFINE_API_PROC(PFNGLDELETESYNCPROC, glDeleteSync);                                            \
+DEFINE_API_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);                                    \
+DEFINE_API_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);                                          \
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/AsyncEffectUploader.h"
+#include "internal/RendererLib/ResourceUploader.h"
 #include "internal/RendererLib/PlatformBase/Context_Base.h"
 #include "internal/RendererLib/PlatformInterface/IRenderBackend.h"
 #include "internal/RendererLib/PlatformInterface/IResourceUploadRenderBackend.h"
@@ -14,19 +15,40 @@
 #include "internal/RendererLib/PlatformInterface/IContext.h"
 #include "internal/RendererLib/PlatformInterface/IPlatform.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include <algorithm>
 
 namespace ramses::internal
 {
-    AsyncEffectUploader::AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display)
+    namespace
+    {
+        void DeleteDataResource(IDevice& device, EResourceType type, DeviceResourceHandle handle)
+        {
+            switch (type)
+            {
+            case EResourceType::VertexArray:
+                device.deleteVertexBuffer(handle);
+                break;
+            case EResourceType::IndexArray:
+                device.deleteIndexBuffer(handle);
+                break;
+            default:
+                device.deleteTexture(handle);
+                break;
+            }
+        }
+    }
+
+    AsyncEffectUploader::AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display, WorkerThreadPool* decompressionThreadPool)
         : m_platform(platform)
         , m_renderBackend(renderBackend)
         , m_thread{ fmt::format("EffUpload{}", display) }
         , m_notifier(notifier)
         , m_aliveIdentifier(notifier.registerThread())
         , m_displayHandle{ display }
+        , m_decompressionThreadPool{ decompressionThreadPool }
     {
     }
 
@@ -59,7 +81,7 @@ namespace ramses::internal
         assert(m_thread.isRunning() && !isCancelRequested());
         {
             std::unique_lock<std::mutex> guard(m_mutex);
-            //call thread cancel inside critical section to avoid having deadlock on wait() inside uploadEffectsOrWait
+            //call thread cancel inside critical section to avoid having deadlock on wait() inside uploadOrWait
             m_thread.cancel();
         }
 
@@ -67,21 +89,26 @@ namespace ramses::internal
         m_thread.join();
     }
 
-    void AsyncEffectUploader::uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend)
+    void AsyncEffectUploader::uploadOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend)
     {
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: starting");
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadOrWait: starting");
 
         EffectsRawResources effectsToUpload;
+        ScheduledDataResources resourcesToUpload;
         {
             std::unique_lock<std::mutex> guard(m_mutex);
             do
             {
                 m_notifier.notifyAlive(m_aliveIdentifier);
             } while (!m_sleepConditionVar.wait_for(
-                guard, m_notifier.calculateTimeout(), [&]() { return !m_effectsToUpload.empty() || !m_effectsUploadedCache.empty() || isCancelRequested(); }));
+                guard, m_notifier.calculateTimeout(), [&]() {
+                    return !m_effectsToUpload.empty() || !m_effectsUploadedCache.empty() || !m_resourcesToUpload.empty() || !m_resourcesUploadedCache.empty() || isCancelRequested();
+                }));
 
             m_effectsUploaded.insert(m_effectsUploaded.end(), std::make_move_iterator(m_effectsUploadedCache.begin()), std::make_move_iterator(m_effectsUploadedCache.end()));
             m_effectsUploadedCache.clear();
+            m_resourcesUploaded.insert(m_resourcesUploaded.end(), std::make_move_iterator(m_resourcesUploadedCache.begin()), std::make_move_iterator(m_resourcesUploadedCache.end()));
+            m_resourcesUploadedCache.clear();
 
             //assert none of the shaders to be uploaded next was already uploaded since last sync
             assert(std::all_of(std::begin(m_effectsToUpload), std::end(m_effectsToUpload), [this](const auto& toUpload) {
@@ -91,10 +118,77 @@ namespace ramses::internal
             }));
 
             m_effectsToUpload.swap(effectsToUpload);
+            m_resourcesToUpload.swap(resourcesToUpload);
+        }
+
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadOrWait: will upload effects: {}, resources: {}", effectsToUpload.size(), resourcesToUpload.size());
+
+        uploadDataResources(resourceUploadRenderBackend, resourcesToUpload);
+        uploadEffects(resourceUploadRenderBackend, effectsToUpload);
+
+        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadOrWait: finished");
+    }
+
+    void AsyncEffectUploader::uploadDataResources(IResourceUploadRenderBackend& resourceUploadRenderBackend, const ScheduledDataResources& resourcesToUpload)
+    {
+        if (resourcesToUpload.empty())
+            return;
+
+        IDevice& device = resourceUploadRenderBackend.getDevice();
+        const auto uploadStart = std::chrono::steady_clock::now();
+
+        std::vector<std::pair<DeviceResourceHandle, uint32_t>> deviceHandles;
+        deviceHandles.reserve(resourcesToUpload.size());
+        for (const auto& resourceToUpload : resourcesToUpload)
+        {
+            if (isCancelRequested())
+            {
+                LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading cancelled");
+                break;
+            }
+
+            m_notifier.notifyAlive(m_aliveIdentifier);
+            const IResource& resource = *resourceToUpload.first;
+            if (m_decompressionThreadPool)
+                resource.decompress(*m_decompressionThreadPool);
+            else
+                resource.decompress();
+            uint32_t vramSize = 0u;
+            const auto deviceHandle = ResourceUploader::UploadDataResource(device, resource, vramSize);
+            deviceHandles.emplace_back(deviceHandle, vramSize);
         }
 
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: will upload: {},  uploaded in cache:{}", effectsToUpload.size(), m_effectsUploadedCache.size());
+        // resources can be used by main context only after GPU finished processing all uploads
+        m_notifier.notifyAlive(m_aliveIdentifier);
+        const bool uploadsCompleted = device.insertFenceAndWait();
+        if (!uploadsCompleted)
+            LOG_ERROR(CONTEXT_RENDERER, "AsyncEffectUploader failed waiting for resource uploads to complete, {} resources will be marked as broken", deviceHandles.size());
 
+        for (size_t i = 0u; i < deviceHandles.size(); ++i)
+        {
+            const auto& resourceToUpload = resourcesToUpload[i];
+            const auto [deviceHandle, vramSize] = deviceHandles[i];
+
+            UploadedDataResourceEntry entry{ { resourceToUpload.first->getHash(), nullptr, vramSize, {} }, resourceToUpload.second };
+            if (deviceHandle.isValid())
+            {
+                if (uploadsCompleted)
+                {
+                    // ownership of GPU resource is moved out of upload device, render backend device will take it over
+                    entry.uploaded.gpuResource = device.releaseResource(deviceHandle);
+                }
+                else
+                    DeleteDataResource(device, resourceToUpload.first->getTypeID(), deviceHandle);
+            }
+            m_resourcesUploadedCache.push_back(std::move(entry));
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader {} resources uploaded in {} us",
+            deviceHandles.size(), std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - uploadStart).count());
+    }
+
+    void AsyncEffectUploader::uploadEffects(IResourceUploadRenderBackend& resourceUploadRenderBackend, const EffectsRawResources& effectsToUpload)
+    {
         std::chrono::microseconds maxShaderUploadTime{ 0u };
         std::chrono::microseconds totalShaderUploadTime{ 0u };
         ResourceContentHash effectWithMaxUploadTime;
@@ -138,8 +232,6 @@ namespace ramses::internal
             resourceUploadRenderBackend.getDevice().flush();
 #endif
         }
-
-        LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: finished");
     }
 
     void AsyncEffectUploader::sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut)
@@ -169,6 +261,36 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::sync: finished");
     }
 
+    void AsyncEffectUploader::syncResources(const DataRawResources& resourcesToUpload, DataGpuResources& uploadedResourcesOut)
+    {
+        assert(uploadedResourcesOut.empty());
+
+        UploadedDataResourceEntries uploadedEntries;
+        const auto now = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+
+            for (const auto resource : resourcesToUpload)
+                m_resourcesToUpload.emplace_back(resource, now);
+            uploadedEntries.swap(m_resourcesUploaded);
+        }
+
+        uploadedResourcesOut.reserve(uploadedEntries.size());
+        for (auto& entry : uploadedEntries)
+        {
+            entry.uploaded.latency = std::chrono::duration_cast<std::chrono::microseconds>(now - entry.scheduleTime);
+            uploadedResourcesOut.push_back(std::move(entry.uploaded));
+        }
+
+        if (!resourcesToUpload.empty() || !uploadedResourcesOut.empty())
+        {
+            LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::syncResources newToUpload: {}, uploaded: {}", resourcesToUpload.size(), uploadedResourcesOut.size());
+        }
+
+        if (!resourcesToUpload.empty())
+            m_sleepConditionVar.notify_one();
+    }
+
     void AsyncEffectUploader::run()
     {
         LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader creating render backend for resource uploading");
@@ -183,7 +305,7 @@ namespace ramses::internal
         m_creationSuccess.set_value(true);
 
         while (!isCancelRequested())
-            uploadEffectsOrWait(*resourceUploadRenderBackend);
+            uploadOrWait(*resourceUploadRenderBackend);
 
         LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader will destroy resource upload render backend");
         m_platform.destroyResourceUploadRenderBackend();
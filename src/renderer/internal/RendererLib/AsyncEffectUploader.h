@@ -13,6 +13,7 @@
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 
 #include <unordered_map>
+#include <chrono>
 #include <future>
 #include <mutex>
 #include <condition_variable>
@@ -23,25 +24,54 @@ namespace ramses::internal
     class IRenderBackend;
     class IResourceUploadRenderBackend;
     class EffectResource;
+    class IResource;
     class IThreadAliveNotifier;
+    class WorkerThreadPool;
 
     using EffectsGpuResources = std::vector<std::pair<ResourceContentHash, std::unique_ptr<const GPUResource>>>;
     using EffectsRawResources = std::vector<const EffectResource*>;
 
+    // vertex/index arrays and textures, decompressed and uploaded in resource upload thread
+    using DataRawResources = std::vector<const IResource*>;
+
+    struct UploadedDataResource
+    {
+        ResourceContentHash hash;
+        // nullptr if upload failed
+        std::unique_ptr<const GPUResource> gpuResource;
+        uint32_t vramSize = 0u;
+        // time passed since resource was scheduled for upload until it was handed over via syncResources
+        std::chrono::microseconds latency{ 0 };
+    };
+    using DataGpuResources = std::vector<UploadedDataResource>;
+
     class AsyncEffectUploader : private Runnable
     {
     public:
-        AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display);
+        // if decompressionThreadPool is set, it is used to decompress large resources concurrently
+        AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display, WorkerThreadPool* decompressionThreadPool = nullptr);
         ~AsyncEffectUploader() override;
 
         bool createResourceUploadRenderBackendAndStartThread();
         void destroyResourceUploadRenderBackendAndStopThread();
 
         void sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut);
+        // resources handed out are guaranteed to be fully uploaded by GPU and can be registered in main render backend device
+        void syncResources(const DataRawResources& resourcesToUpload, DataGpuResources& uploadedResourcesOut);
 
     private:
+        using ScheduledDataResources = std::vector<std::pair<const IResource*, std::chrono::steady_clock::time_point>>;
+        struct UploadedDataResourceEntry
+        {
+            UploadedDataResource uploaded;
+            std::chrono::steady_clock::time_point scheduleTime;
+        };
+        using UploadedDataResourceEntries = std::vector<UploadedDataResourceEntry>;
+
         void run() override;
-        void uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        void uploadOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        void uploadEffects(IResourceUploadRenderBackend& resourceUploadRenderBackend, const EffectsRawResources& effectsToUpload);
+        void uploadDataResources(IResourceUploadRenderBackend& resourceUploadRenderBackend, const ScheduledDataResources& resourcesToUpload);
 
         IPlatform& m_platform;
         IRenderBackend& m_renderBackend;
@@ -55,11 +85,16 @@ namespace ramses::internal
 
         EffectsGpuResources m_effectsUploadedCache; //to avoid acquiring mutex twice in resource upload thread
 
+        ScheduledDataResources m_resourcesToUpload;
+        UploadedDataResourceEntries m_resourcesUploaded;
+        UploadedDataResourceEntries m_resourcesUploadedCache; //to avoid acquiring mutex twice in resource upload thread
+
         std::promise<bool> m_creationSuccess;
 
         IThreadAliveNotifier& m_notifier;
         const uint64_t m_aliveIdentifier;
 
         const DisplayHandle m_displayHandle;
+        WorkerThreadPool* m_decompressionThreadPool;
     };
 }
@@ -20,7 +20,8 @@ namespace ramses::internal
         IRendererSceneEventSender& rendererSceneSender,
         IPlatform& platform,
         IThreadAliveNotifier& notifier,
-        std::chrono::milliseconds timingReportingPeriod)
+        std::chrono::milliseconds timingReportingPeriod,
+        uint32_t sceneUpdateWorkerCount)
         : m_display(display)
         , m_rendererScenes(m_rendererEventCollector)
         , m_expirationMonitor(m_rendererScenes, m_rendererEventCollector, m_rendererStatistics)
@@ -33,6 +34,8 @@ namespace ramses::internal
         , m_timingReportingPeriod{ timingReportingPeriod }
     {
         m_rendererSceneUpdater.setSceneReferenceLogicHandler(m_sceneReferenceLogic);
+        if (sceneUpdateWorkerCount > 0u)
+            m_rendererSceneUpdater.setSceneUpdateWorkerCount(sceneUpdateWorkerCount);
     }
 
     void DisplayBundle::doOneLoop(ELoopMode loopMode, std::chrono::microseconds prevFrameSleepTime)
@@ -94,9 +97,27 @@ namespace ramses::internal
     void DisplayBundle::finishFrameStatistics(std::chrono::microseconds prevFrameSleepTime)
     {
         uint32_t drawCalls = 0u;
+        UniformUpdateCounts uniformUpdates;
         if (m_renderer.hasDisplayController())
+        {
             drawCalls = m_renderer.getDisplayController().getRenderBackend().getDevice().getAndResetDrawCallCount();
+            // cache counts since its creation (i.e. since display was created), unsigned difference
+            // is correct also when counters wrapped around
+            const ProgramUniformCache& uniformCache = m_renderer.getDisplayController().getUniformCache();
+            if (&uniformCache != m_lastUniformCache)
+                m_lastUniformUpdateCounts = {};
+            const UniformUpdateCounts& counts = uniformCache.getUpdateCounts();
+            uniformUpdates.numSet = counts.numSet - m_lastUniformUpdateCounts.numSet;
+            uniformUpdates.numSkipped = counts.numSkipped - m_lastUniformUpdateCounts.numSkipped;
+            m_lastUniformUpdateCounts = counts;
+            m_lastUniformCache = &uniformCache;
+        }
+        else
+        {
+            m_lastUniformCache = nullptr;
+        }
 
+        m_renderer.getStatistics().trackUniformUpdates(uniformUpdates.numSet, uniformUpdates.numSkipped);
         m_renderer.getStatistics().frameFinished(drawCalls);
         m_renderer.getProfilerStatistics().markFrameFinished(prevFrameSleepTime);
     }
@@ -22,6 +22,7 @@
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/ProgramUniformCache.h"
 
 namespace ramses::internal
 {
@@ -57,7 +58,8 @@ namespace ramses::internal
             IRendererSceneEventSender& rendererSceneSender,
             IPlatform& platform,
             IThreadAliveNotifier& notifier,
-            std::chrono::milliseconds timingReportingPeriod);
+            std::chrono::milliseconds timingReportingPeriod,
+            uint32_t sceneUpdateWorkerCount = 0u);
 
         void doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime) override;
 
@@ -110,5 +112,8 @@ namespace ramses::internal
         std::chrono::microseconds m_sumFrameTimes{ 0 };
         std::chrono::microseconds m_maxFrameTime{ 0 };
         size_t m_loopsWithinMeasurePeriod{ 0u };
+
+        const ProgramUniformCache* m_lastUniformCache = nullptr;
+        UniformUpdateCounts m_lastUniformUpdateCounts;
     };
 }
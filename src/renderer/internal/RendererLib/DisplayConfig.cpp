@@ -223,6 +223,37 @@ namespace ramses::internal
     {
         return m_asyncEffectUploadEnabled;
     }
+
+    void DisplayConfig::setAsyncResourceUploadEnabled(bool enabled)
+    {
+        m_asyncResourceUploadEnabled = enabled;
+    }
+
+    bool DisplayConfig::isAsyncResourceUploadEnabled() const
+    {
+        return m_asyncResourceUploadEnabled;
+    }
+
+    void DisplayConfig::setAsyncReadPixelsEnabled(bool enabled)
+    {
+        m_asyncReadPixelsEnabled = enabled;
+    }
+
+    bool DisplayConfig::isAsyncReadPixelsEnabled() const
+    {
+        return m_asyncReadPixelsEnabled;
+    }
+
+    void DisplayConfig::setRenderCommandRecordingEnabled(bool enabled)
+    {
+        m_renderCommandRecordingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isRenderCommandRecordingEnabled() const
+    {
+        return m_renderCommandRecordingEnabled;
+    }
+
     void DisplayConfig::setWaylandEmbeddedCompositingSocketName(std::string_view socket)
     {
         m_waylandSocketEmbedded = socket;
@@ -337,6 +368,9 @@ namespace ramses::internal
             m_waylandDisplay             == other.m_waylandDisplay &&
             m_depthStencilBufferType     == other.m_depthStencilBufferType &&
             m_asyncEffectUploadEnabled   == other.m_asyncEffectUploadEnabled &&
+            m_asyncResourceUploadEnabled == other.m_asyncResourceUploadEnabled &&
+            m_asyncReadPixelsEnabled == other.m_asyncReadPixelsEnabled &&
+            m_renderCommandRecordingEnabled == other.m_renderCommandRecordingEnabled &&
             m_waylandSocketEmbedded      == other.m_waylandSocketEmbedded &&
             m_waylandSocketEmbeddedGroupName    == other.m_waylandSocketEmbeddedGroupName &&
             m_waylandSocketEmbeddedPermissions  == other.m_waylandSocketEmbeddedPermissions &&
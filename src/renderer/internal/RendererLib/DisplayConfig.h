@@ -88,6 +88,15 @@ namespace ramses::internal
         void setAsyncEffectUploadEnabled(bool enabled);
         [[nodiscard]] bool isAsyncEffectUploadEnabled() const;
 
+        void setAsyncResourceUploadEnabled(bool enabled);
+        [[nodiscard]] bool isAsyncResourceUploadEnabled() const;
+
+        void setAsyncReadPixelsEnabled(bool enabled);
+        [[nodiscard]] bool isAsyncReadPixelsEnabled() const;
+
+        void setRenderCommandRecordingEnabled(bool enabled);
+        [[nodiscard]] bool isRenderCommandRecordingEnabled() const;
+
         void setWaylandEmbeddedCompositingSocketName(std::string_view socket);
         [[nodiscard]] std::string_view getWaylandSocketEmbedded() const;
 
@@ -165,6 +174,9 @@ namespace ramses::internal
         glm::vec4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
         EDepthBufferType m_depthStencilBufferType = EDepthBufferType::DepthStencil;
         bool m_asyncEffectUploadEnabled = true;
+        bool m_asyncResourceUploadEnabled = false;
+        bool m_asyncReadPixelsEnabled = false;
+        bool m_renderCommandRecordingEnabled = false;
 
         std::string m_waylandSocketEmbedded;
         std::string m_waylandSocketEmbeddedGroupName;
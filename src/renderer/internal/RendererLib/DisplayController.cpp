@@ -17,6 +17,10 @@
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/Core/Math3d/CameraMatrixHelper.h"
 #include "internal/RendererLib/RenderExecutor.h"
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/RenderCommandRecorder.h"
+
+#include <cassert>
 
 namespace ramses::internal
 {
@@ -54,11 +58,29 @@ namespace ramses::internal
 
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer)
     {
-        RenderExecutor executor(m_renderBackend.getDevice(), renderContext, frameTimer);
+        RenderExecutor executor(m_renderBackend.getDevice(), renderContext, frameTimer, &m_uniformCache);
 
         return executor.executeScene(scene);
     }
 
+    void DisplayController::recordScene(const RendererCachedScene& scene, RenderingContext& renderContext, RenderCommandList& commandList) const
+    {
+        // uniform cache holds state of the device and cannot be used when recording,
+        // redundant uniforms are recorded and set when list is executed
+        RenderCommandRecorder recorder(commandList);
+        RenderExecutor executor(recorder, renderContext);
+        // without frame timer the scene is never interrupted
+        [[maybe_unused]] const auto iterator = executor.executeScene(scene);
+        assert(iterator == SceneRenderExecutionIterator{});
+    }
+
+    void DisplayController::executeCommandList(const RenderCommandList& commandList)
+    {
+        commandList.replay(m_device);
+        // recorded uniforms were set without the cache knowing
+        m_uniformCache.invalidateValues();
+    }
+
     void DisplayController::clearBuffer(DeviceResourceHandle buffer, ClearFlags clearFlags, const glm::vec4& clearColor)
     {
         if (clearFlags != EClearFlag::None)
@@ -85,6 +107,27 @@ namespace ramses::internal
         m_device.readPixels(&dataOut[0], x, y, width, height);
     }
 
+    DeviceResourceHandle DisplayController::readPixelsAsync(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        m_device.activateRenderTarget(renderTargetHandle);
+        return m_device.readPixelsAsync(x, y, width, height);
+    }
+
+    bool DisplayController::getReadPixelsAsyncResult(DeviceResourceHandle readback, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut)
+    {
+        if (!m_device.isReadPixelsAsyncFinished(readback))
+            return false;
+
+        dataOut.resize(width * height * 4u); // Assuming RGBA8 non multisampled
+        m_device.getReadPixelsAsyncResult(readback, dataOut.data());
+        return true;
+    }
+
+    void DisplayController::discardReadPixelsAsync(DeviceResourceHandle readback)
+    {
+        m_device.getReadPixelsAsyncResult(readback, nullptr);
+    }
+
     uint32_t DisplayController::getDisplayWidth() const
     {
         return m_displayWidth;
@@ -114,4 +157,9 @@ namespace ramses::internal
     {
         m_renderBackend.getDevice().validateDeviceStatusHealthy();
     }
+
+    ProgramUniformCache& DisplayController::getUniformCache()
+    {
+        return m_uniformCache;
+    }
 }
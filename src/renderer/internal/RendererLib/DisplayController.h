@@ -35,6 +35,8 @@ namespace ramses::internal
         void                    swapBuffers() override;
         SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer) override;
         void                    clearBuffer(DeviceResourceHandle buffer, ClearFlags clearFlags, const glm::vec4& clearColor) override;
+        void                    recordScene(const RendererCachedScene& scene, RenderingContext& renderContext, RenderCommandList& commandList) const override;
+        void                    executeCommandList(const RenderCommandList& commandList) override;
 
         [[nodiscard]] DeviceResourceHandle    getDisplayBuffer() const final override;
         [[nodiscard]] IRenderBackend&         getRenderBackend() const override;
@@ -43,13 +45,19 @@ namespace ramses::internal
         [[nodiscard]] uint32_t                  getDisplayHeight() const override;
 
         void readPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) override;
+        DeviceResourceHandle readPixelsAsync(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool getReadPixelsAsyncResult(DeviceResourceHandle readback, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) override;
+        void discardReadPixelsAsync(DeviceResourceHandle readback) override;
 
         void validateRenderingStatusHealthy() const override;
 
+        ProgramUniformCache& getUniformCache() override;
+
     private:
         IRenderBackend&         m_renderBackend;
         IDevice&                m_device;
         EmbeddedCompositingManager m_embeddedCompositingManager;
+        ProgramUniformCache     m_uniformCache;
 
         const uint32_t            m_displayWidth;
         const uint32_t            m_displayHeight;
@@ -194,7 +194,8 @@ namespace ramses::internal
             m_rendererSceneSender,
             *bundle.platform,
             m_notifier,
-            m_rendererConfig.getRenderThreadLoopTimingReportingPeriod())
+            m_rendererConfig.getRenderThreadLoopTimingReportingPeriod(),
+            m_rendererConfig.getSceneUpdateWorkerCount())
         };
         if (m_threadedDisplays)
         {
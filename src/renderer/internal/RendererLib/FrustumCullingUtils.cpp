@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/FrustumCullingUtils.h"
+#include <cassert>
+
+namespace ramses::internal
+{
+    FrustumCullingUtils::FrustumPlanes FrustumCullingUtils::ExtractFrustumPlanes(const glm::mat4& viewProjectionMatrix)
+    {
+        // Gribb/Hartmann plane extraction, works for both perspective and orthographic projection
+        const glm::mat4 m = glm::transpose(viewProjectionMatrix);
+        FrustumPlanes planes = {
+            m[3] + m[0], // left
+            m[3] - m[0], // right
+            m[3] + m[1], // bottom
+            m[3] - m[1], // top
+            m[3] + m[2], // near
+            m[3] - m[2]  // far
+        };
+
+        for (auto& plane : planes)
+        {
+            const float length = glm::length(glm::vec3(plane));
+            if (length > 0.f)
+                plane /= length;
+        }
+
+        return planes;
+    }
+
+    bool FrustumCullingUtils::IsBoundingBoxOutsideFrustum(const FrustumPlanes& frustumPlanes, const glm::mat4& modelMatrix, const BoundingBox& boundingBox)
+    {
+        assert(boundingBox.isValid());
+
+        // transform box to world space as center + extents (Arvo's method), result is conservative world space AABB
+        const glm::vec3 localCenter = (boundingBox.min + boundingBox.max) * 0.5f;
+        const glm::vec3 localExtents = (boundingBox.max - boundingBox.min) * 0.5f;
+        const glm::vec3 center = glm::vec3(modelMatrix * glm::vec4(localCenter, 1.f));
+        const glm::mat3 absRotationScale{ glm::abs(glm::vec3(modelMatrix[0])), glm::abs(glm::vec3(modelMatrix[1])), glm::abs(glm::vec3(modelMatrix[2])) };
+        const glm::vec3 extents = absRotationScale * localExtents;
+
+        for (const auto& plane : frustumPlanes)
+        {
+            const glm::vec3 normal{ plane };
+            const float distance = glm::dot(normal, center) + plane.w;
+            const float radius = glm::dot(extents, glm::abs(normal));
+            if (distance + radius < 0.f)
+                return true;
+        }
+
+        return false;
+    }
+}
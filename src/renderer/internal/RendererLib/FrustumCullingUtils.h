@@ -0,0 +1,25 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/BoundingBox.h"
+#include <array>
+
+namespace ramses::internal
+{
+    class FrustumCullingUtils
+    {
+    public:
+        // planes in form (normal, distance), normals point inside of frustum
+        using FrustumPlanes = std::array<glm::vec4, 6u>;
+
+        static FrustumPlanes ExtractFrustumPlanes(const glm::mat4& viewProjectionMatrix);
+        static bool IsBoundingBoxOutsideFrustum(const FrustumPlanes& frustumPlanes, const glm::mat4& modelMatrix, const BoundingBox& boundingBox);
+    };
+}
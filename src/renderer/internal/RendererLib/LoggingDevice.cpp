@@ -253,6 +253,18 @@ namespace ramses::internal
         return {};
     }
 
+    DeviceResourceHandle LoggingDevice::registerResource(std::unique_ptr<const GPUResource> resource)
+    {
+        m_logContext << "register resource " << resource->getGPUAddress() << RendererLogContext::NewLine;
+        return {};
+    }
+
+    std::unique_ptr<const GPUResource> LoggingDevice::releaseResource(DeviceResourceHandle handle)
+    {
+        m_logContext << "release resource [handle: " << handle << "]" << RendererLogContext::NewLine;
+        return nullptr;
+    }
+
     DeviceResourceHandle LoggingDevice::uploadBinaryShader(const EffectResource&             effect,
                                                            [[maybe_unused]] const std::byte* binaryShaderData,
                                                            uint32_t                          binaryShaderDataSize,
@@ -455,6 +467,20 @@ namespace ramses::internal
     {
     }
 
+    DeviceResourceHandle LoggingDevice::readPixelsAsync(uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/)
+    {
+        return {};
+    }
+
+    bool LoggingDevice::isReadPixelsAsyncFinished(DeviceResourceHandle /*readback*/)
+    {
+        return true;
+    }
+
+    void LoggingDevice::getReadPixelsAsyncResult(DeviceResourceHandle /*readback*/, uint8_t* /*buffer*/)
+    {
+    }
+
     uint32_t LoggingDevice::getTotalGpuMemoryUsageInKB() const
     {
         return m_deviceDelegate.getTotalGpuMemoryUsageInKB();
@@ -517,6 +543,11 @@ namespace ramses::internal
     {
     }
 
+    bool LoggingDevice::insertFenceAndWait()
+    {
+        return true;
+    }
+
     uint32_t LoggingDevice::getGPUHandle(DeviceResourceHandle /*deviceHandle*/) const
     {
         return 0u;
@@ -59,6 +59,8 @@ namespace ramses::internal
         void deleteIndexBuffer(DeviceResourceHandle handle) override;
         std::unique_ptr<const GPUResource> uploadShader(const EffectResource& effect) override;
         DeviceResourceHandle registerShader(std::unique_ptr<const GPUResource> shaderResource) override;
+        DeviceResourceHandle registerResource(std::unique_ptr<const GPUResource> resource) override;
+        std::unique_ptr<const GPUResource> releaseResource(DeviceResourceHandle handle) override;
         DeviceResourceHandle uploadBinaryShader(const EffectResource& effect, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat) override;
         bool getBinaryShader(DeviceResourceHandle handle, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         void deleteShader(DeviceResourceHandle handle) override;
@@ -99,6 +101,9 @@ namespace ramses::internal
         void                    swapDoubleBufferedRenderTarget(DeviceResourceHandle renderTarget) override;
 
         void readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        DeviceResourceHandle readPixelsAsync(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool isReadPixelsAsyncFinished(DeviceResourceHandle readback) override;
+        void getReadPixelsAsyncResult(DeviceResourceHandle readback, uint8_t* buffer) override;
 
         [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const override;
         uint32_t getAndResetDrawCallCount() override;
@@ -114,6 +119,7 @@ namespace ramses::internal
         [[nodiscard]] bool isExternalTextureExtensionSupported() const override;
 
         void flush() override;
+        bool insertFenceAndWait() override;
 
         [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
 
@@ -0,0 +1,153 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ParallelSceneActionApplier.h"
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+
+namespace ramses::internal
+{
+    ParallelSceneActionApplier::ParallelSceneActionApplier(SceneUpdateThreadPool& threadPool)
+        : m_threadPool(threadPool)
+        , m_dataValueActions(threadPool.getWorkerCount() + 1u)
+    {
+    }
+
+    void ParallelSceneActionApplier::applyActionsOnScene(IScene& scene, const SceneActionCollection& actions)
+    {
+        const uint32_t numActions = actions.numberOfActions();
+        if (numActions < MinDataValueActionsToApplyInParallel || m_threadPool.getWorkerCount() == 0u)
+        {
+            SceneActionApplier::ApplyActionsOnScene(scene, actions);
+            return;
+        }
+
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            auto action = actions[i];
+            const ESceneActionId type = action.type();
+            if (IsDataValueAction(type))
+            {
+                // every data value action starts with handle of data instance it targets
+                DataInstanceHandle dataInstance;
+                action.read(dataInstance);
+                m_dataValueActions[dataInstance.asMemoryHandle() % m_dataValueActions.size()].push_back(i);
+                ++m_numCollectedDataValueActions;
+                continue;
+            }
+
+            if (!IsIndependentOfDataValues(type))
+                applyCollectedDataValueActions(scene, actions);
+            SceneActionApplier::ApplySingleActionOnScene(scene, action);
+        }
+
+        applyCollectedDataValueActions(scene, actions);
+    }
+
+    void ParallelSceneActionApplier::applyCollectedDataValueActions(IScene& scene, const SceneActionCollection& actions)
+    {
+        if (m_numCollectedDataValueActions == 0u)
+            return;
+
+        const auto applyBucket = [&](size_t bucketIdx) {
+            auto& bucket = m_dataValueActions[bucketIdx];
+            for (const auto actionIdx : bucket)
+            {
+                auto action = actions[actionIdx];
+                SceneActionApplier::ApplySingleActionOnScene(scene, action);
+            }
+            bucket.clear();
+        };
+
+        if (m_numCollectedDataValueActions >= MinDataValueActionsToApplyInParallel)
+        {
+            m_threadPool.execute(m_dataValueActions.size(), applyBucket);
+        }
+        else
+        {
+            for (size_t i = 0u; i < m_dataValueActions.size(); ++i)
+                applyBucket(i);
+        }
+
+        m_numCollectedDataValueActions = 0u;
+    }
+
+    bool ParallelSceneActionApplier::IsDataValueAction(ESceneActionId type)
+    {
+        switch (type)
+        {
+        case ESceneActionId::SetDataBooleanArray:
+        case ESceneActionId::SetDataIntegerArray:
+        case ESceneActionId::SetDataFloatArray:
+        case ESceneActionId::SetDataVector2fArray:
+        case ESceneActionId::SetDataVector3fArray:
+        case ESceneActionId::SetDataVector4fArray:
+        case ESceneActionId::SetDataVector2iArray:
+        case ESceneActionId::SetDataVector3iArray:
+        case ESceneActionId::SetDataVector4iArray:
+        case ESceneActionId::SetDataMatrix22fArray:
+        case ESceneActionId::SetDataMatrix33fArray:
+        case ESceneActionId::SetDataMatrix44fArray:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool ParallelSceneActionApplier::IsIndependentOfDataValues(ESceneActionId type)
+    {
+        // actions which neither read data instance values nor release or reuse data instances,
+        // i.e. typical content of a large initial flush besides data values
+        switch (type)
+        {
+        case ESceneActionId::SetTranslation:
+        case ESceneActionId::SetRotation:
+        case ESceneActionId::SetScaling:
+        case ESceneActionId::AllocateNode:
+        case ESceneActionId::AllocateTransform:
+        case ESceneActionId::AddChildToNode:
+        case ESceneActionId::RemoveChildFromNode:
+        case ESceneActionId::AllocateDataLayout:
+        case ESceneActionId::AllocateDataInstance:
+        case ESceneActionId::SetDataResource:
+        case ESceneActionId::SetDataTextureSamplerHandle:
+        case ESceneActionId::SetDataReference:
+        case ESceneActionId::AllocateRenderable:
+        case ESceneActionId::SetRenderableStartIndex:
+        case ESceneActionId::SetRenderableIndexCount:
+        case ESceneActionId::SetRenderableVisibility:
+        case ESceneActionId::SetRenderableDataInstance:
+        case ESceneActionId::SetRenderableInstanceCount:
+        case ESceneActionId::SetRenderableStartVertex:
+        case ESceneActionId::SetRenderableBoundingBox:
+        case ESceneActionId::AllocateRenderState:
+        case ESceneActionId::SetRenderableState:
+        case ESceneActionId::SetStateStencilOps:
+        case ESceneActionId::SetStateStencilFunc:
+        case ESceneActionId::SetStateDepthWrite:
+        case ESceneActionId::SetStateDepthFunc:
+        case ESceneActionId::SetStateScissorTest:
+        case ESceneActionId::SetStateCullMode:
+        case ESceneActionId::SetStateDrawMode:
+        case ESceneActionId::SetStateBlendOperations:
+        case ESceneActionId::SetStateBlendFactors:
+        case ESceneActionId::SetStateBlendColor:
+        case ESceneActionId::SetStateColorWriteMask:
+        case ESceneActionId::AllocateRenderGroup:
+        case ESceneActionId::AddRenderableToRenderGroup:
+        case ESceneActionId::AddRenderGroupToRenderGroup:
+        case ESceneActionId::CompoundRenderable:
+        case ESceneActionId::CompoundRenderableEffectData:
+        case ESceneActionId::CompoundState:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
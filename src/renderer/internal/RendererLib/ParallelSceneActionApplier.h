@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/Scene/SceneActionCollection.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IScene;
+    class SceneUpdateThreadPool;
+
+    // Applies scene actions like SceneActionApplier, but distributes actions setting data instance field values to worker threads.
+    // Such an action writes only to the data instance it targets, so actions targeting different data instances are independent.
+    // They are collected per data instance (keeping their order) and applied concurrently once an action is reached which
+    // might depend on data instance values (e.g. releasing data instance or data slot), or at the end of the collection.
+    // All other actions are applied on calling thread in their original order.
+    class ParallelSceneActionApplier
+    {
+    public:
+        explicit ParallelSceneActionApplier(SceneUpdateThreadPool& threadPool);
+
+        void applyActionsOnScene(IScene& scene, const SceneActionCollection& actions);
+
+        [[nodiscard]] static bool IsDataValueAction(ESceneActionId type);
+        // true if action can be applied before data value actions preceding it in the collection
+        [[nodiscard]] static bool IsIndependentOfDataValues(ESceneActionId type);
+
+        // collecting and distributing actions has overhead, smaller amounts are applied on calling thread
+        static constexpr size_t MinDataValueActionsToApplyInParallel = 512u;
+
+    private:
+        void applyCollectedDataValueActions(IScene& scene, const SceneActionCollection& actions);
+
+        SceneUpdateThreadPool& m_threadPool;
+        // indices of collected data value actions, bucketed by data instance
+        std::vector<std::vector<uint32_t>> m_dataValueActions;
+        size_t m_numCollectedDataValueActions = 0u;
+    };
+}
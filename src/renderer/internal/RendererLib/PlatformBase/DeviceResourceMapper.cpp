@@ -52,4 +52,14 @@ namespace ramses::internal
         delete resource;
         m_resources.release(resourceHandle);
     }
+
+    std::unique_ptr<const GPUResource> DeviceResourceMapper::releaseResource(DeviceResourceHandle resourceHandle)
+    {
+        std::unique_ptr<const GPUResource> resource{ *m_resources.getMemory(resourceHandle) };
+        assert(m_memoryUsage >= resource->getTotalSizeInBytes());
+        m_memoryUsage -= resource->getTotalSizeInBytes();
+        m_resources.release(resourceHandle);
+
+        return resource;
+    }
 }
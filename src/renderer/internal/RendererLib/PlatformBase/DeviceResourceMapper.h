@@ -26,6 +26,8 @@ namespace ramses::internal
 
         DeviceResourceHandle    registerResource(std::unique_ptr<const GPUResource> resource);
         void                    deleteResource  (DeviceResourceHandle resourceHandle);
+        // removes resource from mapping without deleting it, e.g. to register it in device of another (shared) context
+        std::unique_ptr<const GPUResource> releaseResource(DeviceResourceHandle resourceHandle);
         [[nodiscard]] bool                    containsResource(DeviceResourceHandle resourceHandle) const;
         [[nodiscard]] const GPUResource&      getResource     (DeviceResourceHandle resourceHandle) const;
 
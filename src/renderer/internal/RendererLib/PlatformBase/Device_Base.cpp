@@ -38,6 +38,16 @@ namespace ramses::internal
         return m_resourceMapper.getResource(deviceHandle).getGPUAddress();
     }
 
+    DeviceResourceHandle Device_Base::registerResource(std::unique_ptr<const GPUResource> resource)
+    {
+        return m_resourceMapper.registerResource(std::move(resource));
+    }
+
+    std::unique_ptr<const GPUResource> Device_Base::releaseResource(DeviceResourceHandle handle)
+    {
+        return m_resourceMapper.releaseResource(handle);
+    }
+
     uint32_t Device_Base::getAndResetDrawCallCount()
     {
         const auto dc = m_drawCalls;
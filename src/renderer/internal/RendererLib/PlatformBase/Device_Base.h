@@ -26,6 +26,8 @@ namespace ramses::internal
         void     drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         void     drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
+        DeviceResourceHandle registerResource(std::unique_ptr<const GPUResource> resource) override;
+        std::unique_ptr<const GPUResource> releaseResource(DeviceResourceHandle handle) override;
 
         [[nodiscard]] const RendererLimits& getRendererLimits() const;
 
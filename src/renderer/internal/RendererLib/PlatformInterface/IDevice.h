@@ -48,6 +48,8 @@ namespace ramses::internal
         virtual void drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) = 0;
         virtual void drawTriangles       (int32_t startOffset, int32_t elementCount, uint32_t instanceCount) = 0;
         virtual void flush              () = 0;
+        // blocks until all previously issued commands are completed by GPU (using fence), false if waiting failed
+        virtual bool insertFenceAndWait () = 0;
 
         //states
         virtual void colorMask           (bool r, bool g, bool b, bool a) = 0;
@@ -86,6 +88,10 @@ namespace ramses::internal
         virtual void                    deleteShader                (DeviceResourceHandle handle) = 0;
         virtual void                    activateShader              (DeviceResourceHandle handle) = 0;
 
+        // transfer of resources uploaded using another device with shared context
+        virtual DeviceResourceHandle    registerResource            (std::unique_ptr<const GPUResource> resource) = 0;
+        virtual std::unique_ptr<const GPUResource> releaseResource  (DeviceResourceHandle handle) = 0;
+
         virtual DeviceResourceHandle    allocateTexture2D           (uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes) = 0;
         virtual DeviceResourceHandle    allocateTexture3D           (uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes) = 0;
         virtual DeviceResourceHandle    allocateTextureCube         (uint32_t faceSize, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes) = 0;
@@ -126,6 +132,11 @@ namespace ramses::internal
 
         // read back data, statistics, info
         virtual void readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+        // schedules read back from active render target without blocking, returns invalid handle if no readback buffer is available
+        virtual DeviceResourceHandle readPixelsAsync(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+        virtual bool isReadPixelsAsyncFinished(DeviceResourceHandle readback) = 0;
+        // copies data of finished readback to buffer (waits for GPU if not finished yet) and releases readback, buffer can be nullptr to only release
+        virtual void getReadPixelsAsyncResult(DeviceResourceHandle readback, uint8_t* buffer) = 0;
 
         [[nodiscard]] virtual uint32_t getTotalGpuMemoryUsageInKB() const = 0;
         virtual uint32_t getAndResetDrawCallCount() = 0;
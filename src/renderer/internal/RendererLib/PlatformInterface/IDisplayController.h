@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/Types.h"
 #include "internal/RendererLib/SceneRenderExecutionIterator.h"
+#include "internal/RendererLib/ProgramUniformCache.h"
 #include "internal/SceneGraph/SceneAPI/RenderState.h"
 #include "impl/DataTypesImpl.h"
 
@@ -21,6 +22,7 @@ namespace ramses::internal
     class RendererCachedScene;
     class ProjectionParams;
     class FrameTimer;
+    class RenderCommandList;
 
     class IDisplayController
     {
@@ -33,6 +35,10 @@ namespace ramses::internal
         virtual void                    swapBuffers() = 0;
         virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer) = 0;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, ClearFlags clearFlags, const glm::vec4& clearColor) = 0;
+        // records rendering commands of scene instead of executing them, does not access the device and can be called from any thread
+        // as long as the scene is not modified meanwhile
+        virtual void                    recordScene(const RendererCachedScene& scene, RenderingContext& renderContext, RenderCommandList& commandList) const = 0;
+        virtual void                    executeCommandList(const RenderCommandList& commandList) = 0;
 
         [[nodiscard]] virtual DeviceResourceHandle    getDisplayBuffer() const = 0;
         [[nodiscard]] virtual IRenderBackend&         getRenderBackend() const = 0;
@@ -41,7 +47,15 @@ namespace ramses::internal
         [[nodiscard]] virtual uint32_t                  getDisplayHeight() const = 0;
 
         virtual void readPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) = 0;
+        // non-blocking variant of readPixels, returns invalid handle if readback could not be scheduled
+        virtual DeviceResourceHandle readPixelsAsync(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+        // returns false if readback not finished yet, otherwise fills data and releases readback
+        virtual bool getReadPixelsAsyncResult(DeviceResourceHandle readback, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) = 0;
+        virtual void discardReadPixelsAsync(DeviceResourceHandle readback) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
+
+        // uniform values remembered per shader program when rendering scenes
+        virtual ProgramUniformCache&    getUniformCache() = 0;
     };
 }
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ProgramUniformCache.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    void ProgramUniformCache::activateProgram(DeviceResourceHandle program)
+    {
+        m_activeProgramValues = &m_programValues[program];
+    }
+
+    bool ProgramUniformCache::updateValue(DataFieldHandle field, const void* value, size_t byteSize)
+    {
+        assert(m_activeProgramValues != nullptr);
+        ProgramValues& programValues = *m_activeProgramValues;
+        const auto fieldIdx = field.asMemoryHandle();
+        if (fieldIdx >= programValues.size())
+            programValues.resize(fieldIdx + 1u);
+
+        UniformValue& cachedValue = programValues[fieldIdx];
+        const auto* valueBytes = static_cast<const std::byte*>(value);
+        if (cachedValue.generation == m_generation && cachedValue.data.size() == byteSize && std::equal(valueBytes, valueBytes + byteSize, cachedValue.data.cbegin()))
+        {
+            ++m_counts.numSkipped;
+            return false;
+        }
+
+        cachedValue.generation = m_generation;
+        cachedValue.data.assign(valueBytes, valueBytes + byteSize);
+        ++m_counts.numSet;
+        return true;
+    }
+
+    void ProgramUniformCache::invalidateValues()
+    {
+        ++m_generation;
+        m_activeProgramValues = nullptr;
+    }
+
+    void ProgramUniformCache::invalidateProgram(DeviceResourceHandle program)
+    {
+        const auto it = m_programValues.find(program);
+        if (it == m_programValues.end())
+            return;
+
+        if (m_activeProgramValues == &it->second)
+            m_activeProgramValues = nullptr;
+        m_programValues.erase(it);
+    }
+
+    const UniformUpdateCounts& ProgramUniformCache::getUpdateCounts() const
+    {
+        return m_counts;
+    }
+}
@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/Types.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    struct UniformUpdateCounts
+    {
+        uint32_t numSet = 0u;
+        uint32_t numSkipped = 0u;
+    };
+
+    // Remembers uniform values last set to each shader program, so that values which a program already holds
+    // do not have to be set again (uniform values are part of program state and survive switching programs and frames).
+    // Program must be invalidated whenever it is deleted or uploaded, device handles of deleted programs are reused.
+    class ProgramUniformCache
+    {
+    public:
+        // must be called whenever a different program gets activated on device
+        void activateProgram(DeviceResourceHandle program);
+
+        // returns false if active program already holds given value for given uniform, otherwise remembers value
+        [[nodiscard]] bool updateValue(DataFieldHandle field, const void* value, size_t byteSize);
+
+        // forgets all remembered values, must be called when uniforms were set on device bypassing the cache
+        void invalidateValues();
+
+        // forgets values remembered for given program, must be called when program is deleted or uploaded
+        void invalidateProgram(DeviceResourceHandle program);
+
+        // number of values set and skipped since creation, counters wrap around
+        [[nodiscard]] const UniformUpdateCounts& getUpdateCounts() const;
+
+    private:
+        struct UniformValue
+        {
+            uint64_t generation = 0u;
+            std::vector<std::byte> data;
+        };
+        using ProgramValues = std::vector<UniformValue>;
+
+        std::unordered_map<DeviceResourceHandle, ProgramValues> m_programValues;
+        ProgramValues* m_activeProgramValues = nullptr;
+        // values remembered with older generation are invalid, avoids releasing memory on invalidation
+        uint64_t m_generation = 1u;
+        UniformUpdateCounts m_counts;
+    };
+}
@@ -0,0 +1,281 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/PlatformInterface/IDevice.h"
+#include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
+#include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    class RenderCommandList::Reader
+    {
+    public:
+        explicit Reader(const std::vector<std::byte>& data)
+            : m_data(data)
+        {
+        }
+
+        [[nodiscard]] bool atEnd() const
+        {
+            return m_offset >= m_data.size();
+        }
+
+        template <typename T>
+        T read()
+        {
+            assert(m_offset + sizeof(T) <= m_data.size());
+            T value;
+            std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return value;
+        }
+
+        // array values are aligned within the stream and can be passed to device without copying
+        template <typename T>
+        const T* readArray(uint32_t count)
+        {
+            m_offset = AlignOffset(m_offset, alignof(T));
+            assert(m_offset + sizeof(T) * count <= m_data.size());
+            const auto* values = reinterpret_cast<const T*>(m_data.data() + m_offset); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) aligned in RenderCommandList::appendArray
+            m_offset += sizeof(T) * count;
+            return values;
+        }
+
+        static size_t AlignOffset(size_t offset, size_t alignment)
+        {
+            return (offset + alignment - 1u) / alignment * alignment;
+        }
+
+    private:
+        const std::vector<std::byte>& m_data;
+        size_t m_offset = 0u;
+    };
+
+    void RenderCommandList::alignTo(size_t alignment)
+    {
+        m_data.resize(Reader::AlignOffset(m_data.size(), alignment));
+    }
+
+    template <typename T>
+    void RenderCommandList::ReplayConstant(IDevice& device, Reader& reader)
+    {
+        const auto field = reader.read<DataFieldHandle>();
+        const auto count = reader.read<uint32_t>();
+        const T* values = reader.readArray<T>(count);
+        device.setConstant(field, count, values);
+    }
+
+    void RenderCommandList::replay(IDevice& device) const
+    {
+        Reader reader{ m_data };
+        while (!reader.atEnd())
+        {
+            // arguments are read into locals first, order of evaluation of function arguments is unspecified
+            switch (reader.read<ERenderCommand>())
+            {
+            case ERenderCommand::SetConstantFloat:
+                ReplayConstant<float>(device, reader);
+                break;
+            case ERenderCommand::SetConstantVec2:
+                ReplayConstant<glm::vec2>(device, reader);
+                break;
+            case ERenderCommand::SetConstantVec3:
+                ReplayConstant<glm::vec3>(device, reader);
+                break;
+            case ERenderCommand::SetConstantVec4:
+                ReplayConstant<glm::vec4>(device, reader);
+                break;
+            case ERenderCommand::SetConstantBool:
+                ReplayConstant<bool>(device, reader);
+                break;
+            case ERenderCommand::SetConstantInt:
+                ReplayConstant<int32_t>(device, reader);
+                break;
+            case ERenderCommand::SetConstantIVec2:
+                ReplayConstant<glm::ivec2>(device, reader);
+                break;
+            case ERenderCommand::SetConstantIVec3:
+                ReplayConstant<glm::ivec3>(device, reader);
+                break;
+            case ERenderCommand::SetConstantIVec4:
+                ReplayConstant<glm::ivec4>(device, reader);
+                break;
+            case ERenderCommand::SetConstantMat2:
+                ReplayConstant<glm::mat2>(device, reader);
+                break;
+            case ERenderCommand::SetConstantMat3:
+                ReplayConstant<glm::mat3>(device, reader);
+                break;
+            case ERenderCommand::SetConstantMat4:
+                ReplayConstant<glm::mat4>(device, reader);
+                break;
+            case ERenderCommand::Clear:
+                device.clear(reader.read<ClearFlags>());
+                break;
+            case ERenderCommand::DrawIndexedTriangles:
+            {
+                const auto startOffset = reader.read<int32_t>();
+                const auto elementCount = reader.read<int32_t>();
+                const auto instanceCount = reader.read<uint32_t>();
+                device.drawIndexedTriangles(startOffset, elementCount, instanceCount);
+                break;
+            }
+            case ERenderCommand::DrawTriangles:
+            {
+                const auto startOffset = reader.read<int32_t>();
+                const auto elementCount = reader.read<int32_t>();
+                const auto instanceCount = reader.read<uint32_t>();
+                device.drawTriangles(startOffset, elementCount, instanceCount);
+                break;
+            }
+            case ERenderCommand::ColorMask:
+            {
+                const auto r = reader.read<bool>();
+                const auto g = reader.read<bool>();
+                const auto b = reader.read<bool>();
+                const auto a = reader.read<bool>();
+                device.colorMask(r, g, b, a);
+                break;
+            }
+            case ERenderCommand::ClearColor:
+                device.clearColor(reader.read<glm::vec4>());
+                break;
+            case ERenderCommand::ClearDepth:
+                device.clearDepth(reader.read<float>());
+                break;
+            case ERenderCommand::ClearStencil:
+                device.clearStencil(reader.read<int32_t>());
+                break;
+            case ERenderCommand::BlendFactors:
+            {
+                const auto sourceColor = reader.read<EBlendFactor>();
+                const auto destinationColor = reader.read<EBlendFactor>();
+                const auto sourceAlpha = reader.read<EBlendFactor>();
+                const auto destinationAlpha = reader.read<EBlendFactor>();
+                device.blendFactors(sourceColor, destinationColor, sourceAlpha, destinationAlpha);
+                break;
+            }
+            case ERenderCommand::BlendOperations:
+            {
+                const auto operationColor = reader.read<EBlendOperation>();
+                const auto operationAlpha = reader.read<EBlendOperation>();
+                device.blendOperations(operationColor, operationAlpha);
+                break;
+            }
+            case ERenderCommand::BlendColor:
+                device.blendColor(reader.read<glm::vec4>());
+                break;
+            case ERenderCommand::CullMode:
+                device.cullMode(reader.read<ECullMode>());
+                break;
+            case ERenderCommand::DepthFunc:
+                device.depthFunc(reader.read<EDepthFunc>());
+                break;
+            case ERenderCommand::DepthWrite:
+                device.depthWrite(reader.read<EDepthWrite>());
+                break;
+            case ERenderCommand::ScissorTest:
+            {
+                const auto flag = reader.read<EScissorTest>();
+                const auto region = reader.read<RenderState::ScissorRegion>();
+                device.scissorTest(flag, region);
+                break;
+            }
+            case ERenderCommand::StencilFunc:
+            {
+                const auto func = reader.read<EStencilFunc>();
+                const auto ref = reader.read<uint8_t>();
+                const auto mask = reader.read<uint8_t>();
+                device.stencilFunc(func, ref, mask);
+                break;
+            }
+            case ERenderCommand::StencilOp:
+            {
+                const auto sfail = reader.read<EStencilOp>();
+                const auto dpfail = reader.read<EStencilOp>();
+                const auto dppass = reader.read<EStencilOp>();
+                device.stencilOp(sfail, dpfail, dppass);
+                break;
+            }
+            case ERenderCommand::DrawMode:
+                device.drawMode(reader.read<EDrawMode>());
+                break;
+            case ERenderCommand::SetViewport:
+            {
+                const auto x = reader.read<int32_t>();
+                const auto y = reader.read<int32_t>();
+                const auto width = reader.read<uint32_t>();
+                const auto height = reader.read<uint32_t>();
+                device.setViewport(x, y, width, height);
+                break;
+            }
+            case ERenderCommand::ActivateVertexArray:
+                device.activateVertexArray(reader.read<DeviceResourceHandle>());
+                break;
+            case ERenderCommand::ActivateShader:
+                device.activateShader(reader.read<DeviceResourceHandle>());
+                break;
+            case ERenderCommand::ActivateTexture:
+            {
+                const auto handle = reader.read<DeviceResourceHandle>();
+                const auto field = reader.read<DataFieldHandle>();
+                device.activateTexture(handle, field);
+                break;
+            }
+            case ERenderCommand::ActivateTextureSamplerObject:
+            {
+                const auto samplerStates = reader.read<TextureSamplerStates>();
+                const auto field = reader.read<DataFieldHandle>();
+                device.activateTextureSamplerObject(samplerStates, field);
+                break;
+            }
+            case ERenderCommand::ActivateRenderTarget:
+                device.activateRenderTarget(reader.read<DeviceResourceHandle>());
+                break;
+            case ERenderCommand::DiscardDepthStencil:
+                device.discardDepthStencil();
+                break;
+            case ERenderCommand::BlitRenderTargets:
+            {
+                const auto rtSrc = reader.read<DeviceResourceHandle>();
+                const auto rtDst = reader.read<DeviceResourceHandle>();
+                const auto srcRect = reader.read<PixelRectangle>();
+                const auto dstRect = reader.read<PixelRectangle>();
+                const auto colorOnly = reader.read<bool>();
+                device.blitRenderTargets(rtSrc, rtDst, srcRect, dstRect, colorOnly);
+                break;
+            }
+            }
+        }
+    }
+
+    void RenderCommandList::clear()
+    {
+        // keep capacity, lists are typically re-recorded with similar content
+        m_data.clear();
+        m_commandCount = 0u;
+    }
+
+    bool RenderCommandList::empty() const
+    {
+        return m_commandCount == 0u;
+    }
+
+    uint32_t RenderCommandList::getCommandCount() const
+    {
+        return m_commandCount;
+    }
+
+    size_t RenderCommandList::getDataSize() const
+    {
+        return m_data.size();
+    }
+}
@@ -0,0 +1,131 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IDevice;
+
+    enum class ERenderCommand : uint8_t
+    {
+        SetConstantFloat,
+        SetConstantVec2,
+        SetConstantVec3,
+        SetConstantVec4,
+        SetConstantBool,
+        SetConstantInt,
+        SetConstantIVec2,
+        SetConstantIVec3,
+        SetConstantIVec4,
+        SetConstantMat2,
+        SetConstantMat3,
+        SetConstantMat4,
+
+        Clear,
+        DrawIndexedTriangles,
+        DrawTriangles,
+
+        ColorMask,
+        ClearColor,
+        ClearDepth,
+        ClearStencil,
+        BlendFactors,
+        BlendOperations,
+        BlendColor,
+        CullMode,
+        DepthFunc,
+        DepthWrite,
+        ScissorTest,
+        StencilFunc,
+        StencilOp,
+        DrawMode,
+        SetViewport,
+
+        ActivateVertexArray,
+        ActivateShader,
+        ActivateTexture,
+        ActivateTextureSamplerObject,
+        ActivateRenderTarget,
+        DiscardDepthStencil,
+        BlitRenderTargets,
+    };
+
+    // Compact device agnostic stream of rendering commands (render states, uniform values, draw calls).
+    // Commands are appended by RenderCommandRecorder and can be replayed to any IDevice any number of times.
+    // Every command is stored as its type followed by its arguments, uniform values are copied into the stream
+    // so that the list does not reference any scene memory.
+    class RenderCommandList
+    {
+    public:
+        template <typename... Args>
+        void append(ERenderCommand command, const Args&... args);
+        template <typename T>
+        void appendArray(const T* values, uint32_t count);
+
+        void replay(IDevice& device) const;
+        void clear();
+
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] uint32_t getCommandCount() const;
+        [[nodiscard]] size_t getDataSize() const;
+
+    private:
+        class Reader;
+
+        template <typename T>
+        void write(const T& value);
+        void alignTo(size_t alignment);
+
+        template <typename T>
+        static void ReplayConstant(IDevice& device, Reader& reader);
+
+        // arrays are aligned to this within the stream, data of std::vector is allocated with at least this alignment
+        static constexpr size_t ArrayAlignment = alignof(std::max_align_t);
+
+        std::vector<std::byte> m_data;
+        uint32_t m_commandCount = 0u;
+    };
+
+    template <typename... Args>
+    void RenderCommandList::append(ERenderCommand command, const Args&... args)
+    {
+        write(command);
+        (write(args), ...);
+        ++m_commandCount;
+    }
+
+    template <typename T>
+    void RenderCommandList::appendArray(const T* values, uint32_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be stored in command list");
+        static_assert(alignof(T) <= ArrayAlignment, "unsupported alignment");
+        write(count);
+        alignTo(alignof(T));
+        const size_t size = sizeof(T) * count;
+        const size_t offset = m_data.size();
+        m_data.resize(offset + size);
+        if (size > 0u)
+            std::memcpy(m_data.data() + offset, values, size);
+    }
+
+    template <typename T>
+    void RenderCommandList::write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only trivially copyable values can be stored in command list");
+        const size_t offset = m_data.size();
+        m_data.resize(offset + sizeof(T));
+        std::memcpy(m_data.data() + offset, &value, sizeof(T));
+    }
+}
@@ -0,0 +1,503 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandRecorder.h"
+#include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
+#include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <cassert>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        void ReportUnsupportedCall(const char* methodName)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RenderCommandRecorder::{}: not supported while recording render commands", methodName);
+            assert(false);
+        }
+    }
+
+    RenderCommandRecorder::RenderCommandRecorder(RenderCommandList& commandList)
+        : m_commandList(commandList)
+    {
+    }
+
+    template <typename T>
+    bool RenderCommandRecorder::recordConstant(ERenderCommand command, DataFieldHandle field, uint32_t count, const T* value)
+    {
+        m_commandList.append(command, field);
+        m_commandList.appendArray(value, count);
+        return true;
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const float* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantFloat, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::vec2* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantVec2, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::vec3* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantVec3, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::vec4* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantVec4, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const bool* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantBool, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const int32_t* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantInt, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec2* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantIVec2, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec3* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantIVec3, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec4* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantIVec4, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::mat2* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantMat2, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::mat3* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantMat3, field, count, value);
+    }
+
+    bool RenderCommandRecorder::setConstant(DataFieldHandle field, uint32_t count, const glm::mat4* value)
+    {
+        return recordConstant(ERenderCommand::SetConstantMat4, field, count, value);
+    }
+
+    void RenderCommandRecorder::colorMask(bool r, bool g, bool b, bool a)
+    {
+        m_commandList.append(ERenderCommand::ColorMask, r, g, b, a);
+    }
+
+    void RenderCommandRecorder::clearColor(const glm::vec4& clearColor)
+    {
+        m_commandList.append(ERenderCommand::ClearColor, clearColor);
+    }
+
+    void RenderCommandRecorder::blendOperations(EBlendOperation colorOperation, EBlendOperation alphaOperation)
+    {
+        m_commandList.append(ERenderCommand::BlendOperations, colorOperation, alphaOperation);
+    }
+
+    void RenderCommandRecorder::blendFactors(EBlendFactor sourceColor, EBlendFactor destinationColor, EBlendFactor sourceAlpha, EBlendFactor destinationAlpha)
+    {
+        m_commandList.append(ERenderCommand::BlendFactors, sourceColor, destinationColor, sourceAlpha, destinationAlpha);
+    }
+
+    void RenderCommandRecorder::blendColor(const glm::vec4& color)
+    {
+        m_commandList.append(ERenderCommand::BlendColor, color);
+    }
+
+    void RenderCommandRecorder::cullMode(ECullMode mode)
+    {
+        m_commandList.append(ERenderCommand::CullMode, mode);
+    }
+
+    void RenderCommandRecorder::depthFunc(EDepthFunc func)
+    {
+        m_commandList.append(ERenderCommand::DepthFunc, func);
+    }
+
+    void RenderCommandRecorder::depthWrite(EDepthWrite flag)
+    {
+        m_commandList.append(ERenderCommand::DepthWrite, flag);
+    }
+
+    void RenderCommandRecorder::scissorTest(EScissorTest flag, const RenderState::ScissorRegion& region)
+    {
+        m_commandList.append(ERenderCommand::ScissorTest, flag, region);
+    }
+
+    void RenderCommandRecorder::stencilFunc(EStencilFunc func, uint8_t ref, uint8_t mask)
+    {
+        m_commandList.append(ERenderCommand::StencilFunc, func, ref, mask);
+    }
+
+    void RenderCommandRecorder::stencilOp(EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
+    {
+        m_commandList.append(ERenderCommand::StencilOp, sfail, dpfail, dppass);
+    }
+
+    void RenderCommandRecorder::drawMode(EDrawMode mode)
+    {
+        m_commandList.append(ERenderCommand::DrawMode, mode);
+    }
+
+    void RenderCommandRecorder::setViewport(int32_t x, int32_t y, uint32_t width, uint32_t height)
+    {
+        m_commandList.append(ERenderCommand::SetViewport, x, y, width, height);
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateVertexBuffer(uint32_t /*totalSizeInBytes*/)
+    {
+        ReportUnsupportedCall("allocateVertexBuffer");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::uploadVertexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/)
+    {
+        ReportUnsupportedCall("uploadVertexBufferData");
+    }
+
+    void RenderCommandRecorder::deleteVertexBuffer(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteVertexBuffer");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateVertexArray(const VertexArrayInfo& /*vertexArrayInfo*/)
+    {
+        ReportUnsupportedCall("allocateVertexArray");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::activateVertexArray(DeviceResourceHandle handle)
+    {
+        m_commandList.append(ERenderCommand::ActivateVertexArray, handle);
+    }
+
+    void RenderCommandRecorder::deleteVertexArray(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteVertexArray");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateIndexBuffer(EDataType /*dataType*/, uint32_t /*sizeInBytes*/)
+    {
+        ReportUnsupportedCall("allocateIndexBuffer");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::uploadIndexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/)
+    {
+        ReportUnsupportedCall("uploadIndexBufferData");
+    }
+
+    void RenderCommandRecorder::deleteIndexBuffer(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteIndexBuffer");
+    }
+
+    std::unique_ptr<const GPUResource> RenderCommandRecorder::uploadShader(const EffectResource& /*effect*/)
+    {
+        ReportUnsupportedCall("uploadShader");
+        return nullptr;
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::registerShader(std::unique_ptr<const GPUResource> /*shaderResource*/)
+    {
+        ReportUnsupportedCall("registerShader");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::registerResource(std::unique_ptr<const GPUResource> /*resource*/)
+    {
+        ReportUnsupportedCall("registerResource");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    std::unique_ptr<const GPUResource> RenderCommandRecorder::releaseResource(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("releaseResource");
+        return nullptr;
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadBinaryShader(const EffectResource& /*effect*/, const std::byte* /*binaryShaderData*/, uint32_t /*binaryShaderDataSize*/, BinaryShaderFormatID /*binaryShaderFormat*/)
+    {
+        ReportUnsupportedCall("uploadBinaryShader");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    bool RenderCommandRecorder::getBinaryShader(DeviceResourceHandle /*handle*/, std::vector<std::byte>& /*binaryShader*/, BinaryShaderFormatID& /*binaryShaderFormat*/)
+    {
+        ReportUnsupportedCall("getBinaryShader");
+        return false;
+    }
+
+    void RenderCommandRecorder::deleteShader(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteShader");
+    }
+
+    void RenderCommandRecorder::activateShader(DeviceResourceHandle handle)
+    {
+        m_commandList.append(ERenderCommand::ActivateShader, handle);
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateTexture2D(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/)
+    {
+        ReportUnsupportedCall("allocateTexture2D");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateTexture3D(uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, EPixelStorageFormat /*textureFormat*/, uint32_t /*mipLevelCount*/, uint32_t /*dataSize*/)
+    {
+        ReportUnsupportedCall("allocateTexture3D");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateTextureCube(uint32_t /*faceSize*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*dataSize*/)
+    {
+        ReportUnsupportedCall("allocateTextureCube");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::allocateExternalTexture()
+    {
+        ReportUnsupportedCall("allocateExternalTexture");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::getEmptyExternalTexture() const
+    {
+        ReportUnsupportedCall("getEmptyExternalTexture");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::bindTexture(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("bindTexture");
+    }
+
+    void RenderCommandRecorder::generateMipmaps(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("generateMipmaps");
+    }
+
+    void RenderCommandRecorder::uploadTextureData(DeviceResourceHandle /*handle*/, uint32_t /*mipLevel*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*z*/, uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, const std::byte* /*data*/, uint32_t /*dataSize*/, uint32_t /*stride*/)
+    {
+        ReportUnsupportedCall("uploadTextureData");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadStreamTexture2D(DeviceResourceHandle /*handle*/, uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, const std::byte* /*data*/, const TextureSwizzleArray& /*swizzle*/)
+    {
+        ReportUnsupportedCall("uploadStreamTexture2D");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::deleteTexture(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteTexture");
+    }
+
+    void RenderCommandRecorder::activateTexture(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        m_commandList.append(ERenderCommand::ActivateTexture, handle, field);
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, ERenderBufferAccessMode /*accessMode*/, uint32_t /*sampleCount*/)
+    {
+        ReportUnsupportedCall("uploadRenderBuffer");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::deleteRenderBuffer(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteRenderBuffer");
+    }
+
+    void RenderCommandRecorder::activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field)
+    {
+        m_commandList.append(ERenderCommand::ActivateTextureSamplerObject, samplerStates, field);
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadDmaRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, DmaBufferFourccFormat /*format*/, DmaBufferUsageFlags /*bufferUsage*/, DmaBufferModifiers /*bufferModifiers*/)
+    {
+        ReportUnsupportedCall("uploadDmaRenderBuffer");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    int RenderCommandRecorder::getDmaRenderBufferFD(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("getDmaRenderBufferFD");
+        return -1;
+    }
+
+    uint32_t RenderCommandRecorder::getDmaRenderBufferStride(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("getDmaRenderBufferStride");
+        return 0u;
+    }
+
+    void RenderCommandRecorder::destroyDmaRenderBuffer(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("destroyDmaRenderBuffer");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::getFramebufferRenderTarget() const
+    {
+        ReportUnsupportedCall("getFramebufferRenderTarget");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::uploadRenderTarget(const DeviceHandleVector& /*renderBuffers*/)
+    {
+        ReportUnsupportedCall("uploadRenderTarget");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandRecorder::activateRenderTarget(DeviceResourceHandle handle)
+    {
+        m_commandList.append(ERenderCommand::ActivateRenderTarget, handle);
+    }
+
+    void RenderCommandRecorder::deleteRenderTarget(DeviceResourceHandle /*handle*/)
+    {
+        ReportUnsupportedCall("deleteRenderTarget");
+    }
+
+    void RenderCommandRecorder::discardDepthStencil()
+    {
+        m_commandList.append(ERenderCommand::DiscardDepthStencil);
+    }
+
+    void RenderCommandRecorder::blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, bool colorOnly)
+    {
+        m_commandList.append(ERenderCommand::BlitRenderTargets, rtSrc, rtDst, srcRect, dstRect, colorOnly);
+    }
+
+    void RenderCommandRecorder::drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount)
+    {
+        m_commandList.append(ERenderCommand::DrawIndexedTriangles, startOffset, elementCount, instanceCount);
+    }
+
+    void RenderCommandRecorder::drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount)
+    {
+        m_commandList.append(ERenderCommand::DrawTriangles, startOffset, elementCount, instanceCount);
+    }
+
+    void RenderCommandRecorder::clear(ClearFlags clearFlags)
+    {
+        m_commandList.append(ERenderCommand::Clear, clearFlags);
+    }
+
+    void RenderCommandRecorder::pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& /*renderTargets*/, const std::array<DeviceResourceHandle, 2>& /*colorBuffers*/)
+    {
+        ReportUnsupportedCall("pairRenderTargetsForDoubleBuffering");
+    }
+
+    void RenderCommandRecorder::unpairRenderTargets(DeviceResourceHandle /*renderTarget*/)
+    {
+        ReportUnsupportedCall("unpairRenderTargets");
+    }
+
+    void RenderCommandRecorder::swapDoubleBufferedRenderTarget(DeviceResourceHandle /*renderTarget*/)
+    {
+        ReportUnsupportedCall("swapDoubleBufferedRenderTarget");
+    }
+
+    void RenderCommandRecorder::readPixels(uint8_t* /*buffer*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/)
+    {
+        ReportUnsupportedCall("readPixels");
+    }
+
+    DeviceResourceHandle RenderCommandRecorder::readPixelsAsync(uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/)
+    {
+        ReportUnsupportedCall("readPixelsAsync");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    bool RenderCommandRecorder::isReadPixelsAsyncFinished(DeviceResourceHandle /*readback*/)
+    {
+        ReportUnsupportedCall("isReadPixelsAsyncFinished");
+        return false;
+    }
+
+    void RenderCommandRecorder::getReadPixelsAsyncResult(DeviceResourceHandle /*readback*/, uint8_t* /*buffer*/)
+    {
+        ReportUnsupportedCall("getReadPixelsAsyncResult");
+    }
+
+    uint32_t RenderCommandRecorder::getTotalGpuMemoryUsageInKB() const
+    {
+        return 0u;
+    }
+
+    uint32_t RenderCommandRecorder::getAndResetDrawCallCount()
+    {
+        return 0u;
+    }
+
+    void RenderCommandRecorder::clearDepth(float d)
+    {
+        m_commandList.append(ERenderCommand::ClearDepth, d);
+    }
+
+    void RenderCommandRecorder::clearStencil(int32_t s)
+    {
+        m_commandList.append(ERenderCommand::ClearStencil, s);
+    }
+
+    uint32_t RenderCommandRecorder::getTextureAddress(DeviceResourceHandle /*handle*/) const
+    {
+        ReportUnsupportedCall("getTextureAddress");
+        return 0u;
+    }
+
+    void RenderCommandRecorder::validateDeviceStatusHealthy() const
+    {
+    }
+
+    bool RenderCommandRecorder::isDeviceStatusHealthy() const
+    {
+        return true;
+    }
+
+    void RenderCommandRecorder::getSupportedBinaryProgramFormats(std::vector<BinaryShaderFormatID>& /*formats*/) const
+    {
+    }
+
+    bool RenderCommandRecorder::isExternalTextureExtensionSupported() const
+    {
+        return false;
+    }
+
+    void RenderCommandRecorder::flush()
+    {
+        ReportUnsupportedCall("flush");
+    }
+
+    bool RenderCommandRecorder::insertFenceAndWait()
+    {
+        ReportUnsupportedCall("insertFenceAndWait");
+        return false;
+    }
+
+    uint32_t RenderCommandRecorder::getGPUHandle(DeviceResourceHandle /*deviceHandle*/) const
+    {
+        ReportUnsupportedCall("getGPUHandle");
+        return 0u;
+    }
+}
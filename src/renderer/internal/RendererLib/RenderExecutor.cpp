@@ -9,6 +9,7 @@
 #include "internal/RendererLib/RenderExecutor.h"
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
+#include "internal/RendererLib/ProgramUniformCache.h"
 #include "internal/SceneGraph/SceneAPI/BlitPass.h"
 #include "internal/Components/EffectUniformTime.h"
 
@@ -16,8 +17,9 @@ namespace ramses::internal
 {
     uint32_t RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer, ProgramUniformCache* uniformCache)
         : m_state(device, renderContext, frameTimer)
+        , m_uniformCache(uniformCache)
     {
     }
 
@@ -98,7 +100,7 @@ namespace ramses::internal
             }
         }
 
-        const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
+        const RenderableVector& orderedRenderables = scene.getVisibleRenderablesForPass(pass);
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
@@ -219,7 +221,11 @@ namespace ramses::internal
         assert(uniformData.isValid());
 
         if (m_state.shaderDeviceHandle.hasChanged())
+        {
             device.activateShader(m_state.shaderDeviceHandle.getState());
+            if (m_uniformCache)
+                m_uniformCache->activateProgram(m_state.shaderDeviceHandle.getState());
+        }
 
         device.activateVertexArray(m_state.vertexArrayDeviceHandle);
 
@@ -243,6 +249,15 @@ namespace ramses::internal
         }
     }
 
+    template <typename T>
+    void RenderExecutor::setConstant(DataFieldHandle uniformInputField, uint32_t elementCount, const T* value) const
+    {
+        if (m_uniformCache && !m_uniformCache->updateValue(uniformInputField, value, elementCount * sizeof(T)))
+            return;
+
+        m_state.getDevice().setConstant(uniformInputField, elementCount, value);
+    }
+
     void RenderExecutor::executeConstant(EDataType dataType, uint32_t elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const
     {
         IDevice& device = m_state.getDevice();
@@ -253,84 +268,84 @@ namespace ramses::internal
         case EDataType::Float:
         {
             const float* value = renderScene.getDataFloatArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Vector2F:
         {
             const auto* value = renderScene.getDataVector2fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Vector3F:
         {
             const auto* value = renderScene.getDataVector3fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Vector4F:
         {
             const auto* value = renderScene.getDataVector4fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Matrix22F:
         {
             const auto* value = renderScene.getDataMatrix22fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Matrix33F:
         {
             const auto* value = renderScene.getDataMatrix33fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Matrix44F:
         {
             const auto* value = renderScene.getDataMatrix44fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Bool:
         {
             const bool* value = renderScene.getDataBooleanArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Int32:
         {
             const int32_t* value = renderScene.getDataIntegerArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Vector2I:
         {
             const glm::ivec2* value = renderScene.getDataVector2iArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Vector3I:
         {
             const auto* value = renderScene.getDataVector3iArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType::Vector4I:
         {
             const auto* value = renderScene.getDataVector4iArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
@@ -18,11 +18,13 @@ namespace ramses::internal
     struct RenderingContext;
     class FrameTimer;
     class IScene;
+    class ProgramUniformCache;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr);
+        // if uniform cache is provided, uniform values which the shader program already holds are not set again
+        RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr, ProgramUniformCache* uniformCache = nullptr);
 
         [[nodiscard]] SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene) const;
 
@@ -39,6 +41,8 @@ namespace ramses::internal
         void executeEffectAndInputs () const;
         void executeConstant        (EDataType dataType, uint32_t elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const;
         void executeDrawCall        () const;
+        template <typename T>
+        void setConstant            (DataFieldHandle uniformInputField, uint32_t elementCount, const T* value) const;
 
         void setGlobalInternalStates    (const RendererCachedScene& scene) const;
         void setRenderableInternalStates(RenderableHandle renderableHandle) const;
@@ -50,6 +54,8 @@ namespace ramses::internal
         void executeCamera(CameraHandle camera) const;
 
     private:
+        ProgramUniformCache* m_uniformCache;
+
         [[nodiscard]] bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
         [[nodiscard]] bool canDiscardDepthBuffer() const;
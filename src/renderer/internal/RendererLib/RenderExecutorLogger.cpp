@@ -55,6 +55,8 @@ namespace ramses::internal
         const RenderPass& rp = scene.getRenderPass(pass);
         if (rp.isRenderOnce)
             m_logContext << " - 'render once' pass" << RendererLogContext::NewLine;
+        if (rp.isStateSortingEnabled)
+            m_logContext << " - 'state sorted' pass" << RendererLogContext::NewLine;
         m_logContext.indent();
 
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
@@ -21,6 +21,7 @@
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/RendererLib/DisplayEventHandler.h"
 #include "internal/RendererLib/SceneExpirationMonitor.h"
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
 #include "internal/RendererLib/PlatformBase/Platform_Base.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include <algorithm>
@@ -67,6 +68,7 @@ namespace ramses::internal
         assert(!hasAnyBufferWithInterruptedRendering());
         m_displayBuffersSetup.unregisterDisplayBuffer(bufferDeviceHandle);
         m_statistics.untrackOffscreenBuffer(bufferDeviceHandle);
+        discardPendingScreenshotReadback(bufferDeviceHandle);
         m_screenshots.erase(bufferDeviceHandle);
     }
 
@@ -104,6 +106,8 @@ namespace ramses::internal
             return;
         }
 
+        m_asyncReadPixelsEnabled = displayConfig.isAsyncReadPixelsEnabled();
+        m_renderCommandRecordingEnabled = displayConfig.isRenderCommandRecordingEnabled();
         m_frameBufferDeviceHandle = m_displayController->getDisplayBuffer();
         m_displayBuffersSetup.registerDisplayBuffer(m_frameBufferDeviceHandle, { 0, 0, m_displayController->getDisplayWidth(), m_displayController->getDisplayHeight() }, DefaultClearColor, false, false);
         setClearColor(m_frameBufferDeviceHandle, displayConfig.getClearColor());
@@ -119,6 +123,19 @@ namespace ramses::internal
         if (m_platform.getSystemCompositorController() != nullptr)
             systemCompositorDestroyIviSurface(m_displayController->getRenderBackend().getWindow().getWaylandIviSurfaceID());
 
+        // screenshots with read back in flight cannot be finished without device
+        for (auto it = m_screenshots.begin(); it != m_screenshots.end();)
+        {
+            if (it->second.pendingReadback.isValid())
+            {
+                m_displayController->discardReadPixelsAsync(it->second.pendingReadback);
+                it = m_screenshots.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        m_recordedScenes.clear();
         m_displayController.reset();
         m_platform.destroyRenderBackend();
     }
@@ -280,13 +297,26 @@ namespace ramses::internal
         if (!hasAnyShownScene)
             m_displayController->clearBuffer(m_frameBufferDeviceHandle, displayBufferInfo.clearFlags, displayBufferInfo.clearColor);
 
-        for (const auto& sceneInfo : assignedScenes)
+        if (m_renderCommandRecordingEnabled)
         {
-            if (sceneInfo.shown)
+            m_tempScenesToRender.clear();
+            for (const auto& sceneInfo : assignedScenes)
             {
-                const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                m_displayController->renderScene(scene, renderContext, nullptr);
-                onSceneWasRendered(scene);
+                if (sceneInfo.shown)
+                    m_tempScenesToRender.push_back(sceneInfo.sceneId);
+            }
+            renderScenesUsingCommandLists(renderContext, false);
+        }
+        else
+        {
+            for (const auto& sceneInfo : assignedScenes)
+            {
+                if (sceneInfo.shown)
+                {
+                    const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
+                    m_displayController->renderScene(scene, renderContext, nullptr);
+                    onSceneWasRendered(scene);
+                }
             }
         }
 
@@ -327,16 +357,23 @@ namespace ramses::internal
             if (m_tempScenesToRender.empty())
                 m_displayController->clearBuffer(displayBuffer, displayBufferInfo.clearFlags, displayBufferInfo.clearColor);
 
-            for (const auto& sceneId : m_tempScenesToRender)
+            // offscreen buffer depth component may be discarded after last scene rendered into it and it is not kept for next frame (clear is enabled)
+            const bool canDiscardDepth = displayBufferInfo.clearFlags.isSet(EClearFlag::Depth) && displayBufferInfo.clearFlags.isSet(EClearFlag::Stencil);
+            if (m_renderCommandRecordingEnabled)
             {
-                // offscreen buffer depth component may be discarded after last scene rendered into it and it is not kept for next frame (clear is enabled)
-                if (sceneId == m_tempScenesToRender.back()
-                    && displayBufferInfo.clearFlags.isSet(EClearFlag::Depth) && displayBufferInfo.clearFlags.isSet(EClearFlag::Stencil))
-                    renderContext.displayBufferDepthDiscard = true;
+                renderScenesUsingCommandLists(renderContext, canDiscardDepth);
+            }
+            else
+            {
+                for (const auto& sceneId : m_tempScenesToRender)
+                {
+                    if (sceneId == m_tempScenesToRender.back() && canDiscardDepth)
+                        renderContext.displayBufferDepthDiscard = true;
 
-                const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
-                m_displayController->renderScene(scene, renderContext, nullptr);
-                onSceneWasRendered(scene);
+                    const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
+                    m_displayController->renderScene(scene, renderContext, nullptr);
+                    onSceneWasRendered(scene);
+                }
             }
 
             processScheduledScreenshots(displayBuffer);
@@ -481,6 +518,65 @@ namespace ramses::internal
         scene.markAllRenderOncePassesAsRendered();
         m_expirationMonitor.onRendered(scene.getSceneId());
         m_statistics.sceneRendered(scene.getSceneId());
+        m_statistics.trackRenderablesCulling(scene.getSceneId(), scene.getNumCulledRenderables(), scene.getNumVisibleRenderables());
+        m_statistics.trackStateSwitches(scene.getSceneId(), scene.getNumStateSwitches());
+    }
+
+    void Renderer::renderScenesUsingCommandLists(const RenderingContext& bufferContext, bool discardDepthAfterLastScene)
+    {
+        if (m_tempScenesToRender.empty())
+            return;
+
+        // display buffer is cleared upfront instead of by first render pass rendering into it,
+        // this way commands recorded for a scene do not depend on other scenes and can be reused
+        m_displayController->clearBuffer(bufferContext.displayBufferDeviceHandle, bufferContext.displayBufferClearPending, bufferContext.displayBufferClearColor);
+
+        m_tempScenesToRecord.clear();
+        for (const auto sceneId : m_tempScenesToRender)
+        {
+            const bool depthDiscard = discardDepthAfterLastScene && sceneId == m_tempScenesToRender.back();
+            auto& recordedScene = m_recordedScenes[sceneId];
+            const bool canReuse = recordedScene.valid
+                && recordedScene.displayBuffer == bufferContext.displayBufferDeviceHandle
+                && recordedScene.viewportWidth == bufferContext.viewportWidth
+                && recordedScene.viewportHeight == bufferContext.viewportHeight
+                && recordedScene.depthDiscard == depthDiscard
+                && !m_rendererScenes.getScene(sceneId).hasRenderOncePassesToRender();
+            if (!canReuse)
+            {
+                recordedScene.commandList.clear();
+                recordedScene.displayBuffer = bufferContext.displayBufferDeviceHandle;
+                recordedScene.viewportWidth = bufferContext.viewportWidth;
+                recordedScene.viewportHeight = bufferContext.viewportHeight;
+                recordedScene.depthDiscard = depthDiscard;
+                m_tempScenesToRecord.push_back(sceneId);
+            }
+        }
+
+        // recording does not touch the device and scenes are not modified during rendering, so scenes can be recorded concurrently
+        const auto recordScene = [this](SceneId sceneId) {
+            auto& recordedScene = m_recordedScenes.find(sceneId)->second;
+            RenderingContext renderContext;
+            renderContext.displayBufferDeviceHandle = recordedScene.displayBuffer;
+            renderContext.viewportWidth = recordedScene.viewportWidth;
+            renderContext.viewportHeight = recordedScene.viewportHeight;
+            renderContext.displayBufferDepthDiscard = recordedScene.depthDiscard;
+            m_displayController->recordScene(m_rendererScenes.getScene(sceneId), renderContext, recordedScene.commandList);
+        };
+        if (m_renderCommandRecordingThreadPool != nullptr && m_tempScenesToRecord.size() > 1u)
+            m_renderCommandRecordingThreadPool->execute(m_tempScenesToRecord, recordScene);
+        else
+            std::for_each(m_tempScenesToRecord.cbegin(), m_tempScenesToRecord.cend(), recordScene);
+
+        for (const auto sceneId : m_tempScenesToRender)
+        {
+            const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
+            auto& recordedScene = m_recordedScenes.find(sceneId)->second;
+            m_displayController->executeCommandList(recordedScene.commandList);
+            // render once passes and shader animations make scene render differently next time even if not modified
+            recordedScene.valid = !scene.hasRenderOncePassesToRender() && !scene.hasActiveShaderAnimation();
+            onSceneWasRendered(scene);
+        }
     }
 
     void Renderer::assignSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle buffer, int32_t globalSceneOrder)
@@ -496,6 +592,7 @@ namespace ramses::internal
     {
         assert(m_rendererScenes.hasScene(sceneId));
         m_displayBuffersSetup.unassignScene(sceneId);
+        m_recordedScenes.erase(sceneId);
     }
 
     void Renderer::setSceneShown(SceneId sceneId, bool show)
@@ -512,6 +609,18 @@ namespace ramses::internal
         m_displayBuffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
     }
 
+    void Renderer::markSceneModified(SceneId sceneId)
+    {
+        const auto it = m_recordedScenes.find(sceneId);
+        if (it != m_recordedScenes.end())
+            it->second.valid = false;
+    }
+
+    void Renderer::setRenderCommandRecordingThreadPool(SceneUpdateThreadPool* threadPool)
+    {
+        m_renderCommandRecordingThreadPool = threadPool;
+    }
+
     DeviceResourceHandle Renderer::getBufferSceneIsAssignedTo(SceneId sceneId) const
     {
         return m_displayBuffersSetup.findDisplayBufferSceneIsAssignedTo(sceneId);
@@ -612,7 +721,10 @@ namespace ramses::internal
     {
         assert(hasDisplayController());
         if (m_screenshots.count(renderTargetHandle) != 0u)
+        {
             LOG_WARN(CONTEXT_RENDERER, "Renderer::scheduleScreenshot: will overwrite previous screenshot request that was not executed yet (buffer={})", renderTargetHandle);
+            discardPendingScreenshotReadback(renderTargetHandle);
+        }
 
         m_screenshots[renderTargetHandle] = std::move(screenshot);
 
@@ -630,9 +742,18 @@ namespace ramses::internal
 
         ScreenshotInfo& screenshot = it->second;
         assert(screenshot.rectangle.width > 0u && screenshot.rectangle.height > 0u);
-        if (!screenshot.pixelData.empty())
+        if (!screenshot.pixelData.empty() || screenshot.pendingReadback.isValid())
             return;
 
+        if (m_asyncReadPixelsEnabled)
+        {
+            // result is collected in one of the next frames in dispatchProcessedScreenshots,
+            // fall back to blocking read if no readback buffer is available
+            screenshot.pendingReadback = m_displayController->readPixelsAsync(renderTargetHandle, screenshot.rectangle.x, screenshot.rectangle.y, screenshot.rectangle.width, screenshot.rectangle.height);
+            if (screenshot.pendingReadback.isValid())
+                return;
+        }
+
         m_displayController->readPixels(renderTargetHandle, screenshot.rectangle.x, screenshot.rectangle.y, screenshot.rectangle.width, screenshot.rectangle.height, screenshot.pixelData);
         assert(!screenshot.pixelData.empty());
     }
@@ -644,7 +765,13 @@ namespace ramses::internal
         {
             const auto rtHandle = it.first;
             auto& screenshot = it.second;
-            if (!screenshot.pixelData.empty())
+            if (screenshot.pendingReadback.isValid() && hasDisplayController())
+            {
+                const auto& rect = screenshot.rectangle;
+                if (m_displayController->getReadPixelsAsyncResult(screenshot.pendingReadback, rect.width, rect.height, screenshot.pixelData))
+                    screenshot.pendingReadback = DeviceResourceHandle::Invalid();
+            }
+            if (!screenshot.pendingReadback.isValid() && !screenshot.pixelData.empty())
                 result.emplace_back(rtHandle, std::move(screenshot));
         }
 
@@ -654,6 +781,16 @@ namespace ramses::internal
         return result;
     }
 
+    void Renderer::discardPendingScreenshotReadback(DeviceResourceHandle renderTargetHandle)
+    {
+        const auto it = m_screenshots.find(renderTargetHandle);
+        if (it != m_screenshots.end() && it->second.pendingReadback.isValid())
+        {
+            m_displayController->discardReadPixelsAsync(it->second.pendingReadback);
+            it->second.pendingReadback = DeviceResourceHandle::Invalid();
+        }
+    }
+
     bool Renderer::hasAnyBufferWithInterruptedRendering() const
     {
         return m_rendererInterruptState.isInterrupted();
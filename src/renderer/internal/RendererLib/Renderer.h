@@ -15,6 +15,7 @@
 #include "internal/RendererLib/RendererInterruptState.h"
 #include "internal/RendererLib/DisplaySetup.h"
 #include "internal/RendererLib/DisplayEventHandler.h"
+#include "internal/RendererLib/RenderCommandList.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 
@@ -33,6 +34,8 @@ namespace ramses::internal
     class RendererEventCollector;
     class FrameTimer;
     class SceneExpirationMonitor;
+    class SceneUpdateThreadPool;
+    struct RenderingContext;
 
     class Renderer
     {
@@ -62,6 +65,10 @@ namespace ramses::internal
         void                        setSceneShown               (SceneId sceneId, bool show);
 
         virtual void                markBufferWithSceneForRerender(SceneId sceneId);
+        // scene content changed, rendering commands recorded for it cannot be reused
+        void                        markSceneModified(SceneId sceneId);
+        // if set, render commands of scenes are recorded concurrently using given pool, otherwise on rendering thread
+        void                        setRenderCommandRecordingThreadPool(SceneUpdateThreadPool* threadPool);
 
         [[nodiscard]] const IDisplayController&   getDisplayController() const;
         IDisplayController&         getDisplayController();
@@ -111,7 +118,9 @@ namespace ramses::internal
         void renderToOffscreenBuffers();
         void renderToInterruptibleOffscreenBuffers();
         void processScheduledScreenshots(DeviceResourceHandle renderTargetHandle);
+        void discardPendingScreenshotReadback(DeviceResourceHandle renderTargetHandle);
         void onSceneWasRendered(const RendererCachedScene& scene);
+        void renderScenesUsingCommandLists(const RenderingContext& bufferContext, bool discardDepthAfterLastScene);
 
         DisplayHandle                          m_display;
         IPlatform&                             m_platform;
@@ -121,6 +130,7 @@ namespace ramses::internal
         DeviceResourceHandle                   m_frameBufferDeviceHandle;
         DisplaySetup                           m_displayBuffersSetup;
         std::unordered_map<DeviceResourceHandle, ScreenshotInfo> m_screenshots;
+        bool                                   m_asyncReadPixelsEnabled = false;
 
         const RendererScenes&                  m_rendererScenes;
         DisplayEventHandler                    m_displayEventHandler;
@@ -132,7 +142,22 @@ namespace ramses::internal
         const FrameTimer&                      m_frameTimer;
         SceneExpirationMonitor&                m_expirationMonitor;
 
+        // rendering commands recorded per scene, replayed as long as scene is not modified and rendered with same context
+        struct RecordedScene
+        {
+            RenderCommandList commandList;
+            DeviceResourceHandle displayBuffer;
+            uint32_t viewportWidth = 0u;
+            uint32_t viewportHeight = 0u;
+            bool depthDiscard = false;
+            bool valid = false;
+        };
+        bool                                   m_renderCommandRecordingEnabled = false;
+        SceneUpdateThreadPool*                 m_renderCommandRecordingThreadPool = nullptr;
+        std::unordered_map<SceneId, RecordedScene> m_recordedScenes;
+
         // temporary containers kept to avoid re-allocations
         std::vector<SceneId> m_tempScenesToRender;
+        std::vector<SceneId> m_tempScenesToRecord;
     };
 }
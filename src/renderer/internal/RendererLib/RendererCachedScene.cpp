@@ -8,8 +8,13 @@
 
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/RendererLib/RenderableComparator.h"
+#include "internal/RendererLib/FrustumCullingUtils.h"
+#include "internal/Core/Math3d/CameraMatrixHelper.h"
+#include "internal/SceneGraph/SceneAPI/Camera.h"
 #include "RenderingPassOrderComparator.h"
 #include <algorithm>
+#include <numeric>
+#include <tuple>
 
 namespace ramses::internal
 {
@@ -17,6 +22,8 @@ namespace ramses::internal
         : ResourceCachedScene(sceneLinksManager, sceneInfo)
         , m_renderableOrderingDirty(true)
     {
+        // uniform data is read for every renderable each frame, keep it close together in memory
+        enableDataInstanceArena();
     }
 
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
@@ -25,6 +32,40 @@ namespace ramses::internal
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle)
+    {
+        ResourceCachedScene::setRenderableRenderState(renderableHandle, stateHandle);
+        // render state is part of state key
+        m_renderableStateKeysDirty = true;
+    }
+
+    void RendererCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
+    {
+        ResourceCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        // effect and geometry are part of state key
+        m_renderableStateKeysDirty = true;
+    }
+
+    TextureSamplerHandle RendererCachedScene::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle)
+    {
+        const TextureSamplerHandle samplerHandle = ResourceCachedScene::allocateTextureSampler(sampler, handle);
+        // texture of first sampler is part of state key, sampler can be reallocated with other content under same handle
+        m_renderableStateKeysDirty = true;
+        return samplerHandle;
+    }
+
+    void RendererCachedScene::releaseTextureSampler(TextureSamplerHandle handle)
+    {
+        ResourceCachedScene::releaseTextureSampler(handle);
+        m_renderableStateKeysDirty = true;
+    }
+
+    void RendererCachedScene::setDataTextureSamplerHandle(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
+    {
+        ResourceCachedScene::setDataTextureSamplerHandle(dataInstanceHandle, field, samplerHandle);
+        m_renderableStateKeysDirty = true;
+    }
+
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
         ResourceCachedScene::releaseRenderGroup(groupHandle);
@@ -145,6 +186,12 @@ namespace ramses::internal
         }
     }
 
+    void RendererCachedScene::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        ResourceCachedScene::setRenderPassStateSorting(passHandle, enable);
+        m_renderableOrderingDirty = true;
+    }
+
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         ResourceCachedScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -180,6 +227,27 @@ namespace ramses::internal
         return m_passRenderableOrder[pass.asMemoryHandle()];
     }
 
+    const RenderableVector& RendererCachedScene::getVisibleRenderablesForPass(RenderPassHandle pass) const
+    {
+        assert(pass.asMemoryHandle() < m_passVisibleRenderables.size());
+        return m_passVisibleRenderables[pass.asMemoryHandle()];
+    }
+
+    uint32_t RendererCachedScene::getNumCulledRenderables() const
+    {
+        return m_numCulledRenderables;
+    }
+
+    uint32_t RendererCachedScene::getNumVisibleRenderables() const
+    {
+        return m_numVisibleRenderables;
+    }
+
+    uint32_t RendererCachedScene::getNumStateSwitches() const
+    {
+        return m_numStateSwitches;
+    }
+
     void RendererCachedScene::updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor)
     {
         updateRenderableResources(resourceAccessor);
@@ -197,9 +265,11 @@ namespace ramses::internal
 
             //add render passes
             m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+            m_passRenderableStateKeys.resize(totalNumberOfRenderPasses);
             for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
             {
                 m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
+                m_passRenderableStateKeys[passHandle.asMemoryHandle()].clear();
                 if (shouldRenderPassBeRendered(passHandle))
                     m_sortedRenderingPasses.emplace_back(passHandle);
             }
@@ -227,10 +297,34 @@ namespace ramses::internal
             for (const auto& pass : m_sortedRenderingPasses)
             {
                 if (ERenderingPassType::RenderPass == pass.getType())
+                {
                     updateRenderablesInPass(pass.getRenderPassHandle());
+                    updateRenderableStateKeysInPass(pass.getRenderPassHandle());
+                }
             }
 
             m_renderableOrderingDirty = false;
+            m_renderableStateKeysDirty = false;
+        }
+        else if (m_renderableStateKeysDirty)
+        {
+            // states of renderables changed but not their order, state sorted passes must be sorted again
+            for (const auto& pass : m_sortedRenderingPasses)
+            {
+                if (ERenderingPassType::RenderPass == pass.getType())
+                {
+                    const RenderPassHandle passHandle = pass.getRenderPassHandle();
+                    if (ResourceCachedScene::getRenderPass(passHandle).isStateSortingEnabled)
+                    {
+                        m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
+                        updateRenderablesInPass(passHandle);
+                    }
+                    m_passRenderableStateKeys[passHandle.asMemoryHandle()].clear();
+                    updateRenderableStateKeysInPass(passHandle);
+                }
+            }
+
+            m_renderableStateKeysDirty = false;
         }
     }
 
@@ -255,6 +349,86 @@ namespace ramses::internal
         }
     }
 
+    void RendererCachedScene::updateRenderableStateKeysInPass(RenderPassHandle passHandle)
+    {
+        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        std::vector<RenderableStateKey>& stateKeys = m_passRenderableStateKeys[passHandle.asMemoryHandle()];
+        stateKeys.reserve(orderedRenderables.size());
+        for (const auto renderable : orderedRenderables)
+            stateKeys.push_back(getRenderableStateKey(renderable));
+
+        if (!ResourceCachedScene::getRenderPass(passHandle).isStateSortingEnabled)
+            return;
+
+        // render orders are ignored, stable sort keeps render order of renderables sharing all states
+        std::vector<size_t> sortedIndices(orderedRenderables.size());
+        std::iota(sortedIndices.begin(), sortedIndices.end(), 0u);
+        std::stable_sort(sortedIndices.begin(), sortedIndices.end(), [&stateKeys](size_t i1, size_t i2) {
+            const RenderableStateKey& key1 = stateKeys[i1];
+            const RenderableStateKey& key2 = stateKeys[i2];
+            return std::tie(key1.effect, key1.textureContentType, key1.texture, key1.textureContent, key1.geometry, key1.renderState) <
+                std::tie(key2.effect, key2.textureContentType, key2.texture, key2.textureContent, key2.geometry, key2.renderState);
+        });
+
+        RenderableVector sortedRenderables;
+        std::vector<RenderableStateKey> sortedStateKeys;
+        sortedRenderables.reserve(orderedRenderables.size());
+        sortedStateKeys.reserve(stateKeys.size());
+        for (const auto idx : sortedIndices)
+        {
+            sortedRenderables.push_back(orderedRenderables[idx]);
+            sortedStateKeys.push_back(stateKeys[idx]);
+        }
+        orderedRenderables.swap(sortedRenderables);
+        stateKeys.swap(sortedStateKeys);
+    }
+
+    RendererCachedScene::RenderableStateKey RendererCachedScene::getRenderableStateKey(RenderableHandle renderable) const
+    {
+        const Renderable& renderableData = ResourceCachedScene::getRenderable(renderable);
+        RenderableStateKey key;
+        key.geometry = renderableData.dataInstances[ERenderableDataSlotType_Geometry];
+        key.renderState = renderableData.renderState;
+
+        const DataInstanceHandle uniforms = renderableData.dataInstances[ERenderableDataSlotType_Uniforms];
+        if (!uniforms.isValid())
+            return key;
+
+        const DataLayout& layout = ResourceCachedScene::getDataLayout(ResourceCachedScene::getLayoutOfDataInstance(uniforms));
+        key.effect = layout.getEffectHash();
+        for (DataFieldHandle field(0u); field < layout.getFieldCount(); ++field)
+        {
+            if (IsTextureSamplerType(layout.getField(field).dataType))
+            {
+                const TextureSamplerHandle samplerHandle = ResourceCachedScene::getDataTextureSamplerHandle(uniforms, field);
+                if (samplerHandle.isValid() && ResourceCachedScene::isTextureSamplerAllocated(samplerHandle))
+                {
+                    const TextureSampler& sampler = ResourceCachedScene::getTextureSampler(samplerHandle);
+                    key.textureContentType = sampler.contentType;
+                    key.texture = sampler.textureResource;
+                    key.textureContent = sampler.contentHandle;
+                }
+                break;
+            }
+        }
+
+        return key;
+    }
+
+    uint32_t RendererCachedScene::CountStateSwitches(const RenderableStateKey& key1, const RenderableStateKey& key2)
+    {
+        uint32_t numSwitches = 0u;
+        if (key1.effect != key2.effect)
+            ++numSwitches;
+        if (key1.textureContentType != key2.textureContentType || key1.texture != key2.texture || key1.textureContent != key2.textureContent)
+            ++numSwitches;
+        if (key1.geometry != key2.geometry)
+            ++numSwitches;
+        if (key1.renderState != key2.renderState)
+            ++numSwitches;
+        return numSwitches;
+    }
+
     static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
     {
         if (scene.getRenderable(renderable).visibilityMode == EVisibilityMode::Visible)
@@ -308,35 +482,110 @@ namespace ramses::internal
     }
 
     void RendererCachedScene::updateRenderableWorldMatrices()
+    {
+        updateRenderableWorldMatricesInPasses(false);
+    }
+
+    void RendererCachedScene::updateRenderableWorldMatricesWithLinks()
+    {
+        updateRenderableWorldMatricesInPasses(true);
+    }
+
+    void RendererCachedScene::updateRenderableWorldMatricesInPasses(bool withLinks)
     {
         m_renderableMatrices.resize(ResourceCachedScene::getRenderableCount());
+
+        // no-op unless breadth first transformation update is enabled for this scene,
+        // otherwise all world matrices are clean afterwards and the per renderable update below is just a lookup
+        if (withLinks)
+            updateWorldMatricesBreadthFirstWithLinks();
+        else
+            updateWorldMatricesBreadthFirst();
+
         for (const auto& renderables : m_passRenderableOrder)
         {
             for (const auto renderable : renderables)
             {
                 assert(renderable.isValid());
-                const NodeHandle node = getRenderable(renderable).node;
-                assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
+                const Renderable& renderableData = ResourceCachedScene::getRenderable(renderable);
+                assert(renderableData.node.isValid());
+                m_renderableMatrices[renderable.asMemoryHandle()] = withLinks ?
+                    updateMatrixCacheWithLinks(ETransformationMatrixType_World, renderableData.node) :
+                    updateMatrixCache(ETransformationMatrixType_World, renderableData.node);
             }
         }
     }
 
-    void RendererCachedScene::updateRenderableWorldMatricesWithLinks()
+    void RendererCachedScene::updateRenderableVisibility()
     {
-        m_renderableMatrices.resize(ResourceCachedScene::getRenderableCount());
-        for (const auto& renderables : m_passRenderableOrder)
+        m_passVisibleRenderables.resize(m_passRenderableOrder.size());
+        m_numCulledRenderables = 0u;
+        m_numVisibleRenderables = 0u;
+        m_numStateSwitches = 0u;
+
+        for (RenderPassHandle pass(0u); pass < static_cast<uint32_t>(m_passRenderableOrder.size()); ++pass)
         {
-            for (const auto renderable : renderables)
+            const RenderableVector& renderables = m_passRenderableOrder[pass.asMemoryHandle()];
+            RenderableVector& visibleRenderables = m_passVisibleRenderables[pass.asMemoryHandle()];
+            visibleRenderables.clear();
+
+            const std::vector<RenderableStateKey>& stateKeys = m_passRenderableStateKeys[pass.asMemoryHandle()];
+            assert(stateKeys.size() == renderables.size());
+            const RenderableStateKey* lastVisibleStateKey = nullptr;
+
+            // frustum is only computed when there is a renderable with bounding box in the pass
+            bool frustumPlanesValid = false;
+            FrustumCullingUtils::FrustumPlanes frustumPlanes;
+
+            for (size_t i = 0u; i < renderables.size(); ++i)
             {
-                assert(renderable.isValid());
-                const NodeHandle node = ResourceCachedScene::getRenderable(renderable).node;
-                assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCacheWithLinks(ETransformationMatrixType_World, node);
+                const RenderableHandle renderable = renderables[i];
+                const Renderable& renderableData = ResourceCachedScene::getRenderable(renderable);
+
+                if (renderableData.boundingBox.isValid())
+                {
+                    if (!frustumPlanesValid)
+                    {
+                        frustumPlanes = FrustumCullingUtils::ExtractFrustumPlanes(getCameraViewProjectionMatrix(ResourceCachedScene::getRenderPass(pass).camera));
+                        frustumPlanesValid = true;
+                    }
+
+                    assert(renderable.asMemoryHandle() < m_renderableMatrices.size());
+                    if (FrustumCullingUtils::IsBoundingBoxOutsideFrustum(frustumPlanes, m_renderableMatrices[renderable.asMemoryHandle()], renderableData.boundingBox))
+                    {
+                        ++m_numCulledRenderables;
+                        continue;
+                    }
+                }
+
+                visibleRenderables.push_back(renderable);
+
+                if (lastVisibleStateKey != nullptr)
+                    m_numStateSwitches += CountStateSwitches(*lastVisibleStateKey, stateKeys[i]);
+                lastVisibleStateKey = &stateKeys[i];
             }
+
+            m_numVisibleRenderables += static_cast<uint32_t>(visibleRenderables.size());
         }
     }
 
+    glm::mat4 RendererCachedScene::getCameraViewProjectionMatrix(CameraHandle camera) const
+    {
+        // must match camera matrices used by RenderExecutor for rendering
+        assert(camera.isValid());
+        const Camera& cameraData = ResourceCachedScene::getCamera(camera);
+        const glm::mat4 viewMatrix = updateMatrixCacheWithLinks(ETransformationMatrixType_Object, cameraData.node);
+
+        const auto frustumPlanesRef = ResourceCachedScene::getDataReference(cameraData.dataInstance, Camera::FrustumPlanesField);
+        const auto frustumNearFarRef = ResourceCachedScene::getDataReference(cameraData.dataInstance, Camera::FrustumNearFarPlanesField);
+        const auto& frustumPlanes = ResourceCachedScene::getDataSingleVector4f(frustumPlanesRef, DataFieldHandle{ 0 });
+        const auto& frustumNearFar = ResourceCachedScene::getDataSingleVector2f(frustumNearFarRef, DataFieldHandle{ 0 });
+        const glm::mat4 projectionMatrix = CameraMatrixHelper::ProjectionMatrix(
+            ProjectionParams::Frustum(cameraData.projectionType, frustumPlanes.x, frustumPlanes.y, frustumPlanes.z, frustumPlanes.w, frustumNearFar.x, frustumNearFar.y));
+
+        return projectionMatrix * viewMatrix;
+    }
+
     bool RendererCachedScene::shouldRenderPassBeRendered(RenderPassHandle handle) const
     {
         if (!ResourceCachedScene::isRenderPassAllocated(handle))
@@ -371,6 +620,11 @@ namespace ramses::internal
         m_renderableOrderingDirty = true;
     }
 
+    bool RendererCachedScene::hasRenderOncePassesToRender() const
+    {
+        return m_renderOncePassesToRender.size() > 0u;
+    }
+
     void RendererCachedScene::markAllRenderOncePassesAsRendered() const
     {
         if (m_renderOncePassesToRender.size() > 0u)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "internal/RendererLib/ResourceCachedScene.h"
+#include "internal/SceneGraph/SceneAPI/TextureSampler.h"
 #include "RenderingPassInfo.h"
 
 namespace ramses::internal
@@ -23,9 +24,13 @@ namespace ramses::internal
         void updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor);
         void updateRenderableWorldMatrices();
         void updateRenderableWorldMatricesWithLinks();
+        // culls renderables against pass camera and collects visible renderables of every pass,
+        // must be called after world matrices are updated and data links are resolved as camera can be data linked
+        void updateRenderableVisibility();
 
         void retriggerAllRenderOncePasses();
         void markAllRenderOncePassesAsRendered() const;
+        [[nodiscard]] bool hasRenderOncePassesToRender() const;
 
         /**
          * The renderer sets this to true when it applies a semantic time uniform
@@ -47,6 +52,12 @@ namespace ramses::internal
         bool hasActiveShaderAnimation() const;
 
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
+        void                        setRenderableDataInstance       (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
+
+        TextureSamplerHandle        allocateTextureSampler          (const TextureSampler& sampler, TextureSamplerHandle handle) override;
+        void                        releaseTextureSampler           (TextureSamplerHandle handle) override;
+        void                        setDataTextureSamplerHandle     (DataInstanceHandle dataInstanceHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
 
         void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order) override;
@@ -57,6 +68,7 @@ namespace ramses::internal
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         void                        addRenderGroupToRenderGroup     (RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order) override;
@@ -73,8 +85,15 @@ namespace ramses::internal
 
         const RenderingPassInfoVector&      getSortedRenderingPasses        () const;
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
+        const RenderableVector&             getVisibleRenderablesForPass    (RenderPassHandle pass) const;
         const glm::mat4&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
+        // statistics of last visibility update, renderables which have no bounding box are never culled
+        [[nodiscard]] uint32_t              getNumCulledRenderables         () const;
+        [[nodiscard]] uint32_t              getNumVisibleRenderables        () const;
+        // number of effect, texture, geometry and render state changes between consecutive visible renderables of all passes
+        [[nodiscard]] uint32_t              getNumStateSwitches             () const;
+
         using TextureBufferUpdate = std::vector<Quad>;
 
         const TextureBufferUpdate& getTextureBufferUpdate(TextureBufferHandle handle) const
@@ -91,14 +110,39 @@ namespace ramses::internal
         }
 
     private:
+        // states which have to be switched on device between two renderables, only first texture of renderable is considered
+        struct RenderableStateKey
+        {
+            ResourceContentHash         effect;
+            TextureSampler::ContentType textureContentType = TextureSampler::ContentType::None;
+            ResourceContentHash         texture;
+            MemoryHandle                textureContent = InvalidMemoryHandle;
+            DataInstanceHandle          geometry;
+            RenderStateHandle           renderState;
+        };
+
         void updatePassRenderableSorting();
         void updateRenderablesInPass(RenderPassHandle passHandle);
+        void updateRenderableStateKeysInPass(RenderPassHandle passHandle);
+        [[nodiscard]] RenderableStateKey getRenderableStateKey(RenderableHandle renderable) const;
+        [[nodiscard]] static uint32_t CountStateSwitches(const RenderableStateKey& key1, const RenderableStateKey& key2);
         void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
         bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
+        void updateRenderableWorldMatricesInPasses(bool withLinks);
+        glm::mat4 getCameraViewProjectionMatrix(CameraHandle camera) const;
 
         RenderingPassInfoVector m_sortedRenderingPasses;
         using PassRenderableOrder = std::vector<RenderableVector>;
         PassRenderableOrder     m_passRenderableOrder;
+        PassRenderableOrder     m_passVisibleRenderables;
+        uint32_t                m_numCulledRenderables = 0u;
+        uint32_t                m_numVisibleRenderables = 0u;
+
+        // state key of every renderable in ordered renderables of pass
+        std::vector<std::vector<RenderableStateKey>> m_passRenderableStateKeys;
+        uint32_t                           m_numStateSwitches = 0u;
+        // state of renderables changed without changing order of passes and renderables
+        bool                               m_renderableStateKeysDirty = false;
         mutable bool            m_renderableOrderingDirty;
 
         using MatrixVector = std::vector<glm::mat4>;
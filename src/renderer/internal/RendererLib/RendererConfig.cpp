@@ -50,4 +50,14 @@ namespace ramses::internal
     {
         return m_renderThreadLoopTimingReportingPeriod;
     }
+
+    void RendererConfig::setSceneUpdateWorkerCount(uint32_t workerCount)
+    {
+        m_sceneUpdateWorkerCount = workerCount;
+    }
+
+    uint32_t RendererConfig::getSceneUpdateWorkerCount() const
+    {
+        return m_sceneUpdateWorkerCount;
+    }
 }
@@ -28,11 +28,16 @@ namespace ramses::internal
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
         void setRenderthreadLooptimingReportingPeriod(std::chrono::milliseconds period);
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
+        void setSceneUpdateWorkerCount(uint32_t workerCount);
+        [[nodiscard]] uint32_t getSceneUpdateWorkerCount() const;
+
+        static constexpr uint32_t MaxSceneUpdateWorkerCount = 32u;
 
     private:
         std::string m_waylandDisplayForSystemCompositorController;
         bool m_systemCompositorEnabled = false;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
         std::chrono::milliseconds m_renderThreadLoopTimingReportingPeriod { 0 }; // zero deactivates reporting
+        uint32_t m_sceneUpdateWorkerCount = 0u; // zero means scenes are updated sequentially on display thread
     };
 }
@@ -31,10 +31,12 @@ namespace ramses::internal
         IEmbeddedCompositingManager& embeddedCompositingManager,
         const DisplayConfig& displayConfig,
         const FrameTimer& frameTimer,
-        RendererStatistics& stats)
+        RendererStatistics& stats,
+        WorkerThreadPool* decompressionThreadPool,
+        ProgramUniformCache* uniformCache)
         : m_renderBackend(renderBackend)
         , m_embeddedCompositingManager(embeddedCompositingManager)
-        , m_resourceUploadingManager(m_resourceRegistry, std::move(resourceUploader), renderBackend, asyncEffectUploader, displayConfig, frameTimer, stats)
+        , m_resourceUploadingManager(m_resourceRegistry, std::move(resourceUploader), renderBackend, asyncEffectUploader, displayConfig, frameTimer, stats, decompressionThreadPool, uniformCache)
         , m_stats(stats)
     {
     }
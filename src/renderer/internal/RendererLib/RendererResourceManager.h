@@ -27,6 +27,8 @@ namespace ramses::internal
     class IBinaryShaderCache;
     class IResourceUploader;
     class DisplayConfig;
+    class WorkerThreadPool;
+    class ProgramUniformCache;
 
     class RendererResourceManager final : public IRendererResourceManager
     {
@@ -38,7 +40,9 @@ namespace ramses::internal
             IEmbeddedCompositingManager& embeddedCompositingManager,
             const DisplayConfig& displayConfig,
             const FrameTimer& frameTimer,
-            RendererStatistics& stats);
+            RendererStatistics& stats,
+            WorkerThreadPool* decompressionThreadPool = nullptr,
+            ProgramUniformCache* uniformCache = nullptr);
         ~RendererResourceManager() override;
 
         // Immutable resources
@@ -33,7 +33,6 @@
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/Components/SceneUpdate.h"
 #include "internal/Core/Utils/LogMacros.h"
-#include "internal/Core/Utils/Image.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/PlatformAbstraction/Macros.h"
 #include <algorithm>
@@ -74,6 +73,8 @@ namespace ramses::internal
 
         if (m_displayResourceManager)
             destroyDisplayContext();
+
+        m_renderer.setRenderCommandRecordingThreadPool(nullptr);
     }
 
     void RendererSceneUpdater::handleSceneUpdate(SceneId sceneId, SceneUpdate&& sceneUpdate)
@@ -117,7 +118,7 @@ namespace ramses::internal
             IRenderBackend& renderBackend = displayController.getRenderBackend();
             IEmbeddedCompositingManager& embeddedCompositingManager = displayController.getEmbeddedCompositingManager();
 
-            m_asyncEffectUploader = std::make_unique<AsyncEffectUploader>(m_platform, renderBackend, m_notifier, m_display);
+            m_asyncEffectUploader = std::make_unique<AsyncEffectUploader>(m_platform, renderBackend, m_notifier, m_display, m_sceneUpdateThreadPool.get());
             if (!m_asyncEffectUploader->createResourceUploadRenderBackendAndStartThread())
             {
                 m_renderer.destroyDisplayContext();
@@ -153,7 +154,9 @@ namespace ramses::internal
             embeddedCompositingManager,
             displayConfig,
             m_frameTimer,
-            m_renderer.getStatistics());
+            m_renderer.getStatistics(),
+            m_sceneUpdateThreadPool.get(),
+            &m_renderer.getDisplayController().getUniformCache());
     }
 
     bool RendererSceneUpdater::hasResourceManager() const
@@ -274,9 +277,18 @@ namespace ramses::internal
             updateScenesDataLinks();
         }
 
-        m_renderer.m_traceId = 12;
+        {
+            m_renderer.m_traceId = 12;
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes update scenes renderable visibility");
+            // culling needs transformations and data linked camera values of current frame
+            FRAME_PROFILER_REGION(FrameProfilerStatistics::ERegion::UpdateTransformations);
+            updateScenesRenderableVisibility();
+        }
+
+        m_renderer.m_traceId = 13;
         for (const auto scene : m_modifiedScenesToRerender)
         {
+            m_renderer.markSceneModified(scene);
             if (m_sceneStateExecutor.getSceneState(scene) == ESceneState::Rendered)
                 m_renderer.markBufferWithSceneForRerender(scene);
         }
@@ -287,6 +299,8 @@ namespace ramses::internal
             // Mark all shown scenes for re-render regardless if modified or not
             for (const auto& scene : m_rendererScenes)
             {
+                // do not rely on modification tracking for recorded commands either
+                m_renderer.markSceneModified(scene.key);
                 if (m_sceneStateExecutor.getSceneState(scene.key) == ESceneState::Rendered)
                     m_renderer.markBufferWithSceneForRerender(scene.key);
             }
@@ -581,7 +595,7 @@ namespace ramses::internal
                     rendererScene.getSceneId());
                 rendererScene.setEffectTimeSync(pendingFlush.timeInfo.internalTimestamp);
             }
-            ApplySceneActions(rendererScene, pendingFlush);
+            applySceneActions(rendererScene, pendingFlush);
 
             if (pendingFlush.versionTag.isValid())
             {
@@ -918,13 +932,16 @@ namespace ramses::internal
         return false;
     }
 
-    void RendererSceneUpdater::ApplySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo)
+    void RendererSceneUpdater::applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo)
     {
         const SceneActionCollection& actionsForScene = flushInfo.sceneActions;
         const uint32_t numActions = actionsForScene.numberOfActions();
         LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions start applying scene actions [count:{}] for scene with id {}", numActions, scene.getSceneId());
 
-        SceneActionApplier::ApplyActionsOnScene(scene, actionsForScene);
+        if (m_parallelSceneActionApplier)
+            m_parallelSceneActionApplier->applyActionsOnScene(scene, actionsForScene);
+        else
+            SceneActionApplier::ApplyActionsOnScene(scene, actionsForScene);
 
         LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions finished applying scene actions for scene with id {}", scene.getSceneId());
     }
@@ -1645,6 +1662,18 @@ namespace ramses::internal
         m_sceneReferenceLogic = &sceneRefLogic;
     }
 
+    void RendererSceneUpdater::setSceneUpdateWorkerCount(uint32_t workerCount)
+    {
+        LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater: using {} worker threads to update scenes", workerCount);
+        // pool is also used for resource decompression by resource manager of display, must be set before display is created
+        assert(!m_displayResourceManager && !m_asyncEffectUploader);
+        m_parallelSceneActionApplier.reset();
+        m_sceneUpdateThreadPool = (workerCount > 0u ? std::make_unique<SceneUpdateThreadPool>(workerCount) : nullptr);
+        if (m_sceneUpdateThreadPool)
+            m_parallelSceneActionApplier = std::make_unique<ParallelSceneActionApplier>(*m_sceneUpdateThreadPool);
+        m_renderer.setRenderCommandRecordingThreadPool(m_sceneUpdateThreadPool.get());
+    }
+
     bool RendererSceneUpdater::areResourcesFromPendingFlushesUploaded(SceneId sceneId) const
     {
         const auto& pendingData = m_rendererScenes.getStagingInfo(sceneId).pendingData;
@@ -1685,6 +1714,12 @@ namespace ramses::internal
             }
         }
 
+        if (m_sceneUpdateThreadPool)
+        {
+            updateScenesTransformationCacheInParallel();
+            return;
+        }
+
         const SceneIdVector& dependencyOrderedScenes = m_rendererScenes.getSceneLinksManager().getTransformationLinkManager().getDependencyChecker().getDependentScenesInOrder();
         for(const auto sceneId : dependencyOrderedScenes)
         {
@@ -1704,6 +1739,66 @@ namespace ramses::internal
         }
     }
 
+    void RendererSceneUpdater::updateScenesTransformationCacheInParallel()
+    {
+        const auto& transfLinkManager = m_rendererScenes.getSceneLinksManager().getTransformationLinkManager();
+        const auto& dependencyOrderedScenes = transfLinkManager.getDependencyChecker().getDependentScenesInOrder();
+        const auto& dependencyLevels = transfLinkManager.getDependencyChecker().getDependentScenesInLevels();
+        const auto updateSceneWithLinks = [this](SceneId sceneId) { m_rendererScenes.getScene(sceneId).updateRenderableWorldMatricesWithLinks(); };
+
+        // scenes without any dependency are updated together with first dependency level
+        m_scenesToUpdateInParallel.clear();
+        for (const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
+        {
+            if (!contains_c(dependencyOrderedScenes, sceneId))
+                m_scenesToUpdateInParallel.push_back(sceneId);
+        }
+
+        for (const auto& level : dependencyLevels)
+        {
+            for (const auto sceneId : level)
+            {
+                if (m_scenesNeedingTransformationCacheUpdate.contains(sceneId))
+                    m_scenesToUpdateInParallel.push_back(sceneId);
+            }
+
+            m_sceneUpdateThreadPool->execute(m_scenesToUpdateInParallel, updateSceneWithLinks);
+            m_scenesToUpdateInParallel.clear();
+
+            // consumers from next level read provided transformations, make sure they are up to date
+            // so that consumers running concurrently do not modify matrix cache of provider
+            for (const auto sceneId : level)
+                transfLinkManager.updateProvidedTransformations(sceneId);
+        }
+
+        // no dependency levels at all, only independent scenes collected
+        if (!m_scenesToUpdateInParallel.empty())
+            m_sceneUpdateThreadPool->execute(m_scenesToUpdateInParallel, updateSceneWithLinks);
+    }
+
+    void RendererSceneUpdater::updateScenesRenderableVisibility()
+    {
+        m_scenesToUpdateInParallel.clear();
+        for (const auto& rendererScene : m_rendererScenes)
+        {
+            if (m_sceneStateExecutor.getSceneState(rendererScene.key) == ESceneState::Rendered)
+                m_scenesToUpdateInParallel.push_back(rendererScene.key);
+        }
+
+        // all links are resolved and provided transformations are up to date, every scene only modifies its own caches
+        const auto updateSceneVisibility = [this](SceneId sceneId) { m_rendererScenes.getScene(sceneId).updateRenderableVisibility(); };
+        if (m_sceneUpdateThreadPool)
+        {
+            m_sceneUpdateThreadPool->execute(m_scenesToUpdateInParallel, updateSceneVisibility);
+        }
+        else
+        {
+            for (const auto sceneId : m_scenesToUpdateInParallel)
+                updateSceneVisibility(sceneId);
+        }
+        m_scenesToUpdateInParallel.clear();
+    }
+
     void RendererSceneUpdater::updateScenesDataLinks()
     {
         const auto& dataRefLinkManager = m_rendererScenes.getSceneLinksManager().getDataReferenceLinkManager();
@@ -1718,6 +1813,26 @@ namespace ramses::internal
 
     void RendererSceneUpdater::resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager)
     {
+        if (m_sceneUpdateThreadPool)
+        {
+            // consumers within same dependency level do not provide data to each other and can be resolved concurrently
+            for (const auto& level : dataRefLinkManager.getDependencyChecker().getDependentScenesInLevels())
+            {
+                m_scenesToUpdateInParallel.clear();
+                for (const auto sceneId : level)
+                {
+                    if (dataRefLinkManager.getDependencyChecker().hasDependencyAsConsumer(sceneId) && m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered)
+                        m_scenesToUpdateInParallel.push_back(sceneId);
+                }
+
+                m_sceneUpdateThreadPool->execute(m_scenesToUpdateInParallel, [this, &dataRefLinkManager](SceneId sceneId) {
+                    dataRefLinkManager.resolveLinksForConsumerScene(m_rendererScenes.getScene(sceneId));
+                });
+            }
+            m_scenesToUpdateInParallel.clear();
+            return;
+        }
+
         for(const auto& rendererScene : m_rendererScenes)
         {
             const SceneId sceneID = rendererScene.key;
@@ -1859,22 +1974,8 @@ namespace ramses::internal
 
             if (!screenshot.filename.empty())
             {
-                // flip image vertically so that the layout read from frame buffer (bottom-up)
-                // is converted to layout normally used in image files (top-down)
-                const Image bitmap(screenshot.rectangle.width, screenshot.rectangle.height, screenshot.pixelData.cbegin(), screenshot.pixelData.cend(), true);
-                bitmap.saveToFilePNG(screenshot.filename);
-                LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::processScreenshotResults: screenshot successfully saved to file: {}", screenshot.filename);
-                if (screenshot.sendViaDLT)
-                {
-                    if (GetRamsesLogger().transmitFile(screenshot.filename, false))
-                    {
-                        LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::processScreenshotResults: started dlt file transfer: {}", screenshot.filename);
-                    }
-                    else
-                    {
-                        LOG_WARN(CONTEXT_RENDERER, "RendererSceneUpdater::processScreenshotResults: screenshot file could not send via dlt: {}", screenshot.filename);
-                    }
-                }
+                // PNG encoding and file IO is done in worker thread to not stall rendering
+                m_screenshotFileSaver.save(std::move(screenshot));
             }
             else
             {
@@ -19,6 +19,9 @@
 #include "internal/RendererLib/IRendererResourceManager.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
 #include "AsyncEffectUploader.h"
+#include "SceneUpdateThreadPool.h"
+#include "ParallelSceneActionApplier.h"
+#include "ScreenshotFileSaver.h"
 #include <unordered_map>
 
 namespace ramses::internal
@@ -100,6 +103,7 @@ namespace ramses::internal
         void processScreenshotResults();
         [[nodiscard]] bool hasPendingFlushes(SceneId sceneId) const;
         void setSceneReferenceLogicHandler(ISceneReferenceLogic& sceneRefLogic);
+        void setSceneUpdateWorkerCount(uint32_t workerCount);
 
     protected:
         virtual std::unique_ptr<IRendererResourceManager> createResourceManager(
@@ -118,7 +122,7 @@ namespace ramses::internal
         bool markClientAndSceneResourcesForReupload(SceneId sceneId);
 
         void updateScenePendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
-        static void ApplySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo);
+        void applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo);
         void applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
         void processStagedResourceChanges(SceneId sceneID, StagingInfo& stagingInfo);
 
@@ -136,7 +140,9 @@ namespace ramses::internal
         void updateScenesResourceCache();
         void updateScenesShaderAnimations();
         void updateScenesTransformationCache();
+        void updateScenesTransformationCacheInParallel();
         void updateScenesDataLinks();
+        void updateScenesRenderableVisibility();
         void updateScenesStates();
 
         void resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager);
@@ -162,6 +168,7 @@ namespace ramses::internal
 
         std::unique_ptr<IRendererResourceManager> m_displayResourceManager;
         std::unique_ptr<AsyncEffectUploader> m_asyncEffectUploader;
+        ScreenshotFileSaver m_screenshotFileSaver;
 
         struct SceneMapRequest
         {
@@ -172,6 +179,12 @@ namespace ramses::internal
 
         // extracted from RendererSceneUpdater::updateScenesTransformationCache to avoid per frame allocation
         HashSet<SceneId> m_scenesNeedingTransformationCacheUpdate;
+        SceneIdVector m_scenesToUpdateInParallel;
+
+        // if set, independent scenes are updated concurrently, see RendererConfig::setSceneUpdateWorkerCount
+        std::unique_ptr<SceneUpdateThreadPool> m_sceneUpdateThreadPool;
+        // set together with thread pool, applies data values of large flushes concurrently
+        std::unique_ptr<ParallelSceneActionApplier> m_parallelSceneActionApplier;
 
         bool m_skipUnmodifiedScenes = true;
         HashSet<SceneId> m_modifiedScenesToRerender;
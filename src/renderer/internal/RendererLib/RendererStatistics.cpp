@@ -26,11 +26,43 @@ namespace ramses::internal
         return m_frameNumber <= 0 ? 0u : std::lround(static_cast<float>(m_drawCalls.sum) / static_cast<float>(m_frameNumber));
     }
 
+    uint32_t RendererStatistics::getUniformsSetPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : std::lround(static_cast<float>(m_uniformsSet.sum) / static_cast<float>(m_frameNumber));
+    }
+
+    uint32_t RendererStatistics::getUniformsSkippedPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : std::lround(static_cast<float>(m_uniformsSkipped.sum) / static_cast<float>(m_frameNumber));
+    }
+
+    std::chrono::microseconds RendererStatistics::getAsyncResourceUploadLatencyAvg() const
+    {
+        return std::chrono::microseconds{ m_asyncResourcesUploaded == 0u ? 0 : m_asyncResourceUploadLatency.sum / static_cast<int64_t>(m_asyncResourcesUploaded) };
+    }
+
+    std::chrono::microseconds RendererStatistics::getAsyncResourceUploadLatencyMax() const
+    {
+        return std::chrono::microseconds{ m_asyncResourcesUploaded == 0u ? 0 : m_asyncResourceUploadLatency.maxValue };
+    }
+
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
         m_sceneStatistics[sceneId].numRendered++;
     }
 
+    void RendererStatistics::trackRenderablesCulling(SceneId sceneId, size_t numCulledRenderables, size_t numVisibleRenderables)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numRenderablesCulled += numCulledRenderables;
+        sceneStats.numRenderablesVisible += numVisibleRenderables;
+    }
+
+    void RendererStatistics::trackStateSwitches(SceneId sceneId, size_t numStateSwitches)
+    {
+        m_sceneStatistics[sceneId].numStateSwitches += numStateSwitches;
+    }
+
     void RendererStatistics::offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible)
     {
         auto& obStat = m_displayStatistics.offscreenBufferStatistics[offscreenBuffer];
@@ -56,6 +88,12 @@ namespace ramses::internal
         m_resourcesBytesUploaded += byteSize;
     }
 
+    void RendererStatistics::asyncResourceUploaded(std::chrono::microseconds latency)
+    {
+        m_asyncResourcesUploaded++;
+        m_asyncResourceUploadLatency.update(latency.count());
+    }
+
     void RendererStatistics::sceneResourceUploaded(SceneId sceneId, size_t byteSize)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -155,6 +193,12 @@ namespace ramses::internal
         m_streamTextureStatistics.erase(iviSurface);
     }
 
+    void RendererStatistics::trackUniformUpdates(uint32_t numSet, uint32_t numSkipped)
+    {
+        m_uniformsSet.update(numSet);
+        m_uniformsSkipped.update(numSkipped);
+    }
+
     void RendererStatistics::frameFinished(uint32_t drawCalls)
     {
         const uint64_t currTick = PlatformTime::GetMicrosecondsMonotonic();
@@ -200,10 +244,14 @@ namespace ramses::internal
         m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         m_frameNumber = 0;
         m_drawCalls.reset();
+        m_uniformsSet.reset();
+        m_uniformsSkipped.reset();
         m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         m_frameDurationMax = 0u;
         m_resourcesUploaded = 0u;
         m_resourcesBytesUploaded = 0u;
+        m_asyncResourcesUploaded = 0u;
+        m_asyncResourceUploadLatency.reset();
         m_shadersCompiled = 0u;
         m_microsecondsForShaderCompilation = 0u;
         m_maximumDurationShaderName = "";
@@ -234,6 +282,9 @@ namespace ramses::internal
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numRenderablesCulled = 0u;
+            sceneStat.numRenderablesVisible = 0u;
+            sceneStat.numStateSwitches = 0u;
         }
 
         m_displayStatistics.numFrameBufferSwapped = 0u;
@@ -263,8 +314,12 @@ namespace ramses::internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawCalls (" << m_drawCalls.minValue << "/" << m_drawCalls.maxValue << "/" << getDrawCallsPerFrame() << ")" <<
             ", numFrames " << m_frameNumber;
+        if (m_uniformsSet.sum > 0u || m_uniformsSkipped.sum > 0u)
+            str << ", uniforms set/skipped per frame (" << getUniformsSetPerFrame() << "/" << getUniformsSkippedPerFrame() << ")";
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
+        if (m_asyncResourcesUploaded > 0u)
+            str << ", asyncResUploaded " << m_asyncResourcesUploaded << " latency (" << m_asyncResourceUploadLatency.minValue << "/" << m_asyncResourceUploadLatency.maxValue << "/" << getAsyncResourceUploadLatencyAvg().count() << " us)";
         str << ", RC VRAM usage/cache (" << (m_totalResourceUploadedSize >> 20) << "/" << (m_gpuCacheSize >> 20) << " MB)";
         if (m_shadersCompiled > 0u)
         {
@@ -315,6 +370,13 @@ namespace ramses::internal
 
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.numRenderablesCulled > 0u && sceneStats.numRendered > 0u)
+            {
+                str << ", culled/visible per render (" << static_cast<float>(sceneStats.numRenderablesCulled) / static_cast<float>(sceneStats.numRendered)
+                    << "/" << static_cast<float>(sceneStats.numRenderablesVisible) / static_cast<float>(sceneStats.numRendered) << ")";
+            }
+            if (sceneStats.numStateSwitches > 0u && sceneStats.numRendered > 0u)
+                str << ", state switches per render " << static_cast<float>(sceneStats.numStateSwitches) / static_cast<float>(sceneStats.numRendered);
             str << "\n";
         }
 
@@ -14,6 +14,7 @@
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Components/FlushTimeInformation.h"
 
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -28,8 +29,14 @@ namespace ramses::internal
     public:
         [[nodiscard]] float  getFps() const;
         [[nodiscard]] uint32_t getDrawCallsPerFrame() const;
+        [[nodiscard]] uint32_t getUniformsSetPerFrame() const;
+        [[nodiscard]] uint32_t getUniformsSkippedPerFrame() const;
+        [[nodiscard]] std::chrono::microseconds getAsyncResourceUploadLatencyAvg() const;
+        [[nodiscard]] std::chrono::microseconds getAsyncResourceUploadLatencyMax() const;
 
         void sceneRendered(SceneId sceneId);
+        void trackRenderablesCulling(SceneId sceneId, size_t numCulledRenderables, size_t numVisibleRenderables);
+        void trackStateSwitches(SceneId sceneId, size_t numStateSwitches);
         void trackArrivedFlush(SceneId sceneId, size_t numSceneActions, size_t numAddedResources, size_t numRemovedResources, size_t numSceneResourceActions, std::chrono::milliseconds latency);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
@@ -39,6 +46,7 @@ namespace ramses::internal
         void framebufferSwapped();
 
         void resourceUploaded(size_t byteSize);
+        void asyncResourceUploaded(std::chrono::microseconds latency);
         void sceneResourceUploaded(SceneId sceneId, size_t byteSize);
         void streamTextureUpdated(WaylandIviSurfaceId iviSurface, size_t numUpdates);
         void shaderCompiled(std::chrono::microseconds microsecondsUsed, std::string_view name, SceneId sceneid);
@@ -50,6 +58,7 @@ namespace ramses::internal
 
         void addExpirationOffset(SceneId sceneId, int64_t expirationOffset);
 
+        void trackUniformUpdates(uint32_t numSet, uint32_t numSkipped);
         void frameFinished(uint32_t drawCalls);
         void reset();
 
@@ -59,11 +68,16 @@ namespace ramses::internal
         int32_t m_frameNumber = 0;
         uint64_t m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         SummaryEntry<uint32_t> m_drawCalls;
+        SummaryEntry<uint32_t> m_uniformsSet;
+        SummaryEntry<uint32_t> m_uniformsSkipped;
         uint64_t m_lastFrameTick = 0u;
         uint32_t m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         uint32_t m_frameDurationMax = 0u;
         size_t m_resourcesUploaded = 0u;
         size_t m_resourcesBytesUploaded = 0u;
+        size_t m_asyncResourcesUploaded = 0u;
+        // time from scheduling resource for upload until handed over to render thread, in microseconds
+        SummaryEntry<int64_t> m_asyncResourceUploadLatency;
         size_t m_shadersCompiled = 0u;
         uint64_t m_totalResourceUploadedSize = 0u;
         uint64_t m_gpuCacheSize = 0u;
@@ -101,6 +115,9 @@ namespace ramses::internal
             size_t sceneResourcesBytesUploaded = 0u;
 
             size_t numRendered = 0u;
+            size_t numRenderablesCulled = 0u;
+            size_t numRenderablesVisible = 0u;
+            size_t numStateSwitches = 0u;
         };
 
         struct OffscreenBufferStatistics
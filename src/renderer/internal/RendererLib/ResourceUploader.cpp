@@ -31,21 +31,42 @@ namespace ramses::internal
     {
         ManagedResource res = rd.resource;
         const IResource& resourceObject = *res.get();
-        IDevice& device = renderBackend.getDevice();
         outVRAMSize = resourceObject.getDecompressedDataSize();
 
-        switch (resourceObject.getTypeID())
+        if (resourceObject.getTypeID() == EResourceType::Effect)
+        {
+            const auto* effectRes = resourceObject.convertTo<EffectResource>();
+            const ResourceContentHash hash = effectRes->getHash();
+            const auto binaryShaderDeviceHandle = queryBinaryShaderCache(renderBackend, *effectRes, hash);
+            if(binaryShaderDeviceHandle.isValid())
+                return binaryShaderDeviceHandle;
+
+            if(m_asyncEffectUploadEnabled)
+                return {};
+
+            auto effectGpuRes = renderBackend.getDevice().uploadShader(*effectRes);
+            return renderBackend.getDevice().registerShader(std::move(effectGpuRes));
+        }
+
+        return UploadDataResource(renderBackend.getDevice(), resourceObject, outVRAMSize);
+    }
+
+    DeviceResourceHandle ResourceUploader::UploadDataResource(IDevice& device, const IResource& resource, uint32_t& vramSize)
+    {
+        vramSize = resource.getDecompressedDataSize();
+
+        switch (resource.getTypeID())
         {
         case EResourceType::VertexArray:
         {
-            const auto* vertArray = resourceObject.convertTo<ArrayResource>();
+            const auto* vertArray = resource.convertTo<ArrayResource>();
             const DeviceResourceHandle deviceHandle = device.allocateVertexBuffer(vertArray->getDecompressedDataSize());
             device.uploadVertexBufferData(deviceHandle, vertArray->getResourceData().data(), vertArray->getDecompressedDataSize());
             return deviceHandle;
         }
         case EResourceType::IndexArray:
         {
-            const auto* indexArray = resourceObject.convertTo<ArrayResource>();
+            const auto* indexArray = resource.convertTo<ArrayResource>();
             const DeviceResourceHandle deviceHandle = device.allocateIndexBuffer(indexArray->getElementType(), indexArray->getDecompressedDataSize());
             device.uploadIndexBufferData(deviceHandle, indexArray->getResourceData().data(), indexArray->getDecompressedDataSize());
             return deviceHandle;
@@ -53,21 +74,7 @@ namespace ramses::internal
         case EResourceType::Texture2D:
         case EResourceType::Texture3D:
         case EResourceType::TextureCube:
-            return UploadTexture(device, *resourceObject.convertTo<TextureResource>(), outVRAMSize);
-        case EResourceType::Effect:
-        {
-            const auto* effectRes = resourceObject.convertTo<EffectResource>();
-            const ResourceContentHash hash = effectRes->getHash();
-            const auto binaryShaderDeviceHandle = queryBinaryShaderCache(renderBackend, *effectRes, hash);
-            if(binaryShaderDeviceHandle.isValid())
-                return binaryShaderDeviceHandle;
-
-            if(m_asyncEffectUploadEnabled)
-                return {};
-
-            auto effectGpuRes = renderBackend.getDevice().uploadShader(*effectRes);
-            return renderBackend.getDevice().registerShader(std::move(effectGpuRes));
-        }
+            return UploadTexture(device, *resource.convertTo<TextureResource>(), vramSize);
         default:
             assert(false && "Unexpected resource type");
             return DeviceResourceHandle::Invalid();
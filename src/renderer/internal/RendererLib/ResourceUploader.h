@@ -16,6 +16,7 @@ namespace ramses::internal
     class IBinaryShaderCache;
     class TextureResource;
     class EffectResource;
+    class IResource;
     class IDevice;
     struct ResourceDescriptor;
 
@@ -28,6 +29,9 @@ namespace ramses::internal
         void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
         void                         storeShaderInBinaryShaderCache(IRenderBackend& renderBackend, DeviceResourceHandle deviceHandle, const ResourceContentHash& hash, SceneId sceneid) override;
 
+        // uploads vertex/index array or texture resource (must be decompressed) using given device, can be used from resource upload thread
+        static DeviceResourceHandle UploadDataResource(IDevice& device, const IResource& resource, uint32_t& vramSize);
+
     private:
         static DeviceResourceHandle UploadTexture(IDevice& device, const TextureResource& texture, uint32_t& vramSize);
         DeviceResourceHandle queryBinaryShaderCache(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash);
@@ -12,6 +12,7 @@
 #include "internal/RendererLib/FrameTimer.h"
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/DisplayConfig.h"
+#include "internal/RendererLib/ProgramUniformCache.h"
 #include "internal/RendererLib/PlatformInterface/IRenderBackend.h"
 #include "internal/RendererLib/PlatformInterface/IEmbeddedCompositingManager.h"
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
@@ -30,15 +31,20 @@ namespace ramses::internal
         AsyncEffectUploader& asyncEffectUploader,
         const DisplayConfig& displayConfig,
         const FrameTimer& frameTimer,
-        RendererStatistics& stats)
+        RendererStatistics& stats,
+        WorkerThreadPool* decompressionThreadPool,
+        ProgramUniformCache* uniformCache)
         : m_resources(resources)
         , m_uploader{ std::move(uploader) }
         , m_renderBackend(renderBackend)
         , m_asyncEffectUploader(asyncEffectUploader)
+        , m_asyncResourceUploadEnabled(displayConfig.isAsyncResourceUploadEnabled())
         , m_frameTimer(frameTimer)
         , m_resourceCacheSize(displayConfig.getGPUMemoryCacheSize())
         , m_resourceUploadBatchSize(displayConfig.getResourceUploadBatchSize())
         , m_stats(stats)
+        , m_decompressionThreadPool(decompressionThreadPool)
+        , m_uniformCache(uniformCache)
         , m_scenePriorities(displayConfig.getScenePriorities())
     {
         assert(m_uploader);
@@ -78,6 +84,7 @@ namespace ramses::internal
         unloadResources(resourcesToUnload);
         uploadResources(resourcesToUpload);
         syncEffects();
+        syncResources();
 
         m_stats.setVRAMUsage(m_resourceTotalUploadedSize, m_resourceCacheSize);
     }
@@ -118,6 +125,7 @@ namespace ramses::internal
             {
                 const auto& rd = m_resources.getResourceDescriptor(hash);
                 const auto deviceHandle = m_renderBackend.getDevice().registerShader(std::move(e.second));
+                invalidateProgramUniforms(deviceHandle);
                 const auto resourceSize = rd.decompressedSize;
                 m_resourceSizes.put(hash, resourceSize);
                 m_resourceTotalUploadedSize += resourceSize;
@@ -136,6 +144,43 @@ namespace ramses::internal
         m_effectsUploadedTemp.clear();
     }
 
+    void ResourceUploadingManager::syncResources()
+    {
+        if (!m_asyncResourceUploadEnabled)
+            return;
+
+        m_asyncEffectUploader.syncResources(m_resourcesToUpload, m_resourcesUploadedTemp);
+        m_resourcesToUpload.clear();
+
+        for (auto& uploaded : m_resourcesUploadedTemp)
+        {
+            const auto& hash = uploaded.hash;
+            if (!m_resources.containsResource(hash) || m_resources.getResourceStatus(hash) != EResourceStatus::ScheduledForUpload)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncResources unexpected resource uploaded, will be ignored because it is not scheduled for upload #{}", hash);
+                assert(false);
+                continue;
+            }
+
+            if (uploaded.gpuResource)
+            {
+                const auto resourceSize = m_resources.getResourceDescriptor(hash).decompressedSize;
+                const auto deviceHandle = m_renderBackend.getDevice().registerResource(std::move(uploaded.gpuResource));
+                m_resourceSizes.put(hash, resourceSize);
+                m_resourceTotalUploadedSize += resourceSize;
+                m_resources.setResourceUploaded(hash, deviceHandle, uploaded.vramSize);
+                m_stats.asyncResourceUploaded(uploaded.latency);
+            }
+            else
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncResources failed to upload resource #{}", hash);
+                m_resources.setResourceBroken(hash);
+            }
+        }
+
+        m_resourcesUploadedTemp.clear();
+    }
+
     void ResourceUploadingManager::uploadResources(const ResourceContentHashVector& resourcesToUpload)
     {
         assert(m_resourceUploadBatchSize > 0u);
@@ -180,8 +225,19 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::uploadResource upload resource of type {}", EnumToString(rd.type));
 
         const IResource* pResource = rd.resource.get();
+        if (m_asyncResourceUploadEnabled && rd.type != EResourceType::Effect)
+        {
+            // decompression and upload done in resource upload thread
+            m_resourcesToUpload.push_back(pResource);
+            m_resources.setResourceScheduledForUpload(rd.hash);
+            return;
+        }
+
         // decompress resource if needed
-        pResource->decompress();
+        if (m_decompressionThreadPool)
+            pResource->decompress(*m_decompressionThreadPool);
+        else
+            pResource->decompress();
         assert(pResource->isDeCompressedAvailable());
 
         const uint32_t resourceSize = pResource->getDecompressedDataSize();
@@ -192,6 +248,8 @@ namespace ramses::internal
         {
             if (deviceHandle.value().isValid())
             {
+                if (rd.type == EResourceType::Effect)
+                    invalidateProgramUniforms(deviceHandle.value());
                 m_resourceSizes.put(rd.hash, resourceSize);
                 m_resourceTotalUploadedSize += resourceSize;
                 // will also release reference to data (release from system memory if last holder)
@@ -222,6 +280,8 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::unloadResource delete resource of type {}", EnumToString(rd.type));
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Unloading resource #{}", rd.hash);
         m_uploader->unloadResource(m_renderBackend, rd.type, rd.hash, rd.deviceHandle);
+        if (rd.type == EResourceType::Effect)
+            invalidateProgramUniforms(rd.deviceHandle);
 
         auto resSizeIt = m_resourceSizes.find(rd.hash);
         assert(m_resourceTotalUploadedSize >= resSizeIt->value);
@@ -232,6 +292,13 @@ namespace ramses::internal
         m_resources.unregisterResource(rd.hash);
     }
 
+    void ResourceUploadingManager::invalidateProgramUniforms(DeviceResourceHandle shaderDeviceHandle)
+    {
+        // device handle of deleted program can be reused by next uploaded program which does not hold any of the old values
+        if (m_uniformCache)
+            m_uniformCache->invalidateProgram(shaderDeviceHandle);
+    }
+
     void ResourceUploadingManager::getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, uint64_t sizeToBeFreed, bool keepEffects) const
     {
         assert(resourcesToUnload.empty());
@@ -22,6 +22,8 @@ namespace ramses::internal
     class FrameTimer;
     class RendererStatistics;
     class DisplayConfig;
+    class WorkerThreadPool;
+    class ProgramUniformCache;
 
     class ResourceUploadingManager
     {
@@ -33,7 +35,9 @@ namespace ramses::internal
             AsyncEffectUploader& asyncEffectUploader,
             const DisplayConfig& displayConfig,
             const FrameTimer& frameTimer,
-            RendererStatistics& stats);
+            RendererStatistics& stats,
+            WorkerThreadPool* decompressionThreadPool = nullptr,
+            ProgramUniformCache* uniformCache = nullptr);
         ~ResourceUploadingManager();
 
         [[nodiscard]] bool hasAnythingToUpload() const;
@@ -50,8 +54,10 @@ namespace ramses::internal
         void unloadResources(const ResourceContentHashVector& resourcesToUnload);
         void uploadResources(const ResourceContentHashVector& resourcesToUpload);
         void syncEffects();
+        void syncResources();
         void uploadResource(const ResourceDescriptor& rd);
         void unloadResource(const ResourceDescriptor& rd);
+        void invalidateProgramUniforms(DeviceResourceHandle shaderDeviceHandle);
         void getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, uint64_t sizeToBeFreed, bool keepEffects = true) const;
         void getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, uint64_t& totalSize) const;
         [[nodiscard]] int32_t getScenePriority(const ResourceDescriptor& rd) const;
@@ -63,6 +69,9 @@ namespace ramses::internal
         AsyncEffectUploader&            m_asyncEffectUploader;
         EffectsRawResources             m_effectsToUpload;
         EffectsGpuResources             m_effectsUploadedTemp; //to avoid re-allocation each frame
+        const bool                      m_asyncResourceUploadEnabled;
+        DataRawResources                m_resourcesToUpload;
+        DataGpuResources                m_resourcesUploadedTemp; //to avoid re-allocation each frame
 
         const FrameTimer& m_frameTimer;
 
@@ -73,6 +82,10 @@ namespace ramses::internal
         const uint32_t  m_resourceUploadBatchSize   = 10u;
 
         RendererStatistics& m_stats;
+        // if set, large resources are decompressed concurrently
+        WorkerThreadPool* m_decompressionThreadPool;
+        // if set, uniform values remembered for a shader program are forgotten when program is uploaded or deleted
+        ProgramUniformCache* m_uniformCache;
 
         std::unordered_map<SceneId, int32_t> m_scenePriorities;
         mutable std::map<int32_t, ResourceContentHashVector> m_buckets;
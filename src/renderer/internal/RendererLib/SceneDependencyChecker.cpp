@@ -9,6 +9,8 @@
 #include "internal/RendererLib/SceneDependencyChecker.h"
 #include "internal/RendererLib/Types.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     SceneDependencyChecker::SceneDependencyChecker() = default;
@@ -63,6 +65,16 @@ namespace ramses::internal
         return m_sceneOrderList;
     }
 
+    const std::vector<SceneIdVector>& SceneDependencyChecker::getDependentScenesInLevels() const
+    {
+        if (m_dirty)
+        {
+            updateSceneOrder();
+        }
+
+        return m_sceneLevels;
+    }
+
     void SceneDependencyChecker::removeScene(SceneId scene)
     {
         m_consumerToProvidersMap.remove(scene);
@@ -172,6 +184,24 @@ namespace ramses::internal
             }
         }
 
+        // providers are always ordered before their consumers, level of scene is one above its highest provider level
+        m_sceneLevels.clear();
+        HashMap<SceneId, size_t> sceneToLevel;
+        for (const auto scene : m_sceneOrderList)
+        {
+            size_t level = 0u;
+            if (m_consumerToProvidersMap.contains(scene))
+            {
+                for (const auto provider : *m_consumerToProvidersMap.get(scene))
+                    level = std::max(level, *sceneToLevel.get(provider) + 1u);
+            }
+            sceneToLevel.put(scene, level);
+
+            if (m_sceneLevels.size() <= level)
+                m_sceneLevels.resize(level + 1u);
+            m_sceneLevels[level].push_back(scene);
+        }
+
         m_dirty = false;
     }
 
@@ -25,6 +25,9 @@ namespace ramses::internal
         bool hasDependencyAsConsumer(SceneId scene) const;
         void removeScene(SceneId scene);
         const SceneIdVector& getDependentScenesInOrder() const;
+        // Same scenes as in getDependentScenesInOrder grouped by dependency level,
+        // scenes within one level do not depend on each other and depend only on scenes from lower levels
+        const std::vector<SceneIdVector>& getDependentScenesInLevels() const;
         bool isEmpty() const;
 
     private:
@@ -35,6 +38,7 @@ namespace ramses::internal
         ConsumerToProvidersMap m_consumerToProvidersMap;
 
         mutable SceneIdVector m_sceneOrderList;
+        mutable std::vector<SceneIdVector> m_sceneLevels;
         mutable bool m_dirty{false};
     };
 }
@@ -0,0 +1,17 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
+
+namespace ramses::internal
+{
+    void SceneUpdateThreadPool::execute(const SceneIdVector& scenes, const SceneUpdateFunc& updateFunc)
+    {
+        execute(scenes.size(), [&scenes, &updateFunc](size_t idx) { updateFunc(scenes[idx]); });
+    }
+}
@@ -0,0 +1,32 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
+
+#include <functional>
+
+namespace ramses::internal
+{
+    // Executes per scene work concurrently on a set of worker threads.
+    // Calling thread takes part in execution and returns only once work for all given scenes is finished,
+    // so the caller is responsible for passing only scenes which can be processed independently.
+    // Indexed execute() is used for work within single scene which is known to be independent.
+    class SceneUpdateThreadPool : public WorkerThreadPool
+    {
+    public:
+        using SceneUpdateFunc = std::function<void(SceneId)>;
+
+        using WorkerThreadPool::WorkerThreadPool;
+        using WorkerThreadPool::execute;
+
+        void execute(const SceneIdVector& scenes, const SceneUpdateFunc& updateFunc);
+    };
+}
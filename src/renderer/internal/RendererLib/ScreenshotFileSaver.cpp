@@ -0,0 +1,87 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ScreenshotFileSaver.h"
+#include "internal/Core/Utils/Image.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+namespace ramses::internal
+{
+    ScreenshotFileSaver::ScreenshotFileSaver()
+        : m_thread{ "ScreenshotSave" }
+    {
+    }
+
+    ScreenshotFileSaver::~ScreenshotFileSaver()
+    {
+        if (m_thread.joinable())
+        {
+            {
+                //call thread cancel inside critical section to avoid missing wake up in run()
+                std::lock_guard<std::mutex> lock{ m_mutex };
+                m_thread.cancel();
+            }
+            m_conditionVar.notify_one();
+            m_thread.join();
+        }
+        assert(m_screenshotsToSave.empty());
+    }
+
+    void ScreenshotFileSaver::save(ScreenshotInfo&& screenshot)
+    {
+        assert(!screenshot.filename.empty());
+        {
+            std::lock_guard<std::mutex> lock{ m_mutex };
+            m_screenshotsToSave.push_back(std::move(screenshot));
+        }
+
+        if (!m_thread.joinable())
+            m_thread.start(*this);
+        m_conditionVar.notify_one();
+    }
+
+    void ScreenshotFileSaver::run()
+    {
+        std::unique_lock<std::mutex> lock{ m_mutex };
+        for (;;)
+        {
+            m_conditionVar.wait(lock, [this] { return !m_screenshotsToSave.empty() || isCancelRequested(); });
+
+            // pending screenshots are saved also when cancelled so that no requested file gets lost
+            if (m_screenshotsToSave.empty())
+                break;
+
+            ScreenshotInfo screenshot = std::move(m_screenshotsToSave.front());
+            m_screenshotsToSave.pop_front();
+
+            lock.unlock();
+            SaveToFile(screenshot);
+            lock.lock();
+        }
+    }
+
+    void ScreenshotFileSaver::SaveToFile(const ScreenshotInfo& screenshot)
+    {
+        // flip image vertically so that the layout read from frame buffer (bottom-up)
+        // is converted to layout normally used in image files (top-down)
+        const Image bitmap(screenshot.rectangle.width, screenshot.rectangle.height, screenshot.pixelData.cbegin(), screenshot.pixelData.cend(), true);
+        bitmap.saveToFilePNG(screenshot.filename);
+        LOG_INFO(CONTEXT_RENDERER, "ScreenshotFileSaver::SaveToFile: screenshot successfully saved to file: {}", screenshot.filename);
+        if (screenshot.sendViaDLT)
+        {
+            if (GetRamsesLogger().transmitFile(screenshot.filename, false))
+            {
+                LOG_INFO(CONTEXT_RENDERER, "ScreenshotFileSaver::SaveToFile: started dlt file transfer: {}", screenshot.filename);
+            }
+            else
+            {
+                LOG_WARN(CONTEXT_RENDERER, "ScreenshotFileSaver::SaveToFile: screenshot file could not send via dlt: {}", screenshot.filename);
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/Types.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses::internal
+{
+    // Encodes screenshots to PNG and writes them to file (optionally transmits them via DLT) in a worker thread,
+    // so that rendering loop is not blocked by image encoding and file IO.
+    // Thread is started with first screenshot, all queued screenshots are saved before destruction.
+    class ScreenshotFileSaver : private Runnable
+    {
+    public:
+        ScreenshotFileSaver();
+        ~ScreenshotFileSaver() override;
+
+        ScreenshotFileSaver(const ScreenshotFileSaver&) = delete;
+        ScreenshotFileSaver(ScreenshotFileSaver&&) = delete;
+        ScreenshotFileSaver& operator=(const ScreenshotFileSaver&) = delete;
+        ScreenshotFileSaver& operator=(ScreenshotFileSaver&&) = delete;
+
+        void save(ScreenshotInfo&& screenshot);
+
+        static void SaveToFile(const ScreenshotInfo& screenshot);
+
+    private:
+        void run() override;
+
+        PlatformThread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_conditionVar;
+        std::deque<ScreenshotInfo> m_screenshotsToSave;
+    };
+}
@@ -92,6 +92,9 @@ namespace ramses::internal
             return SceneLinkScene::updateMatrixCache(matrixType, node);
         }
 
+        if (node.isValid() && !isMatrixCacheDirty(matrixType, node))
+            return getMatrixCacheEntry(node).m_matrix[matrixType];
+
         glm::mat4 chainMatrix = SceneLinkScene::findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(matrixType, node, m_dirtyNodes);
 
         // update cache for all transforms for the nodes we collected
@@ -105,6 +108,14 @@ namespace ramses::internal
         return chainMatrix;
     }
 
+    void TransformationLinkCachedScene::updateWorldMatricesBreadthFirstWithLinks()
+    {
+        // consumer nodes take their matrix from provider scene which is resolved lazily only,
+        // lazy update via updateMatrixCacheWithLinks is used as fallback
+        if (!m_sceneLinksManager.getTransformationLinkManager().getDependencyChecker().hasDependencyAsConsumer(getSceneId()))
+            SceneLinkScene::updateWorldMatricesBreadthFirst();
+    }
+
     void TransformationLinkCachedScene::getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const
     {
         if (m_sceneLinksManager.getTransformationLinkManager().nodeHasDataLinkToProvider(getSceneId(), node))
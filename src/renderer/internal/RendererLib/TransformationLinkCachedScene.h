@@ -27,6 +27,7 @@ namespace ramses::internal
 
         void                    releaseDataSlot(DataSlotHandle handle) override;
         [[nodiscard]] glm::mat4 updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const;
+        void      updateWorldMatricesBreadthFirstWithLinks();
         void      propagateDirtyToConsumers(NodeHandle node) const;
 
     private:
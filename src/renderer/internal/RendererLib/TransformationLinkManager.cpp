@@ -11,6 +11,8 @@
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/RendererLib/DataLinkUtils.h"
 
+#include <tuple>
+
 namespace ramses::internal
 {
     TransformationLinkManager::TransformationLinkManager(RendererScenes& rendererScenes)
@@ -109,6 +111,23 @@ namespace ramses::internal
         return providerScene.updateMatrixCacheWithLinks(matrixType, providerNodeHandle);
     }
 
+    void TransformationLinkManager::updateProvidedTransformations(SceneId providerSceneId) const
+    {
+        if (!getSceneLinks().hasAnyLinksToConsumer(providerSceneId))
+            return;
+
+        SceneLinkVector links;
+        getSceneLinks().getLinkedConsumers(providerSceneId, links);
+
+        const TransformationLinkCachedScene& providerScene = m_scenes.getScene(providerSceneId);
+        for (const auto& link : links)
+        {
+            const NodeHandle providerNodeHandle = providerScene.getDataSlot(link.providerSlot).attachedNode;
+            std::ignore = providerScene.updateMatrixCacheWithLinks(ETransformationMatrixType_World, providerNodeHandle);
+            std::ignore = providerScene.updateMatrixCacheWithLinks(ETransformationMatrixType_Object, providerNodeHandle);
+        }
+    }
+
     void TransformationLinkManager::propagateTransformationDirtinessToConsumers(SceneId providerSceneId, NodeHandle providerNodeHandle) const
     {
         const DataSlotHandle providerSlotHandle = getDataSlotForNode(providerSceneId, providerNodeHandle);
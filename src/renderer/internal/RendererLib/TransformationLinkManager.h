@@ -30,6 +30,8 @@ namespace ramses::internal
 
         [[nodiscard]] glm::mat4                 getLinkedTransformationFromDataProvider(ETransformationMatrixType matrixType, SceneId consumerSceneId, NodeHandle consumerNodeHandle) const;
         void                      propagateTransformationDirtinessToConsumers(SceneId providerSceneId, NodeHandle providerNodeHandle) const;
+        // updates matrix cache of all provider nodes of given scene so that consumers only read provider scene
+        void                      updateProvidedTransformations(SceneId providerSceneId) const;
 
         using LinkManagerBase::getDependencyChecker;
         using LinkManagerBase::getSceneLinks;
@@ -89,6 +89,8 @@ namespace ramses::internal
         bool                 fullScreen{false};
         bool                 sendViaDLT{false};
         std::vector<uint8_t> pixelData;
+        // set while asynchronous read back of pixel data is in flight
+        DeviceResourceHandle pendingReadback;
     };
     using ScreenshotInfoVector = std::vector<ScreenshotInfo>;
 
@@ -0,0 +1,132 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include <array>
+#include <tuple>
+
+namespace ramses::internal
+{
+    static const DataFieldInfoVector UniformFields{
+        DataFieldInfo{ EDataType::Matrix44F },
+        DataFieldInfo{ EDataType::Vector4F },
+        DataFieldInfo{ EDataType::Float },
+        DataFieldInfo{ EDataType::Vector4F, 8u } };
+    static const DataFieldInfoVector GeometryFields{
+        DataFieldInfo{ EDataType::Indices },
+        DataFieldInfo{ EDataType::Vector3Buffer },
+        DataFieldInfo{ EDataType::Vector2Buffer } };
+
+    // mimics typical scene content, uniform and geometry instances are allocated interleaved
+    // and all uniforms are set
+    static void CreateDataInstances(IScene& scene, uint32_t instanceCount)
+    {
+        const DataLayoutHandle uniformLayout = scene.allocateDataLayout(UniformFields, ResourceContentHash::Invalid(), {});
+        const DataLayoutHandle geometryLayout = scene.allocateDataLayout(GeometryFields, ResourceContentHash::Invalid(), {});
+        const glm::mat4 identity{ 1.f };
+        const std::array<glm::vec4, 8u> vec4Array{};
+        for (uint32_t i = 0u; i < instanceCount; ++i)
+        {
+            const DataInstanceHandle uniforms = scene.allocateDataInstance(uniformLayout, {});
+            std::ignore = scene.allocateDataInstance(geometryLayout, {});
+            scene.setDataMatrix44fArray(uniforms, DataFieldHandle{ 0u }, 1u, &identity);
+            scene.setDataVector4fArray(uniforms, DataFieldHandle{ 1u }, 1u, &vec4Array.front());
+            const auto value = static_cast<float>(i);
+            scene.setDataFloatArray(uniforms, DataFieldHandle{ 2u }, 1u, &value);
+            scene.setDataVector4fArray(uniforms, DataFieldHandle{ 3u }, 8u, vec4Array.data());
+        }
+    }
+
+    static void CreateScene(Scene& scene, bool useArena, uint32_t instanceCount)
+    {
+        if (useArena)
+            scene.enableDataInstanceArena();
+        CreateDataInstances(scene, instanceCount);
+    }
+
+    // ARG 0: data instance storage (0 = individual heap blocks, 1 = arena)
+    // ARG 1: uniform data instance count
+    static void BM_DataInstances_Create(benchmark::State& state)
+    {
+        const bool useArena = (state.range(0) != 0);
+        const auto instanceCount = static_cast<uint32_t>(state.range(1));
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            Scene scene;
+            CreateScene(scene, useArena, instanceCount);
+            benchmark::DoNotOptimize(scene.getDataInstanceCount());
+        }
+    }
+
+    BENCHMARK(BM_DataInstances_Create)->ArgsProduct({ {0, 1}, {1000, 10000} })->Unit(benchmark::kMicrosecond);
+
+    // ARG 0: data instance storage (0 = individual heap blocks, 1 = arena)
+    // ARG 1: uniform data instance count
+    static void BM_DataInstances_ApplySceneActions(benchmark::State& state)
+    {
+        const bool useArena = (state.range(0) != 0);
+        const auto instanceCount = static_cast<uint32_t>(state.range(1));
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.allocateDataLayout(UniformFields, ResourceContentHash::Invalid(), DataLayoutHandle{ 0u });
+        creator.allocateDataLayout(GeometryFields, ResourceContentHash::Invalid(), DataLayoutHandle{ 1u });
+        const glm::mat4 identity{ 1.f };
+        const std::array<glm::vec4, 8u> vec4Array{};
+        for (uint32_t i = 0u; i < instanceCount; ++i)
+        {
+            const DataInstanceHandle uniforms{ 2u * i };
+            creator.allocateDataInstance(DataLayoutHandle{ 0u }, uniforms);
+            creator.allocateDataInstance(DataLayoutHandle{ 1u }, DataInstanceHandle{ 2u * i + 1u });
+            creator.setDataMatrix44fArray(uniforms, DataFieldHandle{ 0u }, 1u, &identity);
+            creator.setDataVector4fArray(uniforms, DataFieldHandle{ 1u }, 1u, &vec4Array.front());
+            const auto value = static_cast<float>(i);
+            creator.setDataFloatArray(uniforms, DataFieldHandle{ 2u }, 1u, &value);
+            creator.setDataVector4fArray(uniforms, DataFieldHandle{ 3u }, 8u, vec4Array.data());
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            Scene scene;
+            if (useArena)
+                scene.enableDataInstanceArena();
+            SceneActionApplier::ApplyActionsOnScene(scene, actions);
+            benchmark::DoNotOptimize(scene.getDataInstanceCount());
+        }
+    }
+
+    BENCHMARK(BM_DataInstances_ApplySceneActions)->ArgsProduct({ {0, 1}, {1000, 10000} })->Unit(benchmark::kMicrosecond);
+
+    // ARG 0: data instance storage (0 = individual heap blocks, 1 = arena)
+    // ARG 1: uniform data instance count
+    static void BM_DataInstances_FetchUniforms(benchmark::State& state)
+    {
+        const bool useArena = (state.range(0) != 0);
+        const auto instanceCount = static_cast<uint32_t>(state.range(1));
+        Scene scene;
+        CreateScene(scene, useArena, instanceCount);
+
+        // mimics render loop which reads all uniforms of every renderable each frame
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (uint32_t i = 0u; i < instanceCount; ++i)
+            {
+                const DataInstanceHandle uniforms{ 2u * i };
+                benchmark::DoNotOptimize(*scene.getDataMatrix44fArray(uniforms, DataFieldHandle{ 0u }));
+                benchmark::DoNotOptimize(*scene.getDataVector4fArray(uniforms, DataFieldHandle{ 1u }));
+                benchmark::DoNotOptimize(*scene.getDataFloatArray(uniforms, DataFieldHandle{ 2u }));
+                benchmark::DoNotOptimize(scene.getDataVector4fArray(uniforms, DataFieldHandle{ 3u })[7]);
+            }
+        }
+    }
+
+    BENCHMARK(BM_DataInstances_FetchUniforms)->ArgsProduct({ {0, 1}, {1000, 10000} });
+}
@@ -0,0 +1,158 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include <vector>
+
+namespace ramses::internal
+{
+    // handles are dense indices, resource hashes are effectively random
+    template <typename Key>
+    static std::vector<Key> CreateKeys(uint32_t count);
+
+    template <>
+    std::vector<NodeHandle> CreateKeys<NodeHandle>(uint32_t count)
+    {
+        std::vector<NodeHandle> keys;
+        keys.reserve(count);
+        for (uint32_t i = 0u; i < count; ++i)
+            keys.emplace_back(i);
+        return keys;
+    }
+
+    template <>
+    std::vector<ResourceContentHash> CreateKeys<ResourceContentHash>(uint32_t count)
+    {
+        std::vector<ResourceContentHash> keys;
+        keys.reserve(count);
+        for (uint32_t i = 0u; i < count; ++i)
+            keys.emplace_back(HashValue(i, 1u), HashValue(i, 2u));
+        return keys;
+    }
+
+    template <typename Map, typename Key>
+    static Map CreateMap(const std::vector<Key>& keys)
+    {
+        Map map;
+        for (uint32_t i = 0u; i < keys.size(); ++i)
+            map.put(keys[i], i);
+        return map;
+    }
+
+    template <typename Map, typename Key>
+    static void RunInsert(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<Key>(static_cast<uint32_t>(state.range(1)));
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            Map map;
+            for (uint32_t i = 0u; i < keys.size(); ++i)
+                map.put(keys[i], i);
+            benchmark::DoNotOptimize(map.size());
+        }
+    }
+
+    template <typename Map, typename Key>
+    static void RunLookup(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<Key>(static_cast<uint32_t>(state.range(1)));
+        const auto map = CreateMap<Map>(keys);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (const auto& key : keys)
+                benchmark::DoNotOptimize(map.get(key));
+        }
+    }
+
+    template <typename Map, typename Key>
+    static void RunEraseAndInsert(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<Key>(static_cast<uint32_t>(state.range(1)));
+        auto map = CreateMap<Map>(keys);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // erase and reinsert every other element so that map size stays stable between iterations
+            for (size_t i = 0u; i < keys.size(); i += 2u)
+                map.remove(keys[i]);
+            for (size_t i = 0u; i < keys.size(); i += 2u)
+                map.put(keys[i], static_cast<uint32_t>(i));
+            benchmark::DoNotOptimize(map.size());
+        }
+    }
+
+    template <typename Map, typename Key>
+    static void RunIterate(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<Key>(static_cast<uint32_t>(state.range(1)));
+        const auto map = CreateMap<Map>(keys);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            uint32_t sum = 0u;
+            for (const auto& entry : map)
+                sum += entry.value;
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    // ARG 0: map type (0 = HashMap, 1 = FlatHashMap)
+    // ARG 1: element count
+    template <typename Key>
+    static void BM_HashMap_Insert(benchmark::State& state)
+    {
+        if (state.range(0) == 0)
+            RunInsert<HashMap<Key, uint32_t>, Key>(state);
+        else
+            RunInsert<FlatHashMap<Key, uint32_t>, Key>(state);
+    }
+
+    // ARG 0: map type (0 = HashMap, 1 = FlatHashMap)
+    // ARG 1: element count
+    template <typename Key>
+    static void BM_HashMap_Lookup(benchmark::State& state)
+    {
+        if (state.range(0) == 0)
+            RunLookup<HashMap<Key, uint32_t>, Key>(state);
+        else
+            RunLookup<FlatHashMap<Key, uint32_t>, Key>(state);
+    }
+
+    // ARG 0: map type (0 = HashMap, 1 = FlatHashMap)
+    // ARG 1: element count
+    template <typename Key>
+    static void BM_HashMap_EraseAndInsert(benchmark::State& state)
+    {
+        if (state.range(0) == 0)
+            RunEraseAndInsert<HashMap<Key, uint32_t>, Key>(state);
+        else
+            RunEraseAndInsert<FlatHashMap<Key, uint32_t>, Key>(state);
+    }
+
+    // ARG 0: map type (0 = HashMap, 1 = FlatHashMap)
+    // ARG 1: element count
+    template <typename Key>
+    static void BM_HashMap_Iterate(benchmark::State& state)
+    {
+        if (state.range(0) == 0)
+            RunIterate<HashMap<Key, uint32_t>, Key>(state);
+        else
+            RunIterate<FlatHashMap<Key, uint32_t>, Key>(state);
+    }
+
+    BENCHMARK_TEMPLATE(BM_HashMap_Insert, NodeHandle)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_Insert, ResourceContentHash)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_Lookup, NodeHandle)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_Lookup, ResourceContentHash)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_EraseAndInsert, NodeHandle)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_EraseAndInsert, ResourceContentHash)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_Iterate, NodeHandle)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK_TEMPLATE(BM_HashMap_Iterate, ResourceContentHash)->ArgsProduct({ {0, 1}, {100, 10000, 1000000} })->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,143 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#if defined(HAS_TCP_COMM) && !defined(_WIN32)
+
+#include "internal/Communication/TransportTCP/TCPConnectionSystem.h"
+#include "internal/Communication/TransportCommon/ServiceHandlerInterfaces.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace ramses::internal
+{
+    class ReceivedRendererEventCounter : public ISceneProviderServiceHandler
+    {
+    public:
+        void handleSubscribeScene(const SceneId& /*sceneId*/, const Guid& /*consumerID*/) override {}
+        void handleUnsubscribeScene(const SceneId& /*sceneId*/, const Guid& /*consumerID*/) override {}
+
+        void handleRendererEvent(const SceneId& /*sceneId*/, const std::vector<std::byte>& /*data*/, const Guid& /*rendererId*/) override
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            ++m_received;
+            m_condition.notify_one();
+        }
+
+        bool waitForEvents(uint64_t count, std::chrono::milliseconds timeout)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!m_condition.wait_for(lock, timeout, [&]() { return m_received >= count; }))
+                return false;
+            m_received -= count;
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        uint64_t m_received = 0u;
+    };
+
+    // daemon and two participants connected with given protocol, as set up by RamsesFramework
+    class ConnectedParticipants
+    {
+    public:
+        explicit ConnectedParticipants(EConnectionProtocol protocol)
+        {
+            const uint16_t daemonPort = 5979u;
+            const bool isLocal = (protocol == EConnectionProtocol::Local);
+            const Guid daemonId = TCPConnectionSystem::GetDaemonId();
+            const NetworkParticipantAddress daemonAddress(daemonId, "SM", isLocal ? TCPConnectionSystem::GetLocalSocketPath({}, daemonId, daemonPort) : "127.0.0.1", daemonPort);
+            const auto createParticipantAddress = [&](const Guid& id, std::string_view name) {
+                return NetworkParticipantAddress(id, name, isLocal ? TCPConnectionSystem::GetLocalSocketPath({}, id, 0u) : "127.0.0.1", 0u);
+            };
+
+            m_daemon = std::make_unique<TCPConnectionSystem>(daemonAddress, 0u, NetworkParticipantAddress(), true, m_daemonLock, m_statistics,
+                std::chrono::milliseconds{1000}, std::chrono::milliseconds{10000}, 256u * 1024u, protocol);
+            m_sender = std::make_unique<TCPConnectionSystem>(createParticipantAddress(SenderId, "sender"), 0u, daemonAddress, false, m_senderLock, m_statistics,
+                std::chrono::milliseconds{1000}, std::chrono::milliseconds{10000}, 256u * 1024u, protocol);
+            m_receiver = std::make_unique<TCPConnectionSystem>(createParticipantAddress(ReceiverId, "receiver"), 0u, daemonAddress, false, m_receiverLock, m_statistics,
+                std::chrono::milliseconds{1000}, std::chrono::milliseconds{10000}, 256u * 1024u, protocol);
+            m_receiver->setSceneProviderServiceHandler(&m_receivedEvents);
+
+            m_daemon->connectServices();
+            m_sender->connectServices();
+            m_receiver->connectServices();
+
+            // participants connect to each other after both registered at daemon, probe until first event arrives
+            do
+            {
+                send(std::vector<std::byte>(1u));
+            } while (!m_receivedEvents.waitForEvents(1u, std::chrono::milliseconds{10}));
+        }
+
+        ~ConnectedParticipants()
+        {
+            m_receiver->disconnectServices();
+            m_sender->disconnectServices();
+            m_daemon->disconnectServices();
+            m_receiver->setSceneProviderServiceHandler(nullptr);
+        }
+
+        ConnectedParticipants(const ConnectedParticipants&) = delete;
+        ConnectedParticipants& operator=(const ConnectedParticipants&) = delete;
+
+        void send(const std::vector<std::byte>& data)
+        {
+            PlatformGuard guard(m_senderLock);
+            m_sender->sendRendererEvent(ReceiverId, SceneId{ 1u }, data);
+        }
+
+        void waitForReceived(uint64_t count)
+        {
+            while (!m_receivedEvents.waitForEvents(count, std::chrono::milliseconds{1000}))
+            {
+            }
+        }
+
+    private:
+        static inline const Guid SenderId{ 111u };
+        static inline const Guid ReceiverId{ 222u };
+
+        PlatformLock m_daemonLock;
+        PlatformLock m_senderLock;
+        PlatformLock m_receiverLock;
+        StatisticCollectionFramework m_statistics;
+        ReceivedRendererEventCounter m_receivedEvents;
+        std::unique_ptr<TCPConnectionSystem> m_daemon;
+        std::unique_ptr<TCPConnectionSystem> m_sender;
+        std::unique_ptr<TCPConnectionSystem> m_receiver;
+    };
+
+    // Sends messages from one participant to another on same host and waits until all were received
+    // ARG 0: protocol (0 = TCP loopback, 1 = local Unix domain socket, see EConnectionSystem::Local)
+    // ARG 1: message size in bytes
+    // ARG 2: messages per iteration (1 = latency, more = throughput)
+    static void BM_LocalTransport(benchmark::State& state)
+    {
+        ConnectedParticipants participants{ state.range(0) != 0 ? EConnectionProtocol::Local : EConnectionProtocol::TCP };
+        const std::vector<std::byte> message(static_cast<size_t>(state.range(1)));
+        const auto messageCount = static_cast<uint64_t>(state.range(2));
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (uint64_t i = 0u; i < messageCount; ++i)
+                participants.send(message);
+            participants.waitForReceived(messageCount);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * messageCount * message.size()));
+    }
+
+    BENCHMARK(BM_LocalTransport)->ArgsProduct({ {0, 1}, {64, 32000}, {1, 100} })->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
+
+#endif
@@ -0,0 +1,57 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+
+namespace ramses::internal
+{
+    // resources of 1MB each with partially repetitive content, so that LZ4 has some work to do
+    static ManagedResourceVector CreateResources(uint32_t resourceCount)
+    {
+        ManagedResourceVector resources;
+        resources.reserve(resourceCount);
+        std::vector<float> data(256u * 1024u);
+        for (uint32_t i = 0u; i < resourceCount; ++i)
+        {
+            for (size_t j = 0u; j < data.size(); ++j)
+                data[j] = static_cast<float>((j * 7u + i) % 1000u);
+            resources.push_back(ManagedResource{ new ArrayResource(EResourceType::VertexArray, static_cast<uint32_t>(data.size()), EDataType::Float, data.data(), {}) });
+        }
+        return resources;
+    }
+
+    // ARG 0: compression level (1 = realtime, 2 = offline)
+    // ARG 1: worker thread count (0 = calling thread only, equals former serial compression)
+    // ARG 2: resource count (1MB each)
+    static void BM_ResourceCompression(benchmark::State& state)
+    {
+        const auto level = static_cast<IResource::CompressionLevel>(state.range(0));
+        ResourceCompressionThreadPool threadPool{ static_cast<uint32_t>(state.range(1)) };
+        const auto resourceCount = static_cast<uint32_t>(state.range(2));
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // fresh resources have neither hash nor compressed data
+            state.PauseTiming();
+            auto resources = CreateResources(resourceCount);
+            state.ResumeTiming();
+
+            threadPool.compress(resources, level);
+            benchmark::DoNotOptimize(resources.back()->getCompressedDataSize());
+
+            state.PauseTiming();
+            resources.clear();
+            state.ResumeTiming();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * resourceCount * 1024 * 1024);
+    }
+
+    BENCHMARK(BM_ResourceCompression)->ArgsProduct({ {1, 2}, {0, 1, 3}, {64, 256} })->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,121 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Components/FileInputStreamContainer.h"
+#include "internal/Components/MappedFileInputStreamContainer.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
+#include "internal/Components/ResourcePersistation.h"
+#include "internal/Components/ResourceTableOfContents.h"
+#include "internal/Core/Utils/BinaryFileOutputStream.h"
+#include "internal/SceneGraph/Scene/ClientScene.h"
+#include "internal/SceneGraph/Scene/ScenePersistation.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include <memory>
+
+namespace ramses::internal
+{
+    static std::shared_ptr<IInputStreamContainer> CreateStreamContainer(bool mapped, const char* fileName)
+    {
+        if (mapped)
+            return std::make_shared<MappedFileInputStreamContainer>(fileName);
+        return std::make_shared<FileInputStreamContainer>(fileName);
+    }
+
+    // ARG 0: stream type (0 = file stream, 1 = memory mapped file)
+    // ARG 1: node count
+    static void BM_SceneFileLoading_SceneActions(benchmark::State& state)
+    {
+        const char* fileName = "benchmark_scene.bin";
+        const auto nodeCount = static_cast<uint32_t>(state.range(1));
+        {
+            ClientScene scene;
+            for (uint32_t i = 0u; i < nodeCount; ++i)
+            {
+                const NodeHandle node = scene.allocateNode(0u, {});
+                const TransformHandle transform = scene.allocateTransform(node, {});
+                scene.setTranslation(transform, glm::vec3{ static_cast<float>(i) });
+            }
+            ScenePersistation::WriteSceneToFile(fileName, scene);
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            auto streamContainer = CreateStreamContainer(state.range(0) != 0, fileName);
+            ClientScene loadedScene;
+            ScenePersistation::ReadSceneFromStream(streamContainer->getStream(), loadedScene);
+            benchmark::DoNotOptimize(loadedScene.getTransformCount());
+        }
+
+        File(fileName).remove();
+    }
+
+    BENCHMARK(BM_SceneFileLoading_SceneActions)->ArgsProduct({ {0, 1}, {1000, 100000} })->Unit(benchmark::kMicrosecond);
+
+    static void WriteResourceFile(const char* fileName, uint32_t resourceCount)
+    {
+        std::vector<float> data(16384u);
+        ManagedResourceVector resources;
+        for (uint32_t i = 0u; i < resourceCount; ++i)
+        {
+            data.front() = static_cast<float>(i);
+            resources.push_back(ManagedResource{ new ArrayResource(EResourceType::VertexArray, static_cast<uint32_t>(data.size()), EDataType::Float, data.data(), {}) });
+        }
+        File file(fileName);
+        BinaryFileOutputStream stream(file);
+        ResourcePersistation::WriteNamedResourcesWithTOCToStream(stream, resources, false);
+    }
+
+    // ARG 0: stream type (0 = file stream, 1 = memory mapped file)
+    // ARG 1: resource count
+    static void BM_SceneFileLoading_Resources(benchmark::State& state)
+    {
+        const char* fileName = "benchmark_resources.bin";
+        WriteResourceFile(fileName, static_cast<uint32_t>(state.range(1)));
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            auto streamContainer = CreateStreamContainer(state.range(0) != 0, fileName);
+            ResourceTableOfContents toc;
+            toc.readTOCPosAndTOCFromStream(streamContainer->getStream());
+            for (const auto& entry : toc.getFileContents())
+                benchmark::DoNotOptimize(ResourcePersistation::RetrieveResourceFromStream(streamContainer->getStream(), entry.value));
+        }
+
+        File(fileName).remove();
+    }
+
+    BENCHMARK(BM_SceneFileLoading_Resources)->ArgsProduct({ {0, 1}, {100, 1000} })->Unit(benchmark::kMillisecond);
+
+    // Loads all resources of a file in one batch as done by ResourceComponent (see SceneConfig::setResourcePrefetchEnabled)
+    // ARG 0: stream type (0 = file stream, 1 = memory mapped file)
+    // ARG 1: resource count
+    // ARG 2: worker count (0 = deserialize on calling thread only)
+    static void BM_SceneFileLoading_ResourcesBatched(benchmark::State& state)
+    {
+        const char* fileName = "benchmark_resources_batched.bin";
+        WriteResourceFile(fileName, static_cast<uint32_t>(state.range(1)));
+        ResourceCompressionThreadPool threadPool{ static_cast<uint32_t>(state.range(2)) };
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            auto streamContainer = CreateStreamContainer(state.range(0) != 0, fileName);
+            ResourceTableOfContents toc;
+            toc.readTOCPosAndTOCFromStream(streamContainer->getStream());
+            std::vector<ResourceFileEntry> entries;
+            for (const auto& entry : toc.getFileContents())
+                entries.push_back(entry.value);
+            auto resources = ResourcePersistation::RetrieveResourcesFromStream(streamContainer->getStream(), entries, threadPool);
+            benchmark::DoNotOptimize(resources.data());
+        }
+
+        File(fileName).remove();
+    }
+
+    BENCHMARK(BM_SceneFileLoading_ResourcesBatched)->ArgsProduct({ {0, 1}, {100, 1000}, {0, 3} })->Unit(benchmark::kMillisecond)->UseRealTime();
+}
@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/SceneGraph/Scene/SceneDescriber.h"
+
+namespace ramses::internal
+{
+    static void FillScene(Scene& scene, uint32_t nodeCount)
+    {
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Matrix44F }, DataFieldInfo{ EDataType::Vector4F } }, ResourceContentHash::Invalid(), {});
+        const glm::mat4 matrix{ 1.f };
+        const glm::vec4 vec{ 1.f };
+        for (uint32_t i = 0u; i < nodeCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode(0u, {});
+            scene.setTranslation(scene.allocateTransform(node, {}), glm::vec3{ static_cast<float>(i) });
+            const DataInstanceHandle dataInstance = scene.allocateDataInstance(layout, {});
+            scene.setDataMatrix44fArray(dataInstance, DataFieldHandle{ 0u }, 1u, &matrix);
+            scene.setDataVector4fArray(dataInstance, DataFieldHandle{ 1u }, 1u, &vec);
+        }
+    }
+
+    // Prepares scene actions sent to new subscriber of scene with shadow copy, as done by client when renderer (re)subscribes
+    // ARG 0: mode (0 = describe shadow copy, 1 = copy cached snapshot, see SceneConfig::setSceneSnapshotCachingEnabled)
+    // ARG 1: node count
+    static void BM_SceneResubscribe(benchmark::State& state)
+    {
+        const bool useCachedSnapshot = (state.range(0) != 0);
+        Scene shadowCopy;
+        FillScene(shadowCopy, static_cast<uint32_t>(state.range(1)));
+
+        SceneActionCollection snapshot;
+        SceneActionCollectionCreator snapshotCreator(snapshot);
+        SceneDescriber::describeScene<IScene>(shadowCopy, snapshotCreator);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            SceneActionCollection actions;
+            if (useCachedSnapshot)
+            {
+                actions = snapshot.copy();
+            }
+            else
+            {
+                SceneActionCollectionCreator creator(actions);
+                SceneDescriber::describeScene<IScene>(shadowCopy, creator);
+            }
+            benchmark::DoNotOptimize(actions.collectionData().data());
+        }
+        state.counters["bytes"] = static_cast<double>(snapshot.collectionData().size());
+    }
+
+    BENCHMARK(BM_SceneResubscribe)->ArgsProduct({ {0, 1}, {1000, 10000, 100000} })->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,84 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
+#include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
+#include <deque>
+#include <memory>
+
+namespace ramses::internal
+{
+    // mimics TCPConnectionSystem: packets are written into scratch memory, copied into message buffer
+    // and referenced by out queue of every receiver
+    class SceneUpdateSendQueues
+    {
+    public:
+        explicit SceneUpdateSendQueues(size_t subscriberCount)
+            : m_outQueues(subscriberCount)
+        {
+        }
+
+        void send(size_t firstSubscriber, size_t subscriberCount, const ISceneUpdateSerializer& serializer)
+        {
+            serializer.writeToPackets({ m_packetMem.data(), m_packetMem.size() }, [&](size_t size) {
+                BinaryOutputStream stream(size + 16u);
+                stream << static_cast<uint32_t>(size);
+                stream.write(m_packetMem.data(), size);
+                auto packet = std::make_shared<const std::vector<std::byte>>(stream.release());
+                for (size_t i = firstSubscriber; i < firstSubscriber + subscriberCount; ++i)
+                    m_outQueues[i].push_back(packet);
+                return true;
+            });
+        }
+
+        void clear()
+        {
+            for (auto& queue : m_outQueues)
+                queue.clear();
+        }
+
+    private:
+        std::vector<std::byte> m_packetMem = std::vector<std::byte>(300000u);
+        std::vector<std::deque<std::shared_ptr<const std::vector<std::byte>>>> m_outQueues;
+    };
+
+    // ARG 0: send mode (0 = serialize for each subscriber, 1 = serialize once for all subscribers)
+    // ARG 1: subscriber count
+    static void BM_SceneUpdateSend(benchmark::State& state)
+    {
+        const bool serializeOnce = (state.range(0) != 0);
+        const auto subscriberCount = static_cast<size_t>(state.range(1));
+
+        SceneUpdate update;
+        SceneActionCollectionCreator creator(update.actions);
+        for (uint32_t i = 0u; i < 10000u; ++i)
+            creator.setTranslation(TransformHandle(i), glm::vec3{ static_cast<float>(i) });
+
+        StatisticCollectionScene statistics;
+        SceneUpdateSendQueues queues{ subscriberCount };
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            if (serializeOnce)
+            {
+                queues.send(0u, subscriberCount, SceneUpdateSerializer(update, statistics));
+            }
+            else
+            {
+                for (size_t i = 0u; i < subscriberCount; ++i)
+                    queues.send(i, 1u, SceneUpdateSerializer(update, statistics));
+            }
+            queues.clear();
+        }
+    }
+
+    BENCHMARK(BM_SceneUpdateSend)->ArgsProduct({ {0, 1}, {1, 2, 3, 8} });
+}
@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/SceneGraph/Scene/TransformationCachedScene.h"
+
+namespace ramses::internal
+{
+    class TransformationHierarchy
+    {
+    public:
+        // creates tree where each node has given number of children and a transform
+        TransformationHierarchy(ETransformationUpdateMode mode, uint32_t nodeCount, uint32_t childrenPerNode)
+        {
+            m_scene.setTransformationUpdateMode(mode);
+            m_nodes.reserve(nodeCount);
+            m_transforms.reserve(nodeCount);
+            for (uint32_t i = 0u; i < nodeCount; ++i)
+            {
+                const NodeHandle node = m_scene.allocateNode(0u, {});
+                m_transforms.push_back(m_scene.allocateTransform(node, {}));
+                m_scene.setTranslation(m_transforms.back(), glm::vec3{ 1.f, 0.f, 0.f });
+                if (i > 0u)
+                    m_scene.addChildToNode(m_nodes[(i - 1u) / childrenPerNode], node);
+                m_nodes.push_back(node);
+            }
+        }
+
+        // mimics renderer which queries world matrix of every renderable (here every node) each frame
+        void updateAllWorldMatrices()
+        {
+            m_scene.updateWorldMatricesBreadthFirst();
+            for (const auto node : m_nodes)
+                benchmark::DoNotOptimize(m_scene.updateMatrixCache(ETransformationMatrixType_World, node));
+        }
+
+        TransformationCachedScene m_scene;
+        NodeHandleVector m_nodes;
+        std::vector<TransformHandle> m_transforms;
+    };
+
+    // ARG 0: transformation update mode (0 = lazy, 1 = breadth first)
+    // ARG 1: node count
+    static void BM_TransformationUpdate_ModifyRoot(benchmark::State& state)
+    {
+        TransformationHierarchy hierarchy{ static_cast<ETransformationUpdateMode>(state.range(0)), static_cast<uint32_t>(state.range(1)), 4u };
+        hierarchy.updateAllWorldMatrices();
+
+        float angle = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            angle += 1.f;
+            hierarchy.m_scene.setRotation(hierarchy.m_transforms.front(), glm::vec4{ 0.f, angle, 0.f, 1.f }, ERotationType::Euler_XYZ);
+            hierarchy.updateAllWorldMatrices();
+        }
+    }
+
+    // Modifying root makes every world matrix dirty
+    BENCHMARK(BM_TransformationUpdate_ModifyRoot)->ArgsProduct({ {0, 1}, {1000, 20000} });
+
+    // ARG 0: transformation update mode (0 = lazy, 1 = breadth first)
+    // ARG 1: node count
+    static void BM_TransformationUpdate_ModifyTenPercentOfLeaves(benchmark::State& state)
+    {
+        const auto nodeCount = static_cast<uint32_t>(state.range(1));
+        TransformationHierarchy hierarchy{ static_cast<ETransformationUpdateMode>(state.range(0)), nodeCount, 4u };
+        hierarchy.updateAllWorldMatrices();
+
+        float angle = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            angle += 1.f;
+            for (uint32_t i = nodeCount - 1u; i > nodeCount - nodeCount / 10u; --i)
+                hierarchy.m_scene.setRotation(hierarchy.m_transforms[i], glm::vec4{ 0.f, angle, 0.f, 1.f }, ERotationType::Euler_XYZ);
+            hierarchy.updateAllWorldMatrices();
+        }
+    }
+
+    BENCHMARK(BM_TransformationUpdate_ModifyTenPercentOfLeaves)->ArgsProduct({ {0, 1}, {1000, 20000} });
+
+    // ARG 0: transformation update mode (0 = lazy, 1 = breadth first)
+    // ARG 1: node count
+    static void BM_TransformationUpdate_NoModification(benchmark::State& state)
+    {
+        TransformationHierarchy hierarchy{ static_cast<ETransformationUpdateMode>(state.range(0)), static_cast<uint32_t>(state.range(1)), 4u };
+        hierarchy.updateAllWorldMatrices();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            hierarchy.updateAllWorldMatrices();
+        }
+    }
+
+    BENCHMARK(BM_TransformationUpdate_NoModification)->ArgsProduct({ {0, 1}, {1000, 20000} });
+}
@@ -8,6 +8,7 @@
 
 #include "benchmarksetup.h"
 #include "ramses/client/logic/LuaScript.h"
+#include "ramses/client/logic/LuaInterface.h"
 #include "impl/logic/LogicEngineImpl.h"
 #include "ramses/client/logic/Property.h"
 
@@ -109,5 +110,54 @@ namespace ramses
     // Same as BM_Links_CreateDestroyLink, but tests with many scripts (how fast is link (re)creation depending on scripts count)
     // ARG: script count
     BENCHMARK(BM_Links_CreateDestroyLink_ManyScripts)->Arg(8)->Arg(32)->Arg(128);
+
+    static void BM_Links_PropagateArrayOutputs(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto arraySize = static_cast<std::size_t>(state.range(0));
+        const auto changedElementCount = static_cast<std::size_t>(state.range(1));
+
+        // values are set from C++ on interface so that measurement is not dominated by Lua execution of source node
+        const std::string srcInterfaceSrc = fmt::format(R"(
+            function interface(INOUT)
+                INOUT.data = Type:Array({}, Type:Vec4f())
+            end
+        )", arraySize);
+        const std::string destScriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                IN.data = Type:Array({}, Type:Vec4f())
+            end
+            function run(IN,OUT)
+            end
+        )", arraySize);
+
+        LuaInterface* srcInterface = logicEngine.createLuaInterface(srcInterfaceSrc, "src");
+        LuaScript* destScript = logicEngine.createLuaScript(destScriptSrc);
+        Property* srcData = srcInterface->getOutputs()->getChild("data");
+        Property* destData = destScript->getInputs()->getChild("data");
+        for (std::size_t i = 0; i < arraySize; ++i)
+            logicEngine.link(*srcData->getChild(i), *destData->getChild(i));
+        logicEngine.update();
+
+        float frameCounter = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            ++frameCounter;
+            for (std::size_t i = 0; i < changedElementCount; ++i)
+                srcData->getChild(i)->set<vec4f>(vec4f{ frameCounter, 0.f, 0.f, 1.f });
+            logicEngine.update();
+        }
+
+        state.counters["links"] = static_cast<double>(arraySize);
+        state.counters["changed"] = static_cast<double>(changedElementCount);
+    }
+
+    // Measures value propagation over links of array output with many elements of which only some change
+    // in each update (e.g. skinning matrices or morph weights)
+    // ARG 0: array size (every element is linked)
+    // ARG 1: number of array elements changed before each update
+    BENCHMARK(BM_Links_PropagateArrayOutputs)->Args({ 64, 1 })->Args({ 64, 64 })->Args({ 1024, 1 })->Args({ 1024, 64 })->Args({ 1024, 1024 });
 }
 
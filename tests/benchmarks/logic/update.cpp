@@ -9,6 +9,10 @@
 #include "benchmarksetup.h"
 #include "ramses/client/logic/LuaScript.h"
 #include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/AnimationNode.h"
+#include "ramses/client/logic/AnimationNodeConfig.h"
+#include "ramses/client/logic/DataArray.h"
+#include "ramses/client/logic/NodeBinding.h"
 
 #include "impl/logic/LogicEngineImpl.h"
 #include "fmt/format.h"
@@ -200,6 +204,72 @@ namespace ramses
     }
 
     BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)->Arg(0)->Arg(49)->Arg(99)->Unit(benchmark::kMillisecond);
-}
 
+    static void BM_Update_IndependentAnimationNodes(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto workerCount = static_cast<uint32_t>(state.range(0));
+        const int64_t animationCount = state.range(1);
+
+        if (!logicEngine.enableParallelUpdate(workerCount))
+        {
+            state.SkipWithError("failed to enable parallel update");
+            return;
+        }
+
+        const std::string scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.progress = Type:Float()
+                OUT.progress = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.progress = IN.progress
+            end
+        )";
+        auto* progressScript = logicEngine.createLuaScript(scriptSrc);
+        auto* progressProp = progressScript->getInputs()->getChild("progress");
 
+        std::vector<float> timestamps(100u);
+        std::vector<vec3f> keyframes(100u);
+        for (size_t i = 0u; i < timestamps.size(); ++i)
+        {
+            timestamps[i] = static_cast<float>(i);
+            keyframes[i] = vec3f{ static_cast<float>(i), 0.f, -static_cast<float>(i) };
+        }
+        const auto* animTimestamps = logicEngine.createDataArray(timestamps);
+        const auto* animKeyframes = logicEngine.createDataArray(keyframes);
+
+        AnimationNodeConfig config;
+        for (size_t i = 0u; i < 10u; ++i)
+            config.addChannel({ fmt::format("channel{}", i), animTimestamps, animKeyframes, EInterpolationType::Cubic, animKeyframes, animKeyframes });
+
+        for (int64_t i = 0; i < animationCount; ++i)
+        {
+            auto* animation = logicEngine.createAnimationNode(config);
+            logicEngine.link(*progressScript->getOutputs()->getChild("progress"), *animation->getInputs()->getChild("progress"));
+
+            // every 10th animation drives a ramses node, bindings are updated on calling thread
+            if (i % 10 == 0)
+            {
+                auto* nodeBinding = logicEngine.createNodeBinding(*setup.m_scene.createNode());
+                logicEngine.link(*animation->getOutputs()->getChild("channel0"), *nodeBinding->getInputs()->getChild("translation"));
+            }
+        }
+
+        float progress = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            progress = (progress < 1.f ? progress + 0.01f : 0.f);
+            progressProp->set(progress);
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update() of many animation nodes which do not depend on each other, serially and with parallel update enabled
+    // ARG 0: parallel update worker count (0 = serial update)
+    // ARG 1: animation node count
+    BENCHMARK(BM_Update_IndependentAnimationNodes)->ArgsProduct({ {0, 1, 2, 4}, {10, 100, 1000} })->Unit(benchmark::kMicrosecond);
+}
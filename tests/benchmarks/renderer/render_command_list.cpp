@@ -0,0 +1,210 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/RendererLib/RenderExecutor.h"
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/RenderCommandRecorder.h"
+#include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/RendererScenes.h"
+#include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/RenderingContext.h"
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
+#include "internal/SceneGraph/SceneAPI/Camera.h"
+#include "ResourceDeviceHandleAccessorMock.h"
+#include "MockResourceHash.h"
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class RenderCommandListBenchmarkScenes
+    {
+    public:
+        // creates scenes with single render pass, every renderable has own transform, uniforms and render state
+        RenderCommandListBenchmarkScenes(uint32_t sceneCount, uint32_t renderableCount)
+            : m_rendererScenes(m_eventCollector)
+        {
+            ON_CALL(m_resourceAccessor, getResourceDeviceHandle(_)).WillByDefault(Return(DeviceResourceHandle(1u)));
+            ON_CALL(m_resourceAccessor, getVertexArrayDeviceHandle(_, _)).WillByDefault(Return(DeviceResourceHandle(2u)));
+
+            for (uint32_t i = 0u; i < sceneCount; ++i)
+            {
+                const SceneId sceneId{ i + 1u };
+                auto& scene = m_rendererScenes.createScene(SceneInfo{ sceneId });
+                createContent(scene, renderableCount);
+                m_sceneIds.push_back(sceneId);
+            }
+        }
+
+        [[nodiscard]] const RendererCachedScene& getScene(SceneId sceneId) const
+        {
+            return m_rendererScenes.getScene(sceneId);
+        }
+
+        [[nodiscard]] const SceneIdVector& getSceneIds() const
+        {
+            return m_sceneIds;
+        }
+
+    private:
+        void createContent(RendererCachedScene& scene, uint32_t renderableCount)
+        {
+            const RenderPassHandle pass = scene.allocateRenderPass(0u, {});
+            scene.setRenderPassCamera(pass, createCamera(scene));
+            const RenderGroupHandle group = scene.allocateRenderGroup(renderableCount, 0u, {});
+            scene.addRenderGroupToRenderPass(pass, group, 0);
+
+            const DataLayoutHandle uniformLayout = scene.allocateDataLayout({
+                DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ModelViewProjectionMatrix },
+                DataFieldInfo{ EDataType::Vector4F } }, MockResourceHash::EffectHash, {});
+            const DataLayoutHandle geometryLayout = scene.allocateDataLayout({
+                DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices },
+                DataFieldInfo{ EDataType::Vector3Buffer } }, MockResourceHash::EffectHash, {});
+            const DataInstanceHandle geometry = scene.allocateDataInstance(geometryLayout, {});
+            scene.setDataResource(geometry, DataFieldHandle{ 0u }, MockResourceHash::IndexArrayHash, {}, 0u, 0u, 0u);
+            scene.setDataResource(geometry, DataFieldHandle{ 1u }, MockResourceHash::VertArrayHash, {}, 0u, 0u, 0u);
+
+            RenderableVector renderables;
+            for (uint32_t i = 0u; i < renderableCount; ++i)
+            {
+                const NodeHandle node = scene.allocateNode(0u, {});
+                const TransformHandle transform = scene.allocateTransform(node, {});
+                scene.setTranslation(transform, glm::vec3{ static_cast<float>(i % 10u), 0.f, -10.f });
+
+                const DataInstanceHandle uniforms = scene.allocateDataInstance(uniformLayout, {});
+                scene.setDataSingleVector4f(uniforms, DataFieldHandle{ 1u }, glm::vec4{ static_cast<float>(i) });
+
+                const RenderableHandle renderable = scene.allocateRenderable(node, {});
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+                scene.setRenderableIndexCount(renderable, 6u);
+                const RenderStateHandle renderState = scene.allocateRenderState({});
+                scene.setRenderStateDepthFunc(renderState, (i % 2u == 0u) ? EDepthFunc::LessEqual : EDepthFunc::Always);
+                scene.setRenderableRenderState(renderable, renderState);
+                scene.addRenderableToRenderGroup(group, renderable, static_cast<int32_t>(i));
+                renderables.push_back(renderable);
+            }
+
+            scene.updateRenderablesAndResourceCache(m_resourceAccessor);
+            scene.updateRenderableVertexArrays(m_resourceAccessor, renderables);
+            scene.markVertexArraysClean();
+            scene.updateRenderableWorldMatrices();
+            scene.updateRenderableVisibility();
+        }
+
+        static CameraHandle createCamera(RendererCachedScene& scene)
+        {
+            const NodeHandle cameraNode = scene.allocateNode(0u, {});
+            scene.allocateTransform(cameraNode, {});
+            const auto dataLayout = scene.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {}, {});
+            const auto dataInstance = scene.allocateDataInstance(dataLayout, {});
+            const auto vpDataRefLayout = scene.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {}, {});
+            const auto vpOffsetInstance = scene.allocateDataInstance(vpDataRefLayout, {});
+            const auto vpSizeInstance = scene.allocateDataInstance(vpDataRefLayout, {});
+            const auto frustumPlanes = scene.allocateDataInstance(scene.allocateDataLayout({ DataFieldInfo{EDataType::Vector4F} }, {}, {}), {});
+            const auto frustumNearFar = scene.allocateDataInstance(scene.allocateDataLayout({ DataFieldInfo{EDataType::Vector2F} }, {}, {}), {});
+            scene.setDataReference(dataInstance, Camera::ViewportOffsetField, vpOffsetInstance);
+            scene.setDataReference(dataInstance, Camera::ViewportSizeField, vpSizeInstance);
+            scene.setDataReference(dataInstance, Camera::FrustumPlanesField, frustumPlanes);
+            scene.setDataReference(dataInstance, Camera::FrustumNearFarPlanesField, frustumNearFar);
+            scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { -1.f, 1.f, -1.f, 1.f });
+            scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { 0.1f, 100.f });
+            scene.setDataSingleVector2i(vpOffsetInstance, DataFieldHandle{ 0 }, { 0, 0 });
+            scene.setDataSingleVector2i(vpSizeInstance, DataFieldHandle{ 0 }, { 1280, 480 });
+
+            return scene.allocateCamera(ECameraProjectionType::Perspective, cameraNode, dataInstance, {});
+        }
+
+        NiceMock<ResourceDeviceHandleAccessorMock> m_resourceAccessor;
+        RendererEventCollector m_eventCollector;
+        RendererScenes m_rendererScenes;
+        SceneIdVector m_sceneIds;
+    };
+
+    static RenderingContext CreateRenderingContext()
+    {
+        return RenderingContext{ DeviceResourceHandle(1u), 1280u, 480u, {}, EClearFlag::None, glm::vec4{ 0.f }, false };
+    }
+
+    // There is no GPU available, device calls are consumed by a recorder writing into a scratch list in both cases.
+    // The difference therefore shows the cost of scene traversal (render state diffing, uniform resolving)
+    // compared to decoding a previously recorded list, which is what an unmodified scene costs on render thread.
+    // ARG 0: mode (0 = traverse scene and submit, 1 = replay recorded command list)
+    // ARG 1: renderable count
+    static void BM_RenderCommandList_RenderScene(benchmark::State& state)
+    {
+        const RenderCommandListBenchmarkScenes scenes{ 1u, static_cast<uint32_t>(state.range(1)) };
+        const RendererCachedScene& scene = scenes.getScene(scenes.getSceneIds().front());
+
+        RenderCommandList recordedList;
+        {
+            RenderCommandRecorder recorder{ recordedList };
+            RenderingContext context = CreateRenderingContext();
+            std::ignore = RenderExecutor{ recorder, context }.executeScene(scene);
+        }
+
+        RenderCommandList sinkList;
+        RenderCommandRecorder sink{ sinkList };
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            sinkList.clear();
+            if (state.range(0) == 0)
+            {
+                RenderingContext context = CreateRenderingContext();
+                std::ignore = RenderExecutor{ sink, context }.executeScene(scene);
+            }
+            else
+            {
+                recordedList.replay(sink);
+            }
+            benchmark::DoNotOptimize(sinkList.getCommandCount());
+        }
+        state.counters["commands"] = static_cast<double>(recordedList.getCommandCount());
+        state.counters["bytes"] = static_cast<double>(recordedList.getDataSize());
+    }
+
+    // Recording of all scenes, either sequentially on calling thread or distributed to worker threads
+    // ARG 0: worker count (0 = record on calling thread)
+    // ARG 1: scene count
+    static void BM_RenderCommandList_RecordScenes(benchmark::State& state)
+    {
+        const RenderCommandListBenchmarkScenes scenes{ static_cast<uint32_t>(state.range(1)), 1000u };
+        std::unique_ptr<SceneUpdateThreadPool> threadPool;
+        if (state.range(0) > 0)
+            threadPool = std::make_unique<SceneUpdateThreadPool>(static_cast<uint32_t>(state.range(0)));
+
+        std::unordered_map<SceneId, RenderCommandList> commandLists;
+        for (const auto sceneId : scenes.getSceneIds())
+            commandLists[sceneId];
+
+        const auto recordScene = [&](SceneId sceneId) {
+            auto& commandList = commandLists.find(sceneId)->second;
+            commandList.clear();
+            RenderCommandRecorder recorder{ commandList };
+            RenderingContext context = CreateRenderingContext();
+            std::ignore = RenderExecutor{ recorder, context }.executeScene(scenes.getScene(sceneId));
+        };
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            if (threadPool)
+                threadPool->execute(scenes.getSceneIds(), recordScene);
+            else
+                std::for_each(scenes.getSceneIds().cbegin(), scenes.getSceneIds().cend(), recordScene);
+            benchmark::DoNotOptimize(commandLists.begin()->second.getCommandCount());
+        }
+    }
+
+    BENCHMARK(BM_RenderCommandList_RenderScene)->ArgsProduct({ {0, 1}, {100, 1000, 10000} })->Unit(benchmark::kMicrosecond);
+    BENCHMARK(BM_RenderCommandList_RecordScenes)->ArgsProduct({ {0, 2, 4}, {1, 4, 8} })->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
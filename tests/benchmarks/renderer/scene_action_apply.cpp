@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/RendererLib/ParallelSceneActionApplier.h"
+#include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/RendererScenes.h"
+#include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/SceneGraph/Scene/SceneDescriber.h"
+#include <array>
+#include <memory>
+
+namespace ramses::internal
+{
+    // records initial flush of a scene with given number of renderables, every renderable has own transform,
+    // uniforms and render state, geometry is shared
+    static SceneActionCollection RecordInitialFlush(uint32_t renderableCount, SceneSizeInformation& sizeInfo)
+    {
+        Scene scene;
+        const RenderPassHandle pass = scene.allocateRenderPass(0u, {});
+        const RenderGroupHandle group = scene.allocateRenderGroup(renderableCount, 0u, {});
+        scene.addRenderGroupToRenderPass(pass, group, 0);
+
+        const DataLayoutHandle uniformLayout = scene.allocateDataLayout({
+            DataFieldInfo{ EDataType::Matrix44F },
+            DataFieldInfo{ EDataType::Vector4F },
+            DataFieldInfo{ EDataType::Float },
+            DataFieldInfo{ EDataType::Vector4F, 8u } }, ResourceContentHash::Invalid(), {});
+        const DataLayoutHandle geometryLayout = scene.allocateDataLayout({
+            DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices },
+            DataFieldInfo{ EDataType::Vector3Buffer } }, ResourceContentHash::Invalid(), {});
+        const DataInstanceHandle geometry = scene.allocateDataInstance(geometryLayout, {});
+
+        const glm::mat4 matrix{ 1.f };
+        const std::array<glm::vec4, 8u> vec4Array{};
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode(0u, {});
+            const TransformHandle transform = scene.allocateTransform(node, {});
+            scene.setTranslation(transform, glm::vec3{ static_cast<float>(i), 0.f, -10.f });
+
+            const DataInstanceHandle uniforms = scene.allocateDataInstance(uniformLayout, {});
+            scene.setDataMatrix44fArray(uniforms, DataFieldHandle{ 0u }, 1u, &matrix);
+            scene.setDataVector4fArray(uniforms, DataFieldHandle{ 1u }, 1u, &vec4Array.front());
+            const auto value = static_cast<float>(i);
+            scene.setDataFloatArray(uniforms, DataFieldHandle{ 2u }, 1u, &value);
+            scene.setDataVector4fArray(uniforms, DataFieldHandle{ 3u }, 8u, vec4Array.data());
+
+            const RenderableHandle renderable = scene.allocateRenderable(node, {});
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableRenderState(renderable, scene.allocateRenderState({}));
+            scene.addRenderableToRenderGroup(group, renderable, static_cast<int32_t>(i));
+        }
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        SceneDescriber::describeScene<IScene>(scene, creator);
+        sizeInfo = scene.getSceneSizeInformation();
+        return actions;
+    }
+
+    // Applies recorded initial flush to renderer scene, as done by renderer on display thread when scene is received
+    // ARG 0: worker count (0 = apply serially using SceneActionApplier)
+    // ARG 1: renderable count
+    static void BM_SceneActionApply_InitialFlush(benchmark::State& state)
+    {
+        SceneSizeInformation sizeInfo;
+        const SceneActionCollection actions = RecordInitialFlush(static_cast<uint32_t>(state.range(1)), sizeInfo);
+
+        std::unique_ptr<SceneUpdateThreadPool> threadPool;
+        std::unique_ptr<ParallelSceneActionApplier> parallelApplier;
+        if (state.range(0) > 0)
+        {
+            threadPool = std::make_unique<SceneUpdateThreadPool>(static_cast<uint32_t>(state.range(0)));
+            parallelApplier = std::make_unique<ParallelSceneActionApplier>(*threadPool);
+        }
+
+        RendererEventCollector eventCollector;
+        RendererScenes rendererScenes{ eventCollector };
+        const SceneId sceneId{ 1u };
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            state.PauseTiming();
+            auto& scene = rendererScenes.createScene(SceneInfo{ sceneId });
+            scene.preallocateSceneSize(sizeInfo);
+            state.ResumeTiming();
+
+            if (parallelApplier)
+                parallelApplier->applyActionsOnScene(scene, actions);
+            else
+                SceneActionApplier::ApplyActionsOnScene(scene, actions);
+            benchmark::DoNotOptimize(scene.getDataInstanceCount());
+
+            state.PauseTiming();
+            rendererScenes.destroyScene(sceneId);
+            state.ResumeTiming();
+        }
+        state.counters["actions"] = static_cast<double>(actions.numberOfActions());
+    }
+
+    BENCHMARK(BM_SceneActionApply_InitialFlush)->ArgsProduct({ {0, 2, 4}, {10000, 100000} })->Unit(benchmark::kMillisecond)->UseRealTime();
+}
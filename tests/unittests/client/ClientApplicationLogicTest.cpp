@@ -46,8 +46,8 @@ namespace ramses::internal
 
         void createDummyScene()
         {
-            EXPECT_CALL(scenegraphProviderComponent, handleCreateScene(Ref(dummyScene), false, Ref(logic)));
-            logic.createScene(dummyScene, false);
+            EXPECT_CALL(scenegraphProviderComponent, handleCreateScene(Ref(dummyScene), false, false, Ref(logic)));
+            logic.createScene(dummyScene, false, false);
         }
     };
 
@@ -140,6 +140,13 @@ namespace ramses::internal
         logic.removeResourceFile(handle);
     }
 
+    TEST_F(AClientApplicationLogic, forwardsPrefetchOfResourceFileToResourceComponent)
+    {
+        const SceneFileHandle handle{ 3u };
+        EXPECT_CALL(resourceComponent, prefetchResourceFile(handle)).WillOnce(Return(ManagedResourceVector{}));
+        EXPECT_TRUE(logic.prefetchResourceFile(handle).empty());
+    }
+
     TEST_F(AClientApplicationLogic, gathersSceneReferenceEventsInAContainer)
     {
         SceneReferenceEvent event(SceneId { 123 });
@@ -181,8 +188,8 @@ namespace ramses::internal
     {
     public:
         AClientApplicationLogicWithRealComponents()
-            : resComp(stats, fwlock)
-            , sceneComp(clientId, commSystem, connStatusUpdateNotifier, resComp, fwlock, ramses::EFeatureLevel_Latest)
+            : resComp(stats, fwlock, 1u)
+            , sceneComp(clientId, commSystem, connStatusUpdateNotifier, resComp, resComp.getResourceCompressionThreadPool(), fwlock, ramses::EFeatureLevel_Latest)
             , logic(clientId, fwlock)
         {
             logic.init(resComp, sceneComp);
@@ -207,7 +214,7 @@ namespace ramses::internal
     TEST_F(AClientApplicationLogicWithRealComponents, keepsResourcesAliveForNewSubscriberForShadowCopyScene)
     {
         ClientScene clientScene{ SceneInfo(sceneId) };
-        logic.createScene(clientScene, false);
+        logic.createScene(clientScene, false, false);
         logic.publishScene(sceneId, EScenePublicationMode::LocalAndRemote);
         auto res = new TextureResource(EResourceType::Texture2D, TextureMetaInfo(1u, 1u, 1u, EPixelStorageFormat::R8, false, {}, { 1u }), {});
         res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -235,7 +242,7 @@ namespace ramses::internal
     TEST_F(AClientApplicationLogicWithRealComponents, keepsAlsoOldResourcesAliveForNewSubscriberForShadowCopyScene)
     {
         ClientScene clientScene{ SceneInfo(sceneId) };
-        logic.createScene(clientScene, false);
+        logic.createScene(clientScene, false, false);
         logic.publishScene(sceneId, EScenePublicationMode::LocalAndRemote);
         auto res = new TextureResource(EResourceType::Texture2D, TextureMetaInfo(1u, 1u, 1u, EPixelStorageFormat::R8, false, {}, { 1u }), {});
         res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -359,6 +359,53 @@ namespace ramses::internal
         EXPECT_EQ(instanceCount, m_meshNode->getInstanceCount());
     }
 
+    TEST_F(MeshNodeTest, hasNoBoundingBoxByDefault)
+    {
+        vec3f minCorner;
+        vec3f maxCorner;
+        EXPECT_FALSE(m_meshNode->getBoundingBox(minCorner, maxCorner));
+    }
+
+    TEST_F(MeshNodeTest, setsAndGetsSameBoundingBox)
+    {
+        EXPECT_TRUE(m_meshNode->setBoundingBox({ -1.f, -2.f, -3.f }, { 1.f, 2.f, 3.f }));
+
+        vec3f minCorner;
+        vec3f maxCorner;
+        EXPECT_TRUE(m_meshNode->getBoundingBox(minCorner, maxCorner));
+        EXPECT_EQ(vec3f(-1.f, -2.f, -3.f), minCorner);
+        EXPECT_EQ(vec3f(1.f, 2.f, 3.f), maxCorner);
+        EXPECT_EQ(minCorner, m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).boundingBox.min);
+    }
+
+    TEST_F(MeshNodeTest, failsToSetInvalidBoundingBox)
+    {
+        EXPECT_FALSE(m_meshNode->setBoundingBox({ 1.f, -2.f, -3.f }, { -1.f, 2.f, 3.f }));
+
+        vec3f minCorner;
+        vec3f maxCorner;
+        EXPECT_FALSE(m_meshNode->getBoundingBox(minCorner, maxCorner));
+    }
+
+    TEST_F(MeshNodeTest, removesBoundingBox)
+    {
+        EXPECT_TRUE(m_meshNode->setBoundingBox({ -1.f, -2.f, -3.f }, { 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_meshNode->removeBoundingBox());
+
+        vec3f minCorner;
+        vec3f maxCorner;
+        EXPECT_FALSE(m_meshNode->getBoundingBox(minCorner, maxCorner));
+    }
+
+    TEST_F(MeshNodeTest, removingNotSetBoundingBoxSucceeds)
+    {
+        EXPECT_TRUE(m_meshNode->removeBoundingBox());
+
+        vec3f minCorner;
+        vec3f maxCorner;
+        EXPECT_FALSE(m_meshNode->getBoundingBox(minCorner, maxCorner));
+    }
+
     TEST_F(MeshNodeTest, succeedsValidationIfNotUsingIndexArray)
     {
         setAnAppearanceForTesting();
@@ -687,6 +687,19 @@ namespace ramses::internal
         EXPECT_FALSE(renderpass.isRenderOnce());
     }
 
+    TEST_F(ARenderPass, isNotStateSortedInitially)
+    {
+        EXPECT_FALSE(renderpass.isStateSortingEnabled());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableStateSorting)
+    {
+        EXPECT_TRUE(renderpass.setStateSortingEnabled(true));
+        EXPECT_TRUE(renderpass.isStateSortingEnabled());
+        EXPECT_TRUE(renderpass.setStateSortingEnabled(false));
+        EXPECT_FALSE(renderpass.isStateSortingEnabled());
+    }
+
     TEST_F(ARenderPass, canRetriggerRenderOnce)
     {
         EXPECT_TRUE(renderpass.setRenderOnce(true));
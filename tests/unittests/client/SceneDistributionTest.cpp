@@ -9,8 +9,11 @@
 #include "gtest/gtest.h"
 #include "ClientTestUtils.h"
 #include "ramses/client/Node.h"
+#include "ramses/client/SceneConfig.h"
 #include "internal/SceneGraph/SceneAPI/IScene.h"
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/TransformationCachedScene.h"
 
 
 namespace ramses::internal
@@ -148,6 +151,32 @@ namespace ramses::internal
         client.destroy(*otherScene);
     }
 
+    TEST_P(ADistributedScene, sendsTransformationUpdateModeFromSceneConfigToRenderer)
+    {
+        const ramses::internal::SceneId sceneId(33u);
+        SceneConfig config(sceneId_t(sceneId.getValue()), GetParam());
+        config.setBreadthFirstTransformationUpdateEnabled(true);
+        ramses::Scene* otherScene = client.createScene(config);
+        ASSERT_TRUE(otherScene != nullptr);
+        const ramses::internal::IScene& otherIScene = otherScene->impl().getIScene();
+        EXPECT_EQ(ETransformationUpdateMode::BreadthFirst, otherIScene.getTransformationUpdateMode());
+
+        ramses::internal::SceneInfo sceneInfo(sceneId, otherIScene.getName());
+        EXPECT_CALL(sceneActionsCollector, handleNewSceneAvailable(sceneInfo, _));
+        EXPECT_CALL(sceneActionsCollector, handleInitializeScene(sceneInfo, _));
+        EXPECT_TRUE(otherScene->publish(GetParam()));
+        EXPECT_CALL(sceneActionsCollector, handleSceneUpdate_rvr(sceneId, _, _));
+        EXPECT_TRUE(otherScene->flush());
+
+        // apply on renderer side scene type, which uses the mode for updating world matrices
+        TransformationCachedScene rendererScene;
+        SceneActionApplier::ApplyActionsOnScene(rendererScene, sceneActionsCollector.getCopyOfCollectedActions());
+        EXPECT_EQ(ETransformationUpdateMode::BreadthFirst, rendererScene.getTransformationUpdateMode());
+
+        EXPECT_CALL(sceneActionsCollector, handleSceneBecameUnavailable(sceneId, _));
+        client.destroy(*otherScene);
+    }
+
     TEST_P(ADistributedScene, confidence_emptyFlushDoesNotCollectAnySceneActions)
     {
         // First do immediate mode, no commits
@@ -172,6 +172,31 @@ namespace ramses::internal
         EXPECT_EQ(123u, scene->getSceneId().getValue());
     }
 
+    TEST_F(ASceneLoadedFromFile, failsToLoadSceneFromFileSmallerThanItsResources)
+    {
+        const std::array<uint16_t, 3> inds{ 0u, 1u, 2u };
+        m_scene.createArrayResource(3u, inds.data(), "indices");
+        EXPECT_TRUE(m_scene.saveToFile("someTemporaryFile.ram", {}));
+
+        {
+            // copy file without its last bytes, which belong to the resource
+            ramses::internal::File inFile("someTemporaryFile.ram");
+            size_t fileSize = 0;
+            EXPECT_TRUE(inFile.getSizeInBytes(fileSize));
+            std::vector<unsigned char> data(fileSize);
+            size_t numBytesRead = 0;
+            EXPECT_TRUE(inFile.open(ramses::internal::File::Mode::ReadOnlyBinary));
+            EXPECT_EQ(ramses::internal::EStatus::Ok, inFile.read(data.data(), fileSize, numBytesRead));
+
+            ramses::internal::File outFile("someTemporaryTruncatedFile.ram");
+            EXPECT_TRUE(outFile.open(ramses::internal::File::Mode::WriteOverWriteOldBinary));
+            EXPECT_TRUE(outFile.write(data.data(), data.size() - 2u));
+        }
+
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryTruncatedFile.ram", {}));
+        ramses::internal::File("someTemporaryTruncatedFile.ram").remove();
+    }
+
     TEST_F(ASceneLoadedFromFile, canReadSceneFromFileDescriptorCustomSceneId)
     {
         const char* filename = "someTemporaryFile.ram";
@@ -788,6 +813,7 @@ namespace ramses::internal
         EXPECT_TRUE(renderPass->setRenderOrder(renderOrder));
         EXPECT_TRUE(renderPass->setEnabled(false));
         EXPECT_TRUE(renderPass->setRenderOnce(true));
+        EXPECT_TRUE(renderPass->setStateSortingEnabled(true));
 
         doWriteReadCycle();
 
@@ -798,6 +824,7 @@ namespace ramses::internal
         EXPECT_EQ(renderOrder, loadedRenderPass->getRenderOrder());
         EXPECT_FALSE(loadedRenderPass->isEnabled());
         EXPECT_TRUE(loadedRenderPass->isRenderOnce());
+        EXPECT_TRUE(loadedRenderPass->isStateSortingEnabled());
     }
 
     TEST_F(ASceneLoadedFromFile, canReadWriteARenderPassWithACamera)
@@ -1585,6 +1612,48 @@ namespace ramses::internal
         EXPECT_GT(1600, size) << "scene file size exceeds allowed max size. verify that LL resource is saved only once before adapting this number";
     }
 
+    TEST_F(ASceneLoadedFromFile, prefetchesResourcesOfSceneFileWhenEnabled)
+    {
+        std::vector<uint16_t> inds(300);
+        std::iota(inds.begin(), inds.end(), static_cast<uint16_t>(0u));
+        const auto hash = this->m_scene.createArrayResource(300u, inds.data(), "indices")->impl().getLowlevelResourceHash();
+        EXPECT_TRUE(this->m_scene.saveToFile("someTemporaryFile.ram", {}));
+
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {});
+        ASSERT_TRUE(nullptr != m_sceneLoaded);
+        EXPECT_FALSE(m_clientForLoading.impl().getClientApplication().getResource(hash));
+        EXPECT_TRUE(m_clientForLoading.destroy(*m_sceneLoaded));
+
+        SceneConfig config;
+        config.setResourcePrefetchEnabled(true);
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", config);
+        ASSERT_TRUE(nullptr != m_sceneLoaded);
+        EXPECT_TRUE(m_clientForLoading.impl().getClientApplication().getResource(hash));
+        EXPECT_TRUE(m_sceneLoaded->flush());
+    }
+
+    TEST_F(ASceneLoadedFromFile, keepsTransformationUpdateModeOfSceneOrUsesModeFromSceneConfig)
+    {
+        EXPECT_TRUE(m_scene.saveToFile("someTemporaryFile.ram", {}));
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {});
+        ASSERT_TRUE(nullptr != m_sceneLoaded);
+        EXPECT_EQ(ramses::internal::ETransformationUpdateMode::Lazy, m_sceneLoaded->impl().getIScene().getTransformationUpdateMode());
+        EXPECT_TRUE(m_clientForLoading.destroy(*m_sceneLoaded));
+
+        SceneConfig config;
+        config.setBreadthFirstTransformationUpdateEnabled(true);
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", config);
+        ASSERT_TRUE(nullptr != m_sceneLoaded);
+        EXPECT_EQ(ramses::internal::ETransformationUpdateMode::BreadthFirst, m_sceneLoaded->impl().getIScene().getTransformationUpdateMode());
+        EXPECT_TRUE(m_clientForLoading.destroy(*m_sceneLoaded));
+
+        m_scene.impl().getIScene().setTransformationUpdateMode(ramses::internal::ETransformationUpdateMode::BreadthFirst);
+        EXPECT_TRUE(m_scene.saveToFile("someTemporaryFile.ram", {}));
+        m_sceneLoaded = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {});
+        ASSERT_TRUE(nullptr != m_sceneLoaded);
+        EXPECT_EQ(ramses::internal::ETransformationUpdateMode::BreadthFirst, m_sceneLoaded->impl().getIScene().getTransformationUpdateMode());
+    }
+
     template <typename T>
     struct TestHelper
     {
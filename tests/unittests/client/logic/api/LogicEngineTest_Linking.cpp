@@ -684,6 +684,59 @@ namespace ramses::internal
         EXPECT_EQ(100, *targetInput->get<int32_t>());
     }
 
+    TEST_F(ALogicEngine_Linking, PropagatesOnlyChangedOutputs_ButAllOutputsAfterLinkWasCreated)
+    {
+        const auto  luaScriptSource1 = R"(
+            function interface(IN,OUT)
+                IN.input = Type:Int32()
+                OUT.changing = Type:Int32()
+                OUT.constant = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.changing = IN.input
+                OUT.constant = 5
+            end
+        )";
+
+        const auto  luaScriptSource2 = R"(
+            function interface(IN,OUT)
+                IN.changing = Type:Int32()
+                IN.constant = Type:Int32()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        auto sourceScript = m_logicEngine->createLuaScript(luaScriptSource1);
+        auto targetScript = m_logicEngine->createLuaScript(luaScriptSource2);
+
+        auto sourceChanging = sourceScript->getOutputs()->getChild("changing");
+        auto sourceConstant = sourceScript->getOutputs()->getChild("constant");
+        auto targetChanging = targetScript->getInputs()->getChild("changing");
+        auto targetConstant = targetScript->getInputs()->getChild("constant");
+
+        EXPECT_TRUE(m_logicEngine->link(*sourceChanging, *targetChanging));
+        EXPECT_TRUE(m_logicEngine->link(*sourceConstant, *targetConstant));
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(0, *targetChanging->get<int32_t>());
+        EXPECT_EQ(5, *targetConstant->get<int32_t>());
+
+        sourceScript->getInputs()->getChild("input")->set<int32_t>(1);
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(1, *targetChanging->get<int32_t>());
+        EXPECT_EQ(5, *targetConstant->get<int32_t>());
+
+        // source output value does not change, but it has to be propagated to newly linked target
+        EXPECT_TRUE(m_logicEngine->unlink(*sourceConstant, *targetConstant));
+        targetConstant->set<int32_t>(7);
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(7, *targetConstant->get<int32_t>());
+        EXPECT_TRUE(m_logicEngine->link(*sourceConstant, *targetConstant));
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(1, *targetChanging->get<int32_t>());
+        EXPECT_EQ(5, *targetConstant->get<int32_t>());
+    }
+
     TEST_F(ALogicEngine_Linking, PropagatesOutputsToInputsIfLinkedForAppearanceBindings)
     {
         const auto  luaScriptSource = R"(
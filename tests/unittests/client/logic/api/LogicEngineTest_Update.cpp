@@ -15,6 +15,9 @@
 #include "ramses/client/logic/AppearanceBinding.h"
 #include "ramses/client/logic/NodeBinding.h"
 #include "ramses/client/logic/CameraBinding.h"
+#include "ramses/client/logic/AnimationNode.h"
+#include "ramses/client/logic/AnimationNodeConfig.h"
+#include "ramses/client/logic/DataArray.h"
 
 #include "ramses/client/logic/Property.h"
 
@@ -463,4 +466,397 @@ namespace ramses::internal
         EXPECT_EQ(sourceScript, executedNodes[0].first);
         EXPECT_EQ(targetScript, executedNodes[1].first);
     }
+
+    class ALogicEngine_ParallelUpdate : public ALogicEngine
+    {
+    protected:
+        struct AnimationNetwork
+        {
+            Property* progress = nullptr;
+            Property* offset = nullptr;
+            std::vector<const Property*> results;
+        };
+
+        // script providing progress -> independent animations -> scripts and node binding consuming animation values
+        AnimationNetwork createAnimationNetwork(LogicEngine& logicEngine, ramses::Node& node)
+        {
+            const auto progressScriptSrc = R"(
+                function interface(IN,OUT)
+                    IN.progress = Type:Float()
+                    OUT.progress = Type:Float()
+                end
+                function run(IN,OUT)
+                    OUT.progress = IN.progress
+                end
+            )";
+            const auto consumerScriptSrc = R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Float()
+                    IN.offset = Type:Float()
+                    OUT.value = Type:Float()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value + IN.offset
+                end
+            )";
+
+            const auto timestamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f, 2.f });
+            const auto keyframes = logicEngine.createDataArray(std::vector<float>{ 0.f, 10.f, -3.f });
+            const auto translationKeyframes = logicEngine.createDataArray(std::vector<vec3f>{ { 0.f, 1.f, 2.f }, { 10.f, 11.f, 12.f }, { -3.f, -2.f, -1.f } });
+            AnimationNodeConfig config;
+            config.addChannel({ "channel", timestamps, keyframes, EInterpolationType::Linear });
+            config.addChannel({ "translation", timestamps, translationKeyframes, EInterpolationType::Cubic, translationKeyframes, translationKeyframes });
+
+            AnimationNetwork network;
+            AnimationNode* animation = nullptr;
+            const auto progressScript = logicEngine.createLuaScript(progressScriptSrc);
+            network.progress = progressScript->getInputs()->getChild("progress");
+
+            const auto offsetScript = logicEngine.createLuaScript(progressScriptSrc);
+            network.offset = offsetScript->getInputs()->getChild("progress");
+
+            for (size_t i = 0u; i < 20u; ++i)
+            {
+                animation = logicEngine.createAnimationNode(config);
+                EXPECT_TRUE(logicEngine.link(*progressScript->getOutputs()->getChild("progress"), *animation->getInputs()->getChild("progress")));
+
+                const auto consumerScript = logicEngine.createLuaScript(consumerScriptSrc);
+                EXPECT_TRUE(logicEngine.link(*animation->getOutputs()->getChild("channel"), *consumerScript->getInputs()->getChild("value")));
+                EXPECT_TRUE(logicEngine.link(*offsetScript->getOutputs()->getChild("progress"), *consumerScript->getInputs()->getChild("offset")));
+                network.results.push_back(consumerScript->getOutputs()->getChild("value"));
+                network.results.push_back(animation->getOutputs()->getChild("channel"));
+                network.results.push_back(animation->getOutputs()->getChild("translation"));
+            }
+
+            const auto nodeBinding = logicEngine.createNodeBinding(node);
+            EXPECT_TRUE(logicEngine.link(*animation->getOutputs()->getChild("translation"), *nodeBinding->getInputs()->getChild("translation")));
+
+            return network;
+        }
+    };
+
+    TEST_F(ALogicEngine_ParallelUpdate, FailsToEnableWithTooManyWorkers)
+    {
+        EXPECT_FALSE(m_logicEngine->enableParallelUpdate(LogicEngineImpl::MaxParallelUpdateWorkerCount + 1u));
+        EXPECT_THAT(getLastErrorMessage(), ::testing::HasSubstr("maximum supported worker count is 32"));
+        EXPECT_EQ(0u, m_logicEngine->impl().getParallelUpdateWorkerCount());
+
+        EXPECT_TRUE(m_logicEngine->enableParallelUpdate(4u));
+        EXPECT_EQ(4u, m_logicEngine->impl().getParallelUpdateWorkerCount());
+        EXPECT_TRUE(m_logicEngine->enableParallelUpdate(0u));
+        EXPECT_EQ(0u, m_logicEngine->impl().getParallelUpdateWorkerCount());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ProducesSameResultsAsSerialUpdate)
+    {
+        auto& serialEngine = *m_logicEngine;
+        auto& parallelEngine = *m_scene->createLogicEngine("parallel");
+        ASSERT_TRUE(parallelEngine.enableParallelUpdate(3u));
+
+        auto serialNode = m_scene->createNode();
+        auto parallelNode = m_scene->createNode();
+        const AnimationNetwork serialNetwork = createAnimationNetwork(serialEngine, *serialNode);
+        const AnimationNetwork parallelNetwork = createAnimationNetwork(parallelEngine, *parallelNode);
+        ASSERT_EQ(serialNetwork.results.size(), parallelNetwork.results.size());
+
+        for (const float progress : { 0.f, 0.3f, 0.3f, 0.75f, 1.f })
+        {
+            serialNetwork.progress->set(progress);
+            parallelNetwork.progress->set(progress);
+            serialNetwork.offset->set(progress * 2.f);
+            parallelNetwork.offset->set(progress * 2.f);
+            ASSERT_TRUE(serialEngine.update());
+            ASSERT_TRUE(parallelEngine.update());
+
+            for (size_t i = 0u; i < serialNetwork.results.size(); ++i)
+            {
+                if (serialNetwork.results[i]->getType() == EPropertyType::Float)
+                {
+                    EXPECT_EQ(*serialNetwork.results[i]->get<float>(), *parallelNetwork.results[i]->get<float>());
+                }
+                else
+                {
+                    EXPECT_EQ(*serialNetwork.results[i]->get<vec3f>(), *parallelNetwork.results[i]->get<vec3f>());
+                }
+            }
+
+            vec3f serialTranslation;
+            vec3f parallelTranslation;
+            EXPECT_TRUE(serialNode->getTranslation(serialTranslation));
+            EXPECT_TRUE(parallelNode->getTranslation(parallelTranslation));
+            EXPECT_EQ(serialTranslation, parallelTranslation);
+        }
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, PropagatesValuesThroughAllLevels)
+    {
+        ASSERT_TRUE(m_logicEngine->enableParallelUpdate(2u));
+        const AnimationNetwork network = createAnimationNetwork(*m_logicEngine, *m_node);
+
+        // progress 0.5 hits exactly the middle keyframe
+        network.progress->set(0.5f);
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_FLOAT_EQ(10.f, *network.results[0]->get<float>());
+
+        // only offset script and consumer scripts are dirty
+        network.offset->set(1.f);
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_FLOAT_EQ(11.f, *network.results[0]->get<float>());
+
+        vec3f translation;
+        EXPECT_TRUE(m_node->getTranslation(translation));
+        EXPECT_EQ(vec3f(10.f, 11.f, 12.f), translation);
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ProducesErrorOfFailingScript)
+    {
+        ASSERT_TRUE(m_logicEngine->enableParallelUpdate(2u));
+
+        auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.param = Type:Bool()
+                OUT.param = Type:Bool()
+            end
+            function run(IN,OUT)
+                error("This will die")
+            end
+        )";
+
+        auto sourceScript = m_logicEngine->createLuaScript(scriptSource, WithStdModules({EStandardModule::Base}));
+        auto targetScript = m_logicEngine->createLuaScript(scriptSource, WithStdModules({EStandardModule::Base}));
+        m_logicEngine->link(*sourceScript->getOutputs()->getChild("param"), *targetScript->getInputs()->getChild("param"));
+
+        EXPECT_FALSE(m_logicEngine->update());
+        expectErrorSubstring("This will die", sourceScript);
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ProducesSameResultsAsSerialUpdateWithWeakLinkLoop)
+    {
+        const auto scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                IN.feedback = Type:Int32()
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.value = IN.value * 2 + IN.feedback
+            end
+        )";
+
+        struct Network
+        {
+            std::vector<LuaScript*> scripts;
+        };
+        // chain head -> chain1 -> chain2 with weak link chain2 -> head closing a loop,
+        // independent scripts are weakly linked into the chain and may be sorted before or after their targets
+        const auto createNetwork = [&scriptSrc](LogicEngine& logicEngine) {
+            Network network;
+            for (size_t i = 0u; i < 6u; ++i)
+                network.scripts.push_back(logicEngine.createLuaScript(scriptSrc));
+            const auto output = [&network](size_t idx) { return network.scripts[idx]->getOutputs()->getChild("value"); };
+            const auto input = [&network](size_t idx, std::string_view name) { return network.scripts[idx]->getInputs()->getChild(name); };
+            EXPECT_TRUE(logicEngine.link(*output(0u), *input(1u, "value")));
+            EXPECT_TRUE(logicEngine.link(*output(1u), *input(2u, "value")));
+            EXPECT_TRUE(logicEngine.linkWeak(*output(2u), *input(0u, "feedback")));
+            EXPECT_TRUE(logicEngine.linkWeak(*output(3u), *input(1u, "feedback")));
+            EXPECT_TRUE(logicEngine.linkWeak(*output(4u), *input(2u, "feedback")));
+            EXPECT_TRUE(logicEngine.linkWeak(*output(5u), *input(3u, "feedback")));
+            return network;
+        };
+
+        auto& serialEngine = *m_logicEngine;
+        auto& parallelEngine = *m_scene->createLogicEngine("parallel");
+        ASSERT_TRUE(parallelEngine.enableParallelUpdate(3u));
+        const Network serialNetwork = createNetwork(serialEngine);
+        const Network parallelNetwork = createNetwork(parallelEngine);
+
+        for (int32_t updateIdx = 0; updateIdx < 5; ++updateIdx)
+        {
+            for (const auto* network : { &serialNetwork, &parallelNetwork })
+            {
+                network->scripts[0]->getInputs()->getChild("value")->set(updateIdx + 1);
+                for (size_t i = 3u; i < network->scripts.size(); ++i)
+                    network->scripts[i]->getInputs()->getChild("value")->set(updateIdx * 10 + static_cast<int32_t>(i));
+            }
+            ASSERT_TRUE(serialEngine.update());
+            ASSERT_TRUE(parallelEngine.update());
+
+            for (size_t i = 0u; i < serialNetwork.scripts.size(); ++i)
+            {
+                EXPECT_EQ(*serialNetwork.scripts[i]->getInputs()->getChild("feedback")->get<int32_t>(), *parallelNetwork.scripts[i]->getInputs()->getChild("feedback")->get<int32_t>());
+                EXPECT_EQ(*serialNetwork.scripts[i]->getOutputs()->getChild("value")->get<int32_t>(), *parallelNetwork.scripts[i]->getOutputs()->getChild("value")->get<int32_t>());
+            }
+        }
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, StopsAtFailingScriptWithSameResultsAsSerialUpdate)
+    {
+        const auto sourceScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                IN.fail = Type:Bool()
+                OUT.value = Type:Int32()
+                OUT.fail = Type:Bool()
+            end
+            function run(IN,OUT)
+                OUT.value = IN.value
+                OUT.fail = IN.fail
+            end
+        )";
+        const auto scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                IN.fail = Type:Bool()
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                if IN.fail then
+                    error("This will die")
+                end
+                OUT.value = IN.value + 1
+            end
+        )";
+
+        struct Network
+        {
+            LuaScript* source = nullptr;
+            LuaScript* failingScript = nullptr;
+            std::vector<LuaScript*> consumers;
+        };
+        // source -> scripts of one level, one of them fails on request -> consumer per script
+        const auto createNetwork = [&](LogicEngine& logicEngine) {
+            Network network;
+            network.source = logicEngine.createLuaScript(sourceScriptSrc, WithStdModules({ EStandardModule::Base }));
+            for (size_t i = 0u; i < 8u; ++i)
+            {
+                auto script = logicEngine.createLuaScript(scriptSrc, WithStdModules({ EStandardModule::Base }));
+                EXPECT_TRUE(logicEngine.link(*network.source->getOutputs()->getChild("value"), *script->getInputs()->getChild("value")));
+                if (i == 4u)
+                {
+                    EXPECT_TRUE(logicEngine.link(*network.source->getOutputs()->getChild("fail"), *script->getInputs()->getChild("fail")));
+                    network.failingScript = script;
+                }
+                auto consumer = logicEngine.createLuaScript(scriptSrc, WithStdModules({ EStandardModule::Base }));
+                EXPECT_TRUE(logicEngine.link(*script->getOutputs()->getChild("value"), *consumer->getInputs()->getChild("value")));
+                network.consumers.push_back(consumer);
+            }
+            return network;
+        };
+
+        auto& serialEngine = *m_logicEngine;
+        auto& parallelEngine = *m_scene->createLogicEngine("parallel");
+        ASSERT_TRUE(parallelEngine.enableParallelUpdate(3u));
+        const Network serialNetwork = createNetwork(serialEngine);
+        const Network parallelNetwork = createNetwork(parallelEngine);
+
+        const auto expectSameConsumerValues = [&]() {
+            for (size_t i = 0u; i < serialNetwork.consumers.size(); ++i)
+            {
+                EXPECT_EQ(*serialNetwork.consumers[i]->getInputs()->getChild("value")->get<int32_t>(), *parallelNetwork.consumers[i]->getInputs()->getChild("value")->get<int32_t>());
+                EXPECT_EQ(*serialNetwork.consumers[i]->getOutputs()->getChild("value")->get<int32_t>(), *parallelNetwork.consumers[i]->getOutputs()->getChild("value")->get<int32_t>());
+            }
+        };
+
+        for (const auto* network : { &serialNetwork, &parallelNetwork })
+            network->source->getInputs()->getChild("value")->set(1);
+        ASSERT_TRUE(serialEngine.update());
+        ASSERT_TRUE(parallelEngine.update());
+        expectSameConsumerValues();
+
+        // scripts sorted before failing one propagate new value, consumers are not updated
+        for (const auto* network : { &serialNetwork, &parallelNetwork })
+        {
+            network->source->getInputs()->getChild("value")->set(2);
+            network->source->getInputs()->getChild("fail")->set(true);
+        }
+        EXPECT_FALSE(serialEngine.update());
+        expectErrorSubstring("This will die", serialNetwork.failingScript);
+        EXPECT_FALSE(parallelEngine.update());
+        expectErrorSubstring("This will die", parallelNetwork.failingScript);
+        expectSameConsumerValues();
+
+        for (const auto* network : { &serialNetwork, &parallelNetwork })
+            network->source->getInputs()->getChild("fail")->set(false);
+        ASSERT_TRUE(serialEngine.update());
+        ASSERT_TRUE(parallelEngine.update());
+        expectSameConsumerValues();
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, DoesNotExecuteAnimationsSortedAfterFailingScriptSameAsSerialUpdate)
+    {
+        const auto sourceScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.progress = Type:Float()
+                OUT.progress = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.progress = IN.progress
+            end
+        )";
+        const auto failingScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.progress = Type:Float()
+                OUT.progress = Type:Float()
+            end
+            function run(IN,OUT)
+                if IN.progress > 0.5 then
+                    error("This will die")
+                end
+                OUT.progress = IN.progress
+            end
+        )";
+
+        struct Network
+        {
+            LuaScript* source = nullptr;
+            LuaScript* failingScript = nullptr;
+            std::vector<AnimationNode*> animations;
+        };
+        // source -> failing script and animations in same level, animations may be sorted before or after failing script
+        const auto createNetwork = [&](LogicEngine& logicEngine) {
+            Network network;
+            network.source = logicEngine.createLuaScript(sourceScriptSrc);
+            const auto timestamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+            const auto keyframes = logicEngine.createDataArray(std::vector<float>{ 0.f, 10.f });
+            AnimationNodeConfig config;
+            config.addChannel({ "channel", timestamps, keyframes, EInterpolationType::Linear });
+            for (size_t i = 0u; i < 8u; ++i)
+            {
+                if (i == 4u)
+                {
+                    network.failingScript = logicEngine.createLuaScript(failingScriptSrc, WithStdModules({ EStandardModule::Base }));
+                    EXPECT_TRUE(logicEngine.link(*network.source->getOutputs()->getChild("progress"), *network.failingScript->getInputs()->getChild("progress")));
+                }
+                auto animation = logicEngine.createAnimationNode(config);
+                EXPECT_TRUE(logicEngine.link(*network.source->getOutputs()->getChild("progress"), *animation->getInputs()->getChild("progress")));
+                network.animations.push_back(animation);
+            }
+            return network;
+        };
+
+        auto& serialEngine = *m_logicEngine;
+        auto& parallelEngine = *m_scene->createLogicEngine("parallel");
+        ASSERT_TRUE(parallelEngine.enableParallelUpdate(3u));
+        const Network serialNetwork = createNetwork(serialEngine);
+        const Network parallelNetwork = createNetwork(parallelEngine);
+
+        const auto expectSameAnimationValues = [&]() {
+            for (size_t i = 0u; i < serialNetwork.animations.size(); ++i)
+                EXPECT_EQ(*serialNetwork.animations[i]->getOutputs()->getChild("channel")->get<float>(), *parallelNetwork.animations[i]->getOutputs()->getChild("channel")->get<float>());
+        };
+
+        for (const auto* network : { &serialNetwork, &parallelNetwork })
+            network->source->getInputs()->getChild("progress")->set(0.25f);
+        ASSERT_TRUE(serialEngine.update());
+        ASSERT_TRUE(parallelEngine.update());
+        expectSameAnimationValues();
+
+        for (const auto* network : { &serialNetwork, &parallelNetwork })
+            network->source->getInputs()->getChild("progress")->set(0.75f);
+        EXPECT_FALSE(serialEngine.update());
+        expectErrorSubstring("This will die", serialNetwork.failingScript);
+        EXPECT_FALSE(parallelEngine.update());
+        expectErrorSubstring("This will die", parallelNetwork.failingScript);
+        expectSameAnimationValues();
+    }
 }
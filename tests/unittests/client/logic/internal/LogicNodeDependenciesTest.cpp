@@ -14,6 +14,8 @@
 #include "LogicNodeDummy.h"
 #include "RamsesTestUtils.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     class ALogicNodeDependencies : public ::testing::Test
@@ -497,4 +499,75 @@ namespace ramses::internal
         m_dependencies.addBindingDependency(m_binding2, m_binding1);
         expectSortedNodeOrder({ &m_binding2, &m_binding1 });
     }
+
+    TEST_F(ALogicNodeDependencies, PartitionsNodesIntoLevels)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(m_binding1);
+        m_dependencies.addNode(m_binding2);
+
+        PropertyImpl& output = m_nodeA.getOutputs()->getChild("output1")->impl();
+        PropertyImpl& input = m_nodeB.getInputs()->getChild("input1")->impl();
+        EXPECT_TRUE(m_dependencies.link(output, input, false, m_errorReporting));
+        m_dependencies.addBindingDependency(m_binding1, m_nodeA);
+
+        EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(
+            ::testing::UnorderedElementsAre(&m_binding1, &m_binding2),
+            ::testing::ElementsAre(&m_nodeA),
+            ::testing::ElementsAre(&m_nodeB)));
+
+        m_dependencies.removeNode(m_nodeA);
+        EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(
+            ::testing::UnorderedElementsAre(&m_binding1, &m_binding2),
+            ::testing::IsEmpty(),
+            ::testing::ElementsAre(&m_nodeB)));
+    }
+
+    TEST_F(ALogicNodeDependencies, PutsWeaklyLinkedNodesToLevelsInSortedOrder)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(::testing::UnorderedElementsAre(&m_nodeA, &m_nodeB)));
+
+        PropertyImpl& output = m_nodeA.getOutputs()->getChild("output1")->impl();
+        PropertyImpl& input = m_nodeB.getInputs()->getChild("input1")->impl();
+        EXPECT_TRUE(m_dependencies.link(output, input, true, m_errorReporting));
+
+        // weak link does not influence sorting, but source sorted before target provides value in same update
+        // and source sorted after target must not write to target inputs while target is updated
+        const NodeVector sortedNodes = *m_dependencies.getTopologicallySortedNodes();
+        ASSERT_EQ(2u, sortedNodes.size());
+        EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(::testing::ElementsAre(sortedNodes[0]), ::testing::ElementsAre(sortedNodes[1])));
+
+        EXPECT_TRUE(m_dependencies.unlink(output, input, m_errorReporting));
+        EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(::testing::UnorderedElementsAre(&m_nodeA, &m_nodeB)));
+    }
+
+    TEST_F(ALogicNodeDependencies, PutsWeakLinkSourceSortedAfterTargetToLaterLevelThanTarget)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(m_binding1);
+        m_dependencies.addBindingDependency(m_binding1, m_nodeA);
+        EXPECT_TRUE(m_dependencies.link(m_nodeB.getOutputs()->getChild("output1")->impl(), m_nodeA.getInputs()->getChild("input1")->impl(), true, m_errorReporting));
+
+        const NodeVector sortedNodes = *m_dependencies.getTopologicallySortedNodes();
+        const auto sortedA = std::find(sortedNodes.cbegin(), sortedNodes.cend(), &m_nodeA);
+        const auto sortedB = std::find(sortedNodes.cbegin(), sortedNodes.cend(), &m_nodeB);
+        if (sortedB > sortedA)
+        {
+            // B is independent, but it must not be updated before A, it would write A inputs before A reads them
+            EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(
+                ::testing::ElementsAre(&m_binding1),
+                ::testing::ElementsAre(&m_nodeA),
+                ::testing::ElementsAre(&m_nodeB)));
+        }
+        else
+        {
+            EXPECT_THAT(m_dependencies.getNodeLevels(), ::testing::ElementsAre(
+                ::testing::UnorderedElementsAre(&m_binding1, &m_nodeB),
+                ::testing::ElementsAre(&m_nodeA)));
+        }
+    }
 }
@@ -36,7 +36,7 @@ namespace ramses::internal
         MOCK_METHOD(bool, sendUnsubscribeScene, (const Guid& to, const SceneId& sceneId), (override));
 
         MOCK_METHOD(bool, sendInitializeScene, (const Guid& to, const SceneId& sceneId), (override));
-        MOCK_METHOD(bool, sendSceneUpdate, (const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer), (override));
+        MOCK_METHOD(bool, sendSceneUpdate, (const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer), (override));
 
         MOCK_METHOD(bool, sendRendererEvent, (const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data), (override));
 
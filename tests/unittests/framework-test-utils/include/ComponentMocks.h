@@ -40,6 +40,7 @@ namespace ramses::internal
         MOCK_METHOD(bool, hasResourceFile, (SceneFileHandle), (const, override));
         MOCK_METHOD(void, removeResourceFile, (SceneFileHandle), (override));
         MOCK_METHOD(void, loadResourceFromFile, (SceneFileHandle), (override));
+        MOCK_METHOD(ManagedResourceVector, prefetchResourceFile, (SceneFileHandle), (override));
         void reserveResourceCount(uint32_t /*totalCount*/) override {};
         MOCK_METHOD(ManagedResourceVector, resolveResources, (ResourceContentHashVector& vec), (override));
         MOCK_METHOD(ResourceInfo const&, getResourceInfo, (ResourceContentHash const& hash), (override));
@@ -52,7 +53,7 @@ namespace ramses::internal
         SceneGraphProviderComponentMock();
         ~SceneGraphProviderComponentMock() override;
 
-        MOCK_METHOD(void, handleCreateScene, (ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& consumer), (override));
+        MOCK_METHOD(void, handleCreateScene, (ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneSnapshotCaching, ISceneProviderEventConsumer& consumer), (override));
         MOCK_METHOD(void, handlePublishScene, (SceneId sceneId, EScenePublicationMode publicationMode), (override));
         MOCK_METHOD(void, handleUnpublishScene, (SceneId sceneId), (override));
         MOCK_METHOD(bool, handleFlush, (SceneId sceneId, const FlushTimeInformation&, SceneVersionTag), (override));
@@ -29,7 +29,9 @@ namespace ramses::internal
         MOCK_METHOD(bool, isCompressedAvailable, (), (const, override));
         MOCK_METHOD(bool, isDeCompressedAvailable, (), (const, override));
         MOCK_METHOD(void, compress, (CompressionLevel), (const, override));
+        MOCK_METHOD(void, compress, (CompressionLevel, WorkerThreadPool& threadPool), (const, override));
         MOCK_METHOD(void, decompress, (), (const, override));
+        MOCK_METHOD(void, decompress, (WorkerThreadPool& threadPool), (const, override));
         MOCK_METHOD(void, setResourceData, (ResourceBlob, const ResourceContentHash&), (override));
         MOCK_METHOD(void, setResourceData, (ResourceBlob), (override));
         MOCK_METHOD(void, setCompressedResourceData, (CompressedResourceBlob, CompressionLevel, uint32_t uncompressedSize, const ResourceContentHash&), (override));
@@ -38,7 +38,7 @@ namespace ramses::internal
         }
 
         std::unique_ptr<CommunicationSystemTestState> state{std::make_unique<CommunicationSystemTestState>(std::get<0>(GetParam()), std::get<1>(GetParam()))};
-        std::unique_ptr<ConnectionSystemTestDaemon> daemon{std::make_unique<ConnectionSystemTestDaemon>()};
+        std::unique_ptr<ConnectionSystemTestDaemon> daemon{std::make_unique<ConnectionSystemTestDaemon>([this](RamsesFrameworkConfigImpl& config) { state->configureConnectionSystem(config); })};
     };
 
 #define TESTING_SERVICETYPE_RAMSES(commsysProvider) \
@@ -25,6 +25,9 @@ namespace ramses::internal
         case ECommunicationSystemType::Tcp:
             *os << "ECommunicationSystemType::Tcp";
             return;
+        case ECommunicationSystemType::Local:
+            *os << "ECommunicationSystemType::Local";
+            return;
         };
         *os << static_cast<int>(type) << " (INVALID ECommunicationSystemType)";
     }
@@ -40,6 +43,19 @@ namespace ramses::internal
         event.signal();
     }
 
+    void CommunicationSystemTestState::configureConnectionSystem(RamsesFrameworkConfigImpl& config) const
+    {
+        switch (communicationSystemType)
+        {
+        case ECommunicationSystemType::Tcp:
+            config.setConnectionSystem(EConnectionSystem::TCP);
+            break;
+        case ECommunicationSystemType::Local:
+            config.setConnectionSystem(EConnectionSystem::Local);
+            break;
+        }
+    }
+
     CommunicationSystemTestState::~CommunicationSystemTestState()
     {
         assert(knownCommunicationSystems.empty());
@@ -99,6 +115,9 @@ namespace ramses::internal
         std::vector<ECommunicationSystemType> ret;
 #if defined(HAS_TCP_COMM)
         ret.push_back(ECommunicationSystemType::Tcp);
+#endif
+#if defined(HAS_TCP_COMM) && !defined(_WIN32)
+        ret.push_back(ECommunicationSystemType::Local);
 #endif
         return ret;
     }
@@ -108,6 +127,7 @@ namespace ramses::internal
         , state(state_)
     {
         RamsesFrameworkConfigImpl config(EFeatureLevel_Latest);
+        state.configureConnectionSystem(config);
 
         commSystem = CommunicationSystemFactory::ConstructCommunicationSystem(config, ParticipantIdentifier(id, name), frameworkLock, statisticCollection);
         state.knownCommunicationSystems.push_back(this);
@@ -23,6 +23,7 @@ namespace ramses::internal
     enum class ECommunicationSystemType
     {
         Tcp,
+        Local,
     };
 
     enum class EServiceType
@@ -46,6 +47,7 @@ namespace ramses::internal
         testing::AssertionResult blockOnAllConnected(uint32_t waitTimeMsOverride = 0);
 
         void sendEvent();
+        void configureConnectionSystem(RamsesFrameworkConfigImpl& config) const;
 
         static std::vector<ECommunicationSystemType> GetAvailableCommunicationSystemTypes();
         ECommunicationSystemType communicationSystemType;
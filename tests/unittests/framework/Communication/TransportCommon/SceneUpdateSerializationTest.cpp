@@ -15,6 +15,7 @@
 #include "ResourceMock.h"
 #include "ResourceSerializationTestHelper.h"
 #include "internal/Core/Utils/StatisticCollection.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
 #include "gmock/gmock.h"
 
 #include <algorithm>
@@ -156,6 +157,37 @@ namespace ramses::internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, decompressesLargeCompressedResourceWhilePacketsArrive)
+    {
+        update.resources.push_back(CreateTestResource(3u * LZ4CompressionUtils::BlockSize + 100u));
+        update.resources[0]->compress(IResource::CompressionLevel::Realtime);
+        ASSERT_TRUE(update.resources[0]->isCompressedAvailable());
+        EXPECT_TRUE(serialize(1000));
+        EXPECT_GT(data.size(), 1u);
+
+        auto result = deserialize();
+        compare(result);
+        ASSERT_EQ(1u, result.resources.size());
+        EXPECT_TRUE(result.resources[0]->isDeCompressedAvailable());
+        EXPECT_FALSE(result.resources[0]->isCompressedAvailable());
+    }
+
+    TEST_F(ASceneUpdateSerialization, keepsSmallCompressedResourceCompressed)
+    {
+        update.resources.push_back(CreateTestResource(100000));
+        update.resources[0]->compress(IResource::CompressionLevel::Realtime);
+        ASSERT_TRUE(update.resources[0]->isCompressedAvailable());
+        EXPECT_TRUE(serialize(100));
+        EXPECT_GT(data.size(), 1u);
+
+        auto result = deserialize();
+        ASSERT_EQ(SceneUpdateStreamDeserializer::ResultType::HasData, result.result);
+        ASSERT_EQ(1u, result.resources.size());
+        EXPECT_TRUE(result.resources[0]->isCompressedAvailable());
+        result.resources[0]->decompress();
+        compare(result);
+    }
+
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeFlushInformation)
     {
         addFlushInformation();
@@ -329,6 +361,47 @@ namespace ramses::internal
         }
     }
 
+    TEST_F(ASceneUpdateSerialization, deserializesBlocksContainedInSinglePacketWithoutBlockBuffer)
+    {
+        addTestActions();
+        addFlushInformation();
+        update.resources.push_back(CreateTestResource(100));
+        EXPECT_TRUE(serialize(1000));
+        EXPECT_EQ(1u, data.size());
+
+        expectDeserializeToSame();
+        EXPECT_EQ(0u, deser.getNumberOfBlockBufferAllocations());
+    }
+
+    TEST_F(ASceneUpdateSerialization, reusesBlockBufferForBlocksSpanningMultiplePackets)
+    {
+        update.resources.push_back(CreateTestResource(1000));
+        update.resources.push_back(CreateTestResource(10));
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(100));
+
+        expectDeserializeToSame();
+        const uint32_t allocationsForFirstUpdate = deser.getNumberOfBlockBufferAllocations();
+        EXPECT_GT(allocationsForFirstUpdate, 0u);
+
+        expectDeserializeToSame();
+        expectDeserializeToSame();
+        EXPECT_EQ(allocationsForFirstUpdate, deser.getNumberOfBlockBufferAllocations());
+    }
+
+    TEST_F(ASceneUpdateSerialization, releasesBlockBufferAfterVeryLargeBlock)
+    {
+        update.resources.push_back(CreateTestResource(static_cast<uint32_t>(SceneUpdateStreamDeserializer::MaxKeptBlockBufferSize)));
+        EXPECT_TRUE(serialize(100000));
+        EXPECT_GT(data.size(), 1u);
+
+        expectDeserializeToSame();
+        EXPECT_EQ(1u, deser.getNumberOfBlockBufferAllocations());
+        expectDeserializeToSame();
+        EXPECT_EQ(2u, deser.getNumberOfBlockBufferAllocations());
+    }
+
     TEST_F(ASceneUpdateSerialization, failsDeserializeEmptyPacket)
     {
         const auto res = deser.processData({});
@@ -0,0 +1,134 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Communication/TransportTCP/LocalSocketFile.h"
+#include "ScopedConsoleLogDisable.h"
+#include "gtest/gtest.h"
+
+#if !defined(_WIN32)
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ramses::internal
+{
+    class ALocalSocketFile : public ::testing::Test
+    {
+    public:
+        ~ALocalSocketFile() override
+        {
+            std::remove(socketPath.c_str());
+            std::remove(lockPath.c_str());
+            ::rmdir(directory.c_str());
+        }
+
+        static bool Exists(const std::string& path)
+        {
+            struct stat fileStat {};
+            return ::lstat(path.c_str(), &fileStat) == 0;
+        }
+
+        // bound and closed socket leaves file behind like participant which did not shut down properly
+        void createStaleSocketFile() const
+        {
+            const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            ASSERT_GE(fd, 0);
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) system call
+            EXPECT_EQ(0, ::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)));
+            ::close(fd);
+        }
+
+        const std::string directory = "/tmp/ramses-localsocketfile-test-" + std::to_string(::getpid());
+        const std::string socketPath = directory + "/test.sock";
+        const std::string lockPath = socketPath + ".lock";
+        ScopedConsoleLogDisable consoleDisabler;
+    };
+
+    TEST_F(ALocalSocketFile, createsDirectoryAccessibleOnlyByCurrentUser)
+    {
+        LocalSocketFile file(socketPath);
+        ASSERT_TRUE(file.acquire());
+
+        struct stat dirStat {};
+        ASSERT_EQ(0, ::lstat(directory.c_str(), &dirStat));
+        EXPECT_TRUE(S_ISDIR(dirStat.st_mode));
+        EXPECT_EQ(0u, dirStat.st_mode & static_cast<mode_t>(S_IRWXG | S_IRWXO));
+    }
+
+    TEST_F(ALocalSocketFile, cannotBeAcquiredTwiceUntilReleased)
+    {
+        LocalSocketFile file(socketPath);
+        LocalSocketFile otherFile(socketPath);
+        ASSERT_TRUE(file.acquire());
+        EXPECT_FALSE(otherFile.acquire());
+
+        file.release();
+        EXPECT_TRUE(otherFile.acquire());
+    }
+
+    TEST_F(ALocalSocketFile, doesNotRemoveSocketFileOfOtherOwner)
+    {
+        LocalSocketFile file(socketPath);
+        ASSERT_TRUE(file.acquire());
+        createStaleSocketFile();
+
+        LocalSocketFile otherFile(socketPath);
+        EXPECT_FALSE(otherFile.acquire());
+        EXPECT_TRUE(Exists(socketPath));
+    }
+
+    TEST_F(ALocalSocketFile, removesStaleSocketFileOnAcquireAndOwnSocketFileOnRelease)
+    {
+        ASSERT_TRUE(LocalSocketFile::CreatePrivateDirectory(directory));
+        createStaleSocketFile();
+        ASSERT_TRUE(Exists(socketPath));
+
+        LocalSocketFile file(socketPath);
+        ASSERT_TRUE(file.acquire());
+        EXPECT_FALSE(Exists(socketPath));
+
+        createStaleSocketFile();
+        file.release();
+        EXPECT_FALSE(Exists(socketPath));
+    }
+
+    TEST_F(ALocalSocketFile, doesNotRemoveFileWhichIsNoSocket)
+    {
+        ASSERT_TRUE(LocalSocketFile::CreatePrivateDirectory(directory));
+        std::ofstream(socketPath) << "data";
+
+        LocalSocketFile file(socketPath);
+        EXPECT_FALSE(file.acquire());
+        EXPECT_TRUE(Exists(socketPath));
+    }
+
+    TEST_F(ALocalSocketFile, refusesDirectoryWritableByOthers)
+    {
+        ASSERT_EQ(0, ::mkdir(directory.c_str(), S_IRWXU));
+        ASSERT_EQ(0, ::chmod(directory.c_str(), S_IRWXU | S_IRWXG | S_IRWXO));
+        EXPECT_FALSE(LocalSocketFile::CreatePrivateDirectory(directory));
+
+        LocalSocketFile file(socketPath);
+        EXPECT_FALSE(file.acquire());
+    }
+
+    TEST_F(ALocalSocketFile, refusesSymlinkInsteadOfDirectory)
+    {
+        ASSERT_EQ(0, ::symlink("/tmp", directory.c_str()));
+        EXPECT_FALSE(LocalSocketFile::CreatePrivateDirectory(directory));
+        std::remove(directory.c_str());
+    }
+}
+#endif
@@ -22,7 +22,7 @@ namespace ramses::internal
         ATCPConnectionSystem()
             : addr(Guid(111), "foo", "127.0.0.1", 0)
             , daemonAddr(TCPConnectionSystem::GetDaemonId(), "SM", "127.0.0.1", 5999)
-            , connsys(addr, 0, daemonAddr, false, lock, statistics, std::chrono::milliseconds{1000}, std::chrono::milliseconds{10000})
+            , connsys(addr, 0, daemonAddr, false, lock, statistics, std::chrono::milliseconds{1000}, std::chrono::milliseconds{10000}, 256u * 1024u)
             , startBarrier(5)
         {}
 
@@ -21,7 +21,7 @@ namespace ramses::internal
     public:
         explicit AbstractSenderAndReceiverTest(EServiceType serviceType)
             : m_state(std::make_unique<CommunicationSystemTestState>(GetParam(), serviceType))
-            , m_daemon(std::make_unique<ConnectionSystemTestDaemon>())
+            , m_daemon(std::make_unique<ConnectionSystemTestDaemon>([this](RamsesFrameworkConfigImpl& config) { m_state->configureConnectionSystem(config); }))
             , m_senderTestWrapper(std::make_unique<CommunicationSystemTestWrapper>(*m_state, "sender"))
             , m_receiverTestWrapper(std::make_unique<CommunicationSystemTestWrapper>(*m_state, "receiver"))
             , sender(*m_senderTestWrapper->commSystem)
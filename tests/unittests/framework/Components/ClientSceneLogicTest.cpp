@@ -959,6 +959,31 @@ TYPED_TEST(AClientSceneLogic_All, doesAppendFlushActionIfOtherSceneActionsAreFlu
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, coalescesRedundantSceneActionsBeforeSending)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    const NodeHandle node = this->m_scene.allocateNode(0u, {});
+    const TransformHandle transform = this->m_scene.allocateTransform(node, {});
+    this->m_scene.setTranslation(transform, glm::vec3(1.f));
+    this->m_scene.setTranslation(transform, glm::vec3(2.f));
+    this->m_scene.setTranslation(transform, glm::vec3(3.f));
+    const uint32_t initialValue = this->m_scene.getStatisticCollection().statSceneActionsCoalesced.getCounterValue();
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _, _)).WillOnce([&](const auto& /*unused*/, const auto& update, auto /*unused*/, auto /*unused*/, auto& /*unused*/)
+    {
+        ASSERT_EQ(3u, update.actions.numberOfActions());
+        EXPECT_EQ(ESceneActionId::AllocateNode, update.actions[0].type());
+        EXPECT_EQ(ESceneActionId::AllocateTransform, update.actions[1].type());
+        EXPECT_EQ(ESceneActionId::SetTranslation, update.actions[2].type());
+    });
+    this->m_sceneLogic.flushSceneActions({}, {});
+
+    EXPECT_EQ(initialValue + 2u, this->m_scene.getStatisticCollection().statSceneActionsCoalesced.getCounterValue());
+    EXPECT_EQ(glm::vec3(3.f), this->m_scene.getTranslation(transform));
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_ShadowCopy, appendsDefaultFlushInfoWhenSendingSceneToNewSubscriber)
 {
     // add some active subscriber so actions are queued
@@ -1601,6 +1626,37 @@ TEST_F(AClientSceneLogic_Direct, doesSendSceneAfterFlushToLateSubscribers)
     this->unpublish();
 }
 
+TEST_F(AClientSceneLogic_ShadowCopy, sendsCachedSceneSnapshotToLateSubscribersWhichResultsInSameScene)
+{
+    ClientSceneLogicShadowCopy sceneLogic(this->m_sceneGraphProviderComponent, this->m_scene, this->m_resourceComponent, this->m_myID, true);
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendPublishScene(this->m_sceneId, EScenePublicationMode::LocalAndRemote, _));
+    sceneLogic.publish(EScenePublicationMode::LocalAndRemote);
+
+    this->m_scene.allocateNode(0, NodeHandle(0u));
+    this->m_scene.allocateNode(0, NodeHandle(1u));
+    this->m_scene.allocateTransform(NodeHandle(0u), TransformHandle(0u));
+    sceneLogic.flushSceneActions({}, {});
+
+    this->m_scene.setTranslation(TransformHandle(0u), glm::vec3{ 1.f, 2.f, 3.f });
+    this->m_scene.releaseNode(NodeHandle(1u));
+    sceneLogic.flushSceneActions({}, {});
+
+    SceneActionCollection sentActions;
+    this->expectSceneSend();
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _, _))
+        .WillOnce([&](const auto&, const SceneUpdate& update, auto, auto, auto&) { sentActions = update.actions.copy(); });
+    sceneLogic.addSubscriber(this->m_rendererID);
+
+    Scene sceneFromSnapshot;
+    SceneActionApplier::ApplyActionsOnScene(sceneFromSnapshot, sentActions);
+    EXPECT_TRUE(sceneFromSnapshot.isNodeAllocated(NodeHandle(0u)));
+    EXPECT_FALSE(sceneFromSnapshot.isNodeAllocated(NodeHandle(1u)));
+    EXPECT_EQ(NodeHandle(0u), sceneFromSnapshot.getTransformNode(TransformHandle(0u)));
+    EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), sceneFromSnapshot.getTranslation(TransformHandle(0u)));
+
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_ShadowCopy, sceneActionsAreNotModifiedWhenLastRendererUnsubscribed)
 {
     this->publishAndAddSubscriberWithoutPendingActions();
@@ -10,6 +10,7 @@
 #include "internal/Components/FileInputStreamContainer.h"
 #include "internal/Components/MemoryInputStreamContainer.h"
 #include "internal/Components/OffsetFileInputStreamContainer.h"
+#include "internal/Components/MappedFileInputStreamContainer.h"
 #include "FileDescriptorHelper.h"
 #include "gtest/gtest.h"
 #include <memory>
@@ -82,4 +83,25 @@ namespace ramses::internal
         std::array<std::byte, 3> dataWsub = make_byte_array(4, 3, 2);
         EXPECT_EQ(dataWsub, dataR);
     }
+
+    TEST(AInputStreamContainer, canCreateAndUseWithMappedFileInputStream)
+    {
+        const std::array<std::byte, 5> dataW = make_byte_array(5, 4, 3, 2, 10);
+        {
+            File f("test.bin");
+            EXPECT_TRUE(f.open(File::Mode::WriteNewBinary));
+            EXPECT_TRUE(f.write(dataW.data(), dataW.size()));
+        }
+
+        MappedFileInputStreamContainer is("test.bin");
+        std::array<std::byte, 5> dataR = {std::byte{0}};
+        is.getStream().read(dataR.data(), dataR.size());
+        EXPECT_EQ(dataW, dataR);
+
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("test.bin");
+        MappedFileInputStreamContainer isOffset(fd, 1, 3);
+        std::array<std::byte, 3> dataRsub = {std::byte{0}};
+        isOffset.getStream().read(dataRsub.data(), dataRsub.size());
+        EXPECT_EQ(make_byte_array(4, 3, 2), dataRsub);
+    }
 }
@@ -20,6 +20,7 @@
 #include "internal/Components/FileInputStreamContainer.h"
 #include "InputStreamMock.h"
 #include "InputStreamContainerMock.h"
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -87,7 +88,7 @@ namespace ramses::internal
             ResourceTableOfContents resourceFileToc;
             InputStreamContainerSPtr inputStream(std::make_shared<FileInputStreamContainer>(resourceFileName));
             resourceFileToc.readTOCPosAndTOCFromStream(inputStream->getStream());
-            localResourceComponent.addResourceFile(inputStream, resourceFileToc);
+            lastResourceFileHandle = localResourceComponent.addResourceFile(inputStream, resourceFileToc);
 
             return hashes;
         }
@@ -135,13 +136,14 @@ namespace ramses::internal
         const std::string subDirName;
         const std::string equallyNamedResFileInSubDir;
         StatisticCollectionScene sceneStatistics;
+        SceneFileHandle lastResourceFileHandle;
     };
 
     class AResourceComponentTest : public ResourceComponentTestBase
     {
     public:
         AResourceComponentTest()
-            : localResourceComponent(statistics, frameworkLock)
+            : localResourceComponent(statistics, frameworkLock, 2u)
         {}
 
         ResourceComponent& getResourceComponent() override
@@ -177,7 +179,7 @@ namespace ramses::internal
     {
     public:
         AResourceComponentWithThreadedTaskExecutorTest()
-            : localResourceComponent(statistics, frameworkLock)
+            : localResourceComponent(statistics, frameworkLock, 2u)
         {}
 
         ResourceComponent& getResourceComponent() override
@@ -496,6 +498,64 @@ namespace ramses::internal
         EXPECT_TRUE(resolved[1]->getHash() == hashes[1]);
     }
 
+    TEST_F(AResourceComponentTest, resolvesResourcesFromFileInRequestedOrder)
+    {
+        ResourceContentHashVector hashes = writeMultipleTestResourceFile(10, 2000, true);
+        std::reverse(hashes.begin(), hashes.end());
+        const auto loadedResourcesBefore = statistics.statResourcesLoadedFromFileNumber.getCounterValue();
+
+        ManagedResourceVector resolved = localResourceComponent.resolveResources(hashes);
+
+        EXPECT_EQ(hashes, HashesFromManagedResources(resolved));
+        EXPECT_EQ(10u, statistics.statResourcesLoadedFromFileNumber.getCounterValue() - loadedResourcesBefore);
+    }
+
+    TEST_F(AResourceComponentTest, loadsResourceRequestedMultipleTimesOnlyOnce)
+    {
+        const ResourceContentHashVector fileHashes = writeMultipleTestResourceFile(3, 2000, true);
+        ResourceContentHashVector hashes{ fileHashes[1], fileHashes[0], fileHashes[1], fileHashes[2], fileHashes[1] };
+        const auto loadedResourcesBefore = statistics.statResourcesLoadedFromFileNumber.getCounterValue();
+
+        ManagedResourceVector resolved = localResourceComponent.resolveResources(hashes);
+
+        EXPECT_EQ(hashes, HashesFromManagedResources(resolved));
+        EXPECT_EQ(resolved[0].get(), resolved[2].get());
+        EXPECT_EQ(resolved[0].get(), resolved[4].get());
+        EXPECT_EQ(3u, statistics.statResourcesLoadedFromFileNumber.getCounterValue() - loadedResourcesBefore);
+    }
+
+    TEST_F(AResourceComponentTest, resolvesAvailableResourcesWithoutLoadingThemAgain)
+    {
+        ResourceContentHashVector hashes = writeMultipleTestResourceFile(4, 10);
+        ManagedResource available = localResourceComponent.loadResource(hashes[2]);
+        const auto loadedResourcesBefore = statistics.statResourcesLoadedFromFileNumber.getCounterValue();
+
+        ManagedResourceVector resolved = localResourceComponent.resolveResources(hashes);
+
+        EXPECT_EQ(hashes, HashesFromManagedResources(resolved));
+        EXPECT_EQ(available.get(), resolved[2].get());
+        EXPECT_EQ(3u, statistics.statResourcesLoadedFromFileNumber.getCounterValue() - loadedResourcesBefore);
+    }
+
+    TEST_F(AResourceComponentTest, prefetchesAllResourcesOfFileAndKeepsThemWhileHeld)
+    {
+        const ResourceContentHashVector hashes = writeMultipleTestResourceFile(5, 100, true);
+
+        ManagedResourceVector prefetched = localResourceComponent.prefetchResourceFile(lastResourceFileHandle);
+        ASSERT_EQ(5u, prefetched.size());
+        for (const auto& hash : hashes)
+            EXPECT_TRUE(localResourceComponent.getResource(hash));
+
+        prefetched.clear();
+        for (const auto& hash : hashes)
+            EXPECT_FALSE(localResourceComponent.getResource(hash));
+    }
+
+    TEST_F(AResourceComponentTest, prefetchesNothingForUnknownFile)
+    {
+        EXPECT_TRUE(localResourceComponent.prefetchResourceFile(SceneFileHandle{ 123u }).empty());
+    }
+
     TEST_F(AResourceComponentTest, returnsEmptyResourceVectorOnEmptyInput)
     {
         ResourceContentHashVector hashes;
@@ -0,0 +1,130 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Components/ResourceCompressionThreadPool.h"
+#include "internal/Components/ResourcePersistation.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AResourceCompressionThreadPool : public ::testing::Test
+    {
+    protected:
+        static ManagedResourceVector CreateResources(uint32_t count)
+        {
+            ManagedResourceVector resources;
+            std::vector<float> data(4096u);
+            for (uint32_t i = 0u; i < count; ++i)
+            {
+                for (size_t j = 0u; j < data.size(); ++j)
+                    data[j] = static_cast<float>((j % 64u) * i);
+                resources.push_back(ManagedResource{ new ArrayResource(EResourceType::VertexArray, static_cast<uint32_t>(data.size()), EDataType::Float, data.data(), {}) });
+            }
+            // small resource which is below compression threshold
+            resources.push_back(ManagedResource{ new ArrayResource(EResourceType::IndicesArray, 1u, EDataType::UInt16, data.data(), {}) });
+            return resources;
+        }
+
+        static void ExpectSameResult(const ManagedResourceVector& resources, const ManagedResourceVector& expectedResources)
+        {
+            ASSERT_EQ(expectedResources.size(), resources.size());
+            for (size_t i = 0u; i < resources.size(); ++i)
+            {
+                EXPECT_EQ(expectedResources[i]->getHash(), resources[i]->getHash());
+                EXPECT_EQ(expectedResources[i]->isCompressedAvailable(), resources[i]->isCompressedAvailable());
+                EXPECT_EQ(expectedResources[i]->getCompressedResourceData().span(), resources[i]->getCompressedResourceData().span());
+            }
+        }
+    };
+
+    TEST_F(AResourceCompressionThreadPool, compressesResourcesWithSameResultAsSerialCompression)
+    {
+        const auto expectedResources = CreateResources(20u);
+        for (const auto& res : expectedResources)
+            res->compress(IResource::CompressionLevel::Realtime);
+
+        const auto resources = CreateResources(20u);
+        ResourceCompressionThreadPool threadPool{ 3u };
+        threadPool.compress(resources, IResource::CompressionLevel::Realtime);
+
+        ExpectSameResult(resources, expectedResources);
+        EXPECT_TRUE(resources.front()->isCompressedAvailable());
+        EXPECT_FALSE(resources.back()->isCompressedAvailable());
+    }
+
+    TEST_F(AResourceCompressionThreadPool, compressesBlocksOfLargeResourceConcurrentlyWithSameResultAsSerialCompression)
+    {
+        const auto createLargeResources = []() {
+            ManagedResourceVector resources = CreateResources(2u);
+            // three LZ4 blocks
+            std::vector<float> data((2u * LZ4CompressionUtils::BlockSize + 1000u) / sizeof(float));
+            for (size_t j = 0u; j < data.size(); ++j)
+                data[j] = static_cast<float>(j % 1000u);
+            resources.push_back(ManagedResource{ new ArrayResource(EResourceType::VertexArray, static_cast<uint32_t>(data.size()), EDataType::Float, data.data(), {}) });
+            return resources;
+        };
+
+        const auto expectedResources = createLargeResources();
+        for (const auto& res : expectedResources)
+            res->compress(IResource::CompressionLevel::Realtime);
+
+        const auto resources = createLargeResources();
+        ResourceCompressionThreadPool threadPool{ 3u };
+        threadPool.compress(resources, IResource::CompressionLevel::Realtime);
+
+        ExpectSameResult(resources, expectedResources);
+        EXPECT_TRUE(LZ4CompressionUtils::isBlockFormat(resources.back()->getCompressedResourceData().span()));
+    }
+
+    TEST_F(AResourceCompressionThreadPool, compressesResourcesOnCallingThreadOnlyIfNoWorkers)
+    {
+        const auto expectedResources = CreateResources(5u);
+        for (const auto& res : expectedResources)
+            res->compress(IResource::CompressionLevel::Offline);
+
+        const auto resources = CreateResources(5u);
+        ResourceCompressionThreadPool threadPool{ 0u };
+        threadPool.compress(resources, IResource::CompressionLevel::Offline);
+
+        ExpectSameResult(resources, expectedResources);
+    }
+
+    TEST_F(AResourceCompressionThreadPool, calculatesHashesEvenIfNotCompressing)
+    {
+        const auto resources = CreateResources(5u);
+        ResourceCompressionThreadPool threadPool{ 2u };
+        threadPool.compress(resources, IResource::CompressionLevel::None);
+
+        for (const auto& res : resources)
+        {
+            EXPECT_TRUE(res->getHash().isValid());
+            EXPECT_FALSE(res->isCompressedAvailable());
+        }
+    }
+
+    TEST_F(AResourceCompressionThreadPool, handlesEmptyResourceList)
+    {
+        ResourceCompressionThreadPool threadPool{ 2u };
+        threadPool.compress({}, IResource::CompressionLevel::Realtime);
+    }
+
+    TEST_F(AResourceCompressionThreadPool, writesSameResourceFileAsSerialCompression)
+    {
+        BinaryOutputStream expectedStream;
+        ResourcePersistation::WriteNamedResourcesWithTOCToStream(expectedStream, CreateResources(10u), true);
+
+        BinaryOutputStream stream;
+        ResourceCompressionThreadPool threadPool{ 3u };
+        ResourcePersistation::WriteNamedResourcesWithTOCToStream(stream, CreateResources(10u), true, &threadPool);
+
+        EXPECT_EQ(expectedStream.release(), stream.release());
+    }
+}
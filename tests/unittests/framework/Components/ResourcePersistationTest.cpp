@@ -18,6 +18,7 @@
 #include "internal/Core/Utils/BinaryFileOutputStream.h"
 #include "internal/Core/Utils/BinaryFileInputStream.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
 #include "ResourceMock.h"
 #include "InputStreamMock.h"
 #include "UnsafeTestMemoryHelpers.h"
@@ -377,4 +378,94 @@ namespace ramses::internal
         });
         EXPECT_FALSE(ResourcePersistation::RetrieveResourceFromStream(stream, dummyResource.second));
     }
+
+    class AResourcePersistationRetrievingMultipleResources : public ::testing::Test
+    {
+    protected:
+        AResourcePersistationRetrievingMultipleResources()
+        {
+            ManagedResourceVector resources;
+            for (uint32_t i = 0u; i < 10u; ++i)
+            {
+                std::vector<float> data(100u + i, static_cast<float>(i));
+                resources.push_back(ManagedResource{ new ArrayResource(EResourceType::VertexArray, static_cast<uint32_t>(data.size()), EDataType::Float, data.data(), {}) });
+                hashes.push_back(resources.back()->getHash());
+            }
+            BinaryOutputStream outStream;
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(outStream, resources, true);
+            fileData = outStream.release();
+            fileStream = BinaryInputStream{ fileData.data() };
+            toc.readTOCPosAndTOCFromStream(fileStream);
+
+            EXPECT_CALL(stream, seek(_, _)).WillRepeatedly([&](int64_t offset, auto origin) {
+                return fileStream.seek(offset, origin);
+            });
+            EXPECT_CALL(stream, getState()).WillRepeatedly(Return(EStatus::Ok));
+            EXPECT_CALL(stream, getPos(_)).WillRepeatedly([&](size_t& pos) {
+                return fileStream.getPos(pos);
+            });
+        }
+
+        std::vector<ResourceFileEntry> getEntriesInReverseOrder() const
+        {
+            std::vector<ResourceFileEntry> entries;
+            for (auto it = hashes.rbegin(); it != hashes.rend(); ++it)
+                entries.push_back(toc.getEntryForHash(*it));
+            return entries;
+        }
+
+        std::vector<std::byte> fileData;
+        ResourceContentHashVector hashes;
+        ResourceTableOfContents toc;
+        BinaryInputStream fileStream{ nullptr };
+        StrictMock<InputStreamMock> stream;
+        ResourceCompressionThreadPool threadPool{ 2u };
+    };
+
+    TEST_F(AResourcePersistationRetrievingMultipleResources, readsNeighbouringResourcesWithSingleReadAndReturnsThemInFileOrder)
+    {
+        EXPECT_CALL(stream, read(_, _)).WillOnce([&](void* data, size_t size) -> IInputStream& {
+            fileStream.read(data, size);
+            return stream;
+        });
+
+        auto entries = getEntriesInReverseOrder();
+        const auto resources = ResourcePersistation::RetrieveResourcesFromStream(stream, entries, threadPool);
+
+        ASSERT_EQ(hashes.size(), resources.size());
+        for (size_t i = 0u; i < resources.size(); ++i)
+        {
+            EXPECT_EQ(hashes[i], entries[i].resourceInfo.hash);
+            ASSERT_TRUE(resources[i]);
+            EXPECT_EQ(hashes[i], resources[i]->getHash());
+            EXPECT_EQ((100u + i) * sizeof(float), resources[i]->getDecompressedDataSize());
+        }
+    }
+
+    TEST_F(AResourcePersistationRetrievingMultipleResources, returnsNoResourcesIfReadingFails)
+    {
+        EXPECT_CALL(stream, seek(_, _)).WillRepeatedly(Return(EStatus::Error));
+
+        auto entries = getEntriesInReverseOrder();
+        const auto resources = ResourcePersistation::RetrieveResourcesFromStream(stream, entries, threadPool);
+
+        ASSERT_EQ(hashes.size(), resources.size());
+        for (const auto& res : resources)
+            EXPECT_FALSE(res);
+    }
+
+    TEST_F(AResourcePersistationRetrievingMultipleResources, returnsNoResourcesForInvalidData)
+    {
+        EXPECT_CALL(stream, read(_, _)).WillRepeatedly([&](void* data, size_t size) -> IInputStream& {
+            std::memset(data, 0xff, size);
+            return stream;
+        });
+
+        auto entries = getEntriesInReverseOrder();
+        const auto resources = ResourcePersistation::RetrieveResourcesFromStream(stream, entries, threadPool);
+
+        ASSERT_EQ(hashes.size(), resources.size());
+        for (const auto& res : resources)
+            EXPECT_FALSE(res);
+    }
 }
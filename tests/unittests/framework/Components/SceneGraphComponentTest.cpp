@@ -30,7 +30,7 @@ public:
     ASceneGraphComponentBase()
         : localParticipantID(11)
         , remoteParticipantID(12)
-        , sceneGraphComponent(localParticipantID, communicationSystem, connectionStatusUpdateNotifier, resourceComponent, frameworkLock, ramses::EFeatureLevel_Latest)
+        , sceneGraphComponent(localParticipantID, communicationSystem, connectionStatusUpdateNotifier, resourceComponent, resourceCompressionThreadPool, frameworkLock, ramses::EFeatureLevel_Latest)
     {
         localSceneIdInfo = SceneInfo(localSceneId, "sceneName", EScenePublicationMode::LocalOnly);
         localSceneIdInfoVector.push_back(localSceneIdInfo);
@@ -56,7 +56,7 @@ public:
 
     void expectSendSceneActionsToNetwork(Guid remote, SceneId sceneId, const SceneActionCollection& expectedActions)
     {
-        EXPECT_CALL(communicationSystem, sendSceneUpdate(remote, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+        EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remote }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
             // grab actions directly out of serializer
             const auto actions = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().actions.copy();
             EXPECT_EQ(expectedActions, actions);
@@ -86,6 +86,7 @@ protected:
     StrictMock<CommunicationSystemMock> communicationSystem;
     NiceMock<MockConnectionStatusUpdateNotifier> connectionStatusUpdateNotifier;
     NiceMock<ResourceProviderComponentMock> resourceComponent;
+    ResourceCompressionThreadPool resourceCompressionThreadPool{ 0u };
     StrictMock<SceneRendererHandlerMock> consumer;
     StrictMock<SceneProviderEventConsumerMock> eventConsumer;
     StatisticCollectionScene sceneStatistics;
@@ -197,7 +198,7 @@ TEST_F(ASceneGraphComponent, locallySubscribedScenesGetUnsubscibedWhenLocalConsu
     SceneInfo sceneInfo(SceneInfo(sceneId, "foo"));
     ClientScene scene(sceneInfo);
 
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     EXPECT_CALL(consumer, handleNewSceneAvailable(sceneInfo, _));
     EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }, ramses::EFeatureLevel_Latest));
     sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode::LocalAndRemote);
@@ -354,7 +355,7 @@ TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
         std::make_shared<const ArrayResource>(EResourceType::VertexArray, 1024u, EDataType::Float, blob.data(), "fl")
     };
 
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
         // grab resources directly out of serializer
         const auto resources = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().resources;
         EXPECT_EQ(resourcesToSend, resources);
@@ -434,6 +435,24 @@ TEST_F(ASceneGraphComponent, canSendSceneActionsToLocalAndRemote)
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
 }
 
+TEST_F(ASceneGraphComponent, sendsSceneUpdateOnceToAllRemoteSubscribers)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+
+    const SceneId sceneId(456);
+    const Guid otherRemoteParticipantID(1234);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(2);
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, sceneId, EScenePublicationMode::LocalAndRemote);
+    sceneGraphComponent.sendCreateScene(otherRemoteParticipantID, sceneId, EScenePublicationMode::LocalAndRemote);
+
+    SceneActionCollection list(CreateFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID, otherRemoteParticipantID }, sceneId, _)).WillOnce(Return(true));
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(sceneId, _, localParticipantID));
+    SceneUpdate update;
+    update.actions = list.copy();
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID, otherRemoteParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
+}
+
 TEST_F(ASceneGraphComponent, canRepublishALocalOnlySceneToBeDistributedRemotely)
 {
     sceneGraphComponent.setSceneRendererHandler(&consumer);
@@ -523,7 +542,7 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
 
     // subscribe local and remote
     EXPECT_CALL(consumer, handleNewSceneAvailable(sceneInfo, _));
@@ -537,7 +556,7 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     sceneGraphComponent.handleSubscribeScene(SceneId(1), localParticipantID);
 
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _));
 
     EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _,  _));
@@ -560,12 +579,12 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
 
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _)).WillOnce(Return(1));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _)).WillOnce(Return(1));
     sceneGraphComponent.handleSubscribeScene(SceneId(1), remoteParticipantID);
 
     // flush again
     flushTimesWithExpirationToPreventFlushOptimizazion.expirationTimestamp += std::chrono::milliseconds{ 1 };
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _)).WillOnce(Return(1));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _)).WillOnce(Return(1));
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _, _));
     EXPECT_TRUE(sceneGraphComponent.handleFlush(SceneId(1), flushTimesWithExpirationToPreventFlushOptimizazion, {}));
 
@@ -586,10 +605,10 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
         event2.sceneid = SceneId{ 10000 };
         SceneInfo sceneInfo1(SceneInfo(SceneId{ 123 }, "foo"));
         ClientScene scene1(sceneInfo1);
-        sceneGraphComponent.handleCreateScene(scene1, false, eventConsumer);
+        sceneGraphComponent.handleCreateScene(scene1, false, false, eventConsumer);
         SceneInfo sceneInfo2(SceneInfo(SceneId{ 10000 }, "bar"));
         ClientScene scene2(sceneInfo2);
-        sceneGraphComponent.handleCreateScene(scene2, false, scene2Consumer);
+        sceneGraphComponent.handleCreateScene(scene2, false, false, scene2Consumer);
 
         InSequence seq;
         EXPECT_CALL(eventConsumer, handleResourceAvailabilityEvent(_, _)).Times(1);
@@ -648,7 +667,7 @@ TEST_F(ASceneGraphComponent, sendSceneReferenceEventForLocalParticipantCallsHand
     SceneReferenceEvent event(SceneId{ 123 });
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.type = SceneReferenceEventType::SceneFlushed;
     event.referencedScene = SceneId{ 456 };
     event.tag = SceneVersionTag{ 1000 };
@@ -667,7 +686,7 @@ TEST_F(ASceneGraphComponent, sendResourceAvailabilityEventForLocalParticipantCal
     SceneReferenceEvent event(SceneId { 123 });
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.type = SceneReferenceEventType::SceneFlushed;
     event.referencedScene = SceneId{ 456 };
     event.tag = SceneVersionTag{ 1000 };
@@ -698,7 +717,7 @@ TEST_F(ASceneGraphComponent, unpacksRendererEventToSceneReferenceEventAndForward
     SceneReferenceEvent event(SceneId{ 123 });
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.type = SceneReferenceEventType::SceneFlushed;
     event.referencedScene = SceneId{ 456 };
     event.tag = SceneVersionTag{ 1000 };
@@ -720,7 +739,7 @@ TEST_F(ASceneGraphComponent, unpacksRendererEventToResourceAvailabilityEventAndF
     event.sceneid = SceneId { 123 };
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.availableResources.emplace_back(1, 2);
     EXPECT_CALL(eventConsumer, handleResourceAvailabilityEvent(_, localParticipantID)).WillOnce([&event](ResourceAvailabilityEvent const& e, const Guid& /*unused*/)
     {
@@ -757,10 +776,10 @@ TEST_F(ASceneGraphComponent, forwardsEventsToCorrectHandler)
     SceneReferenceEvent event2(SceneId{ 10000 });
     SceneInfo sceneInfo1(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene1(sceneInfo1);
-    sceneGraphComponent.handleCreateScene(scene1, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene1, false, false, eventConsumer);
     SceneInfo sceneInfo2(SceneInfo(SceneId{ 10000 }, "bar"));
     ClientScene scene2(sceneInfo2);
-    sceneGraphComponent.handleCreateScene(scene2, false, scene2Consumer);
+    sceneGraphComponent.handleCreateScene(scene2, false, false, scene2Consumer);
 
     InSequence seq;
     EXPECT_CALL(eventConsumer, handleSceneReferenceEvent(_, _)).Times(1);
@@ -1223,7 +1242,7 @@ TEST_F(ASceneGraphComponent, returnsFalseForFlushOnWrongResolvedResourceNumber_S
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
 
     auto res = new TextureResource(EResourceType::Texture2D, TextureMetaInfo(1u, 1u, 1u, EPixelStorageFormat::R8, false, {}, { 1u }), {});
     res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -1249,7 +1268,7 @@ TEST_F(ASceneGraphComponent, returnsFalseForFlushOnWrongResolvedResourceNumber_D
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, true, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, true, false, eventConsumer);
 
     auto res = new TextureResource(EResourceType::Texture2D, TextureMetaInfo(1u, 1u, 1u, EPixelStorageFormat::R8, false, {}, { 1u }), {});
     res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -1273,7 +1292,7 @@ TEST_F(ASceneGraphComponent, sendSceneUpdatePassesSceneStatisticsToSerializer)
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
     sceneGraphComponent.sendCreateScene(remoteParticipantID, sceneId, EScenePublicationMode::LocalAndRemote);
 
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
         const auto& stats = static_cast<const SceneUpdateSerializer&>(serializer).getStatisticCollection();
         EXPECT_EQ(&sceneStatistics, &stats);
         return true;
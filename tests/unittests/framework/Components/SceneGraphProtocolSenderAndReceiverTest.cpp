@@ -173,8 +173,77 @@ namespace ramses::internal
         }
 
         FakseSceneUpdateSerializer serializer({blob_1, blob_2}, 300000);
-        EXPECT_TRUE(sender.sendSceneUpdate(receiverId, sceneId, serializer));
+        EXPECT_TRUE(sender.sendSceneUpdate({ receiverId }, sceneId, serializer));
         ASSERT_TRUE(waitForEvent(2));
     }
 
+    TEST_P(ASceneGraphProtocolSenderAndReceiverTest, keepsOrderOfSceneUpdateFollowingMultiPacketUpdateOfSameScene)
+    {
+        skipStatisticsTest();
+
+        // multi packet update is sent in bulk lane, following single packet update must not overtake it
+        const SceneId sceneId{432};
+        const std::vector<std::byte> blob_1 = make_byte_vector(1, 2, 3, 4, 5, 6);
+        const std::vector<std::byte> blob_2 = make_byte_vector(255, 254, 11, 3);
+        const std::vector<std::byte> blob_3 = make_byte_vector(42, 43);
+
+        {
+            PlatformGuard g(receiverExpectCallLock);
+            InSequence    seq;
+            for (const auto& blob : { blob_1, blob_2, blob_3 })
+            {
+                EXPECT_CALL(consumerHandler, handleSceneUpdate(sceneId, _, senderId)).WillOnce([&, blob](auto /*unused*/, const auto& data, auto /*unused*/) {
+                    EXPECT_EQ(blob, data);
+                    sendEvent();
+                });
+            }
+        }
+
+        FakseSceneUpdateSerializer multiPacketSerializer({blob_1, blob_2}, 300000);
+        FakseSceneUpdateSerializer singlePacketSerializer({blob_3}, 300000);
+        EXPECT_TRUE(sender.sendSceneUpdate({ receiverId }, sceneId, multiPacketSerializer));
+        EXPECT_TRUE(sender.sendSceneUpdate({ receiverId }, sceneId, singlePacketSerializer));
+        ASSERT_TRUE(waitForEvent(3));
+    }
+
+    TEST_P(ASceneGraphProtocolSenderAndReceiverTest, keepsOrderOfUnpublishAndRepublishFollowingMultiPacketUpdateOfSameScene)
+    {
+        skipStatisticsTest();
+
+        const SceneId sceneId{433};
+        SceneInfoVector scenes;
+        scenes.push_back(SceneInfo(sceneId, "sceneName"));
+
+        // receiver must be known for broadcasts before unpublish is sent
+        {
+            PlatformGuard g(receiverExpectCallLock);
+            EXPECT_CALL(consumerHandler, handleNewScenesAvailable(scenes, senderId, EFeatureLevel_Latest)).WillOnce(InvokeWithoutArgs([&]{ sendEvent(); }));
+        }
+        EXPECT_TRUE(sender.broadcastNewScenesAvailable(scenes, EFeatureLevel_Latest));
+        ASSERT_TRUE(waitForEvent());
+
+        // multi packet update is sent in bulk lane, unpublish and republish of scene must not overtake it
+        const std::vector<std::byte> blob_1 = make_byte_vector(1, 2, 3, 4, 5, 6);
+        const std::vector<std::byte> blob_2 = make_byte_vector(255, 254, 11, 3);
+        {
+            PlatformGuard g(receiverExpectCallLock);
+            InSequence    seq;
+            for (const auto& blob : { blob_1, blob_2 })
+            {
+                EXPECT_CALL(consumerHandler, handleSceneUpdate(sceneId, _, senderId)).WillOnce([&, blob](auto /*unused*/, const auto& data, auto /*unused*/) {
+                    EXPECT_EQ(blob, data);
+                    sendEvent();
+                });
+            }
+            EXPECT_CALL(consumerHandler, handleScenesBecameUnavailable(scenes, senderId)).WillOnce(InvokeWithoutArgs([&]{ sendEvent(); }));
+            EXPECT_CALL(consumerHandler, handleNewScenesAvailable(scenes, senderId, EFeatureLevel_Latest)).WillOnce(InvokeWithoutArgs([&]{ sendEvent(); }));
+        }
+
+        FakseSceneUpdateSerializer multiPacketSerializer({blob_1, blob_2}, 300000);
+        EXPECT_TRUE(sender.sendSceneUpdate({ receiverId }, sceneId, multiPacketSerializer));
+        EXPECT_TRUE(sender.broadcastScenesBecameUnavailable(scenes));
+        EXPECT_TRUE(sender.sendScenesAvailable(receiverId, scenes, EFeatureLevel_Latest));
+        ASSERT_TRUE(waitForEvent(4));
+    }
+
 }
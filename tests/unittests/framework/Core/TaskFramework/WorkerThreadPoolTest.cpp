@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace ramses::internal
+{
+    class AWorkerThreadPool : public ::testing::TestWithParam<uint32_t>
+    {
+    };
+
+    INSTANTIATE_TEST_SUITE_P(
+        AWorkerThreadPoolTests,
+        AWorkerThreadPool,
+        ::testing::Values(0u, 1u, 4u));
+
+    TEST_P(AWorkerThreadPool, executesEachIndexExactlyOnce)
+    {
+        WorkerThreadPool pool{ GetParam() };
+        EXPECT_EQ(GetParam(), pool.getWorkerCount());
+
+        for (const size_t taskCount : { 0u, 1u, 5u, 100u })
+        {
+            std::vector<std::atomic<uint32_t>> executions(taskCount);
+            pool.execute(taskCount, [&](size_t idx) { ++executions[idx]; });
+            for (const auto& count : executions)
+                EXPECT_EQ(1u, count);
+        }
+    }
+
+    TEST_P(AWorkerThreadPool, returnsOnlyAfterAllIndicesProcessed)
+    {
+        WorkerThreadPool pool{ GetParam() };
+
+        std::atomic<size_t> processed{ 0u };
+        for (int i = 0; i < 10; ++i)
+        {
+            processed = 0u;
+            pool.execute(6u, [&](size_t /*idx*/) {
+                std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+                ++processed;
+            });
+            EXPECT_EQ(6u, processed);
+        }
+    }
+
+    TEST_P(AWorkerThreadPool, executesCallingThreadFuncOnCallingThreadAndEachIndexExactlyOnce)
+    {
+        WorkerThreadPool pool{ GetParam() };
+
+        for (const size_t taskCount : { 0u, 1u, 5u, 100u })
+        {
+            std::vector<std::atomic<uint32_t>> executions(taskCount);
+            std::thread::id callingThreadFuncThread;
+            pool.execute(taskCount, [&](size_t idx) { ++executions[idx]; }, [&]() { callingThreadFuncThread = std::this_thread::get_id(); });
+
+            EXPECT_EQ(std::this_thread::get_id(), callingThreadFuncThread);
+            for (const auto& count : executions)
+                EXPECT_EQ(1u, count);
+        }
+    }
+
+    TEST(AWorkerThreadPoolWithoutWorkers, executesEverythingOnCallingThread)
+    {
+        WorkerThreadPool pool{ 0u };
+
+        std::vector<std::thread::id> threads(10u);
+        pool.execute(threads.size(), [&](size_t idx) { threads[idx] = std::this_thread::get_id(); });
+        for (const auto& threadId : threads)
+            EXPECT_EQ(std::this_thread::get_id(), threadId);
+    }
+}
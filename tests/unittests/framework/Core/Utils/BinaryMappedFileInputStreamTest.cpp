@@ -0,0 +1,178 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/BinaryMappedFileInputStream.h"
+#include "WindowsInvalidParameterCheckSuppression.h"
+#include "FileDescriptorHelper.h"
+#include "internal/Core/Utils/File.h"
+#include "gtest/gtest.h"
+#include <sys/stat.h>
+#include <fcntl.h>
+
+namespace ramses::internal
+{
+    class ABinaryMappedFileInputStream : public ::testing::Test
+    {
+    public:
+        void TearDown() override
+        {
+            if (fd != -1)
+                close(fd);
+            File(testFileName).remove();
+        }
+
+        void writeFile(std::initializer_list<uint8_t> data)
+        {
+            File f(testFileName);
+            ASSERT_TRUE(f.open(File::Mode::WriteNewBinary));
+            ASSERT_TRUE(f.write(data.begin(), data.size()));
+        }
+
+        void openFile(int flags = O_RDONLY)
+        {
+            assert(fd == -1);
+            fd = FileDescriptorHelper::OpenFileDescriptorBinary(testFileName, flags);
+            ASSERT_NE(-1, fd);
+        }
+
+        static std::vector<std::byte> readData(BinaryMappedFileInputStream& is, size_t size)
+        {
+            std::vector<std::byte> data(size);
+            is.read(data.data(), size);
+            return data;
+        }
+
+        WindowsInvalidParameterCheckSuppression suppress;
+        const char* testFileName = "testfile.bin";
+        int fd = -1;
+    };
+
+    TEST_F(ABinaryMappedFileInputStream, readsWholeFileByName)
+    {
+        writeFile({3, 2, 1});
+        BinaryMappedFileInputStream is(testFileName);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+        EXPECT_EQ(std::vector<std::byte>({std::byte{3}, std::byte{2}, std::byte{1}}), readData(is, 3));
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, failsForNonExistingFile)
+    {
+        BinaryMappedFileInputStream is("thisFileDoesNotExist.bin");
+        EXPECT_EQ(EStatus::Error, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, failsForEmptyFile)
+    {
+        File f(testFileName);
+        ASSERT_TRUE(f.createFile());
+        BinaryMappedFileInputStream is(testFileName);
+        EXPECT_EQ(EStatus::Error, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, readsInChunksWithOffset)
+    {
+        writeFile({0, 0, 3, 2, 1, 0, 0});
+        openFile();
+        BinaryMappedFileInputStream is(fd, 2, 3);
+        fd = -1;
+        EXPECT_EQ(std::vector<std::byte>({std::byte{3}}), readData(is, 1));
+        EXPECT_EQ(std::vector<std::byte>({std::byte{2}, std::byte{1}}), readData(is, 2));
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, readOutsideRangeFails)
+    {
+        writeFile({0, 0, 3, 2, 1, 0, 0});
+        openFile();
+        BinaryMappedFileInputStream is(fd, 2, 3);
+        fd = -1;
+        readData(is, 4);
+        EXPECT_EQ(EStatus::Eof, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, failsAndKeepsFileDescriptorOpenIfRangeExceedsFile)
+    {
+        writeFile({0, 3, 2, 1});
+        openFile();
+        BinaryMappedFileInputStream is(fd, 1, 4);
+        EXPECT_EQ(EStatus::Error, is.getState());
+        EXPECT_EQ(0, ::close(fd));
+        fd = -1;
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, failsForInvalidFileDescriptor)
+    {
+        BinaryMappedFileInputStream is(-1, 0, 3);
+        EXPECT_EQ(EStatus::Error, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, canSeekWithinRange)
+    {
+        writeFile({0, 1, 2, 3, 0});
+        openFile();
+        BinaryMappedFileInputStream is(fd, 1, 3);
+        fd = -1;
+
+        EXPECT_EQ(EStatus::Ok, is.seek(2, IInputStream::Seek::FromBeginning));
+        EXPECT_EQ(std::vector<std::byte>({std::byte{3}}), readData(is, 1));
+
+        EXPECT_EQ(EStatus::Ok, is.seek(-3, IInputStream::Seek::Relative));
+        EXPECT_EQ(std::vector<std::byte>({std::byte{1}}), readData(is, 1));
+
+        size_t pos = 0;
+        EXPECT_EQ(EStatus::Ok, is.getPos(pos));
+        EXPECT_EQ(1u, pos);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, seekOutsideRangeFails)
+    {
+        writeFile({0, 1, 2, 3, 0});
+        openFile();
+        BinaryMappedFileInputStream is(fd, 1, 3);
+        fd = -1;
+
+        EXPECT_EQ(EStatus::Error, is.seek(-1, IInputStream::Seek::Relative));
+        EXPECT_EQ(EStatus::Error, is.seek(4, IInputStream::Seek::FromBeginning));
+
+        size_t pos = 0;
+        EXPECT_EQ(EStatus::Ok, is.getPos(pos));
+        EXPECT_EQ(0u, pos);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, closesFileDescriptorWhenDestroyed)
+    {
+        writeFile({1, 2, 3});
+        openFile();
+        const int mappedFd = fd;
+        fd = -1;
+        {
+            BinaryMappedFileInputStream is(mappedFd, 0, 3);
+            EXPECT_EQ(EStatus::Ok, is.getState());
+            EXPECT_EQ(std::vector<std::byte>({std::byte{1}, std::byte{2}, std::byte{3}}), readData(is, 3));
+        }
+        EXPECT_EQ(-1, ::close(mappedFd));
+    }
+
+#if !defined(_WIN32)
+    // windows does not allow to truncate a mapped file
+    TEST_F(ABinaryMappedFileInputStream, seekFailsIfFileWasTruncatedAfterMapping)
+    {
+        writeFile({0, 1, 2, 3, 4});
+        BinaryMappedFileInputStream is(testFileName);
+        ASSERT_EQ(EStatus::Ok, is.getState());
+        EXPECT_EQ(EStatus::Ok, is.seek(1, IInputStream::Seek::FromBeginning));
+
+        writeFile({0, 1});
+        EXPECT_EQ(EStatus::Error, is.seek(3, IInputStream::Seek::FromBeginning));
+        EXPECT_EQ(EStatus::Error, is.getState());
+    }
+#endif
+}
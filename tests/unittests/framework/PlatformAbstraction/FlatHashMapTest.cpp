@@ -0,0 +1,303 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "ComplexTestType.h"
+#include "gtest/gtest.h"
+#include <unordered_map>
+#include <random>
+
+namespace ramses::internal
+{
+    using RCKey = ComplexTestType<struct KeyTag>;
+    using RCValue = ComplexTestType<struct ValueTag>;
+
+    class AFlatHashMap : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            RCKey::Reset();
+            RCValue::Reset();
+        }
+
+        static void ExpectRefCnt(int32_t refCnt)
+        {
+            EXPECT_EQ(refCnt, RCKey::RefCnt());
+            EXPECT_EQ(refCnt, RCValue::RefCnt());
+        }
+    };
+
+    TEST_F(AFlatHashMap, isEmptyAndDoesNotAllocateWhenDefaultConstructed)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(0u, map.capacity());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_EQ(nullptr, map.get(1u));
+        EXPECT_EQ(map.end(), map.find(1u));
+        EXPECT_FALSE(map.remove(1u));
+    }
+
+    TEST_F(AFlatHashMap, canPutAndGetValues)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+        EXPECT_EQ(2u, map.size());
+
+        uint32_t value = 0u;
+        EXPECT_EQ(EStatus::Ok, map.get(1u, value));
+        EXPECT_EQ(10u, value);
+        EXPECT_EQ(EStatus::NotExist, map.get(3u, value));
+        ASSERT_NE(nullptr, map.get(2u));
+        EXPECT_EQ(20u, *map.get(2u));
+        EXPECT_TRUE(map.contains(1u));
+        EXPECT_FALSE(map.contains(3u));
+    }
+
+    TEST_F(AFlatHashMap, putOverwritesValueOfExistingKey)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        map.put(1u, 10u);
+        const auto it = map.put(1u, 11u);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(1u, it->key);
+        EXPECT_EQ(11u, it->value);
+        EXPECT_EQ(11u, *map.get(1u));
+    }
+
+    TEST_F(AFlatHashMap, subscriptOperatorInsertsDefaultValueOrReturnsExisting)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        EXPECT_EQ(0u, map[1u]);
+        EXPECT_EQ(1u, map.size());
+        map[1u] = 5u;
+        EXPECT_EQ(5u, map[1u]);
+        EXPECT_EQ(1u, map.size());
+    }
+
+    TEST_F(AFlatHashMap, removesByKey)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+        map.put(3u, 30u);
+
+        uint32_t oldValue = 0u;
+        EXPECT_TRUE(map.remove(1u, &oldValue));
+        EXPECT_EQ(10u, oldValue);
+        EXPECT_FALSE(map.remove(1u));
+        EXPECT_EQ(2u, map.size());
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_EQ(20u, *map.get(2u));
+        EXPECT_EQ(30u, *map.get(3u));
+    }
+
+    TEST_F(AFlatHashMap, removeByIteratorReturnsIteratorToRemainingElements)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        for (uint32_t i = 0u; i < 100u; ++i)
+            map.put(i, i * 10u);
+
+        // remove every even key while iterating
+        for (auto it = map.begin(); it != map.end();)
+        {
+            if (it->key % 2u == 0u)
+            {
+                uint32_t oldValue = 0u;
+                const uint32_t expectedValue = it->value;
+                it = map.remove(it, &oldValue);
+                EXPECT_EQ(expectedValue, oldValue);
+            }
+            else
+                ++it;
+        }
+
+        EXPECT_EQ(50u, map.size());
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            EXPECT_EQ(i % 2u != 0u, map.contains(i));
+            if (i % 2u != 0u)
+                EXPECT_EQ(i * 10u, *map.get(i));
+        }
+    }
+
+    TEST_F(AFlatHashMap, iteratesOverAllElements)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        for (uint32_t i = 0u; i < 1000u; ++i)
+            map.put(i, i + 1u);
+
+        const auto& constMap = map;
+        size_t count = 0u;
+        for (const auto& pair : constMap)
+        {
+            EXPECT_EQ(pair.key + 1u, pair.value);
+            ++count;
+        }
+        EXPECT_EQ(1000u, count);
+
+        for (auto& pair : map)
+            pair.value = 0u;
+        EXPECT_EQ(0u, *map.get(500u));
+    }
+
+    TEST_F(AFlatHashMap, growsBeyondInitialCapacity)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        for (uint32_t i = 0u; i < 10000u; ++i)
+            map.put(i * 7919u, i);
+
+        EXPECT_EQ(10000u, map.size());
+        EXPECT_GE(map.capacity(), 10000u);
+        for (uint32_t i = 0u; i < 10000u; ++i)
+            EXPECT_EQ(i, *map.get(i * 7919u));
+    }
+
+    TEST_F(AFlatHashMap, canInsertWithoutGrowingWhenReservedToCapacity)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        map.reserve(1000u);
+        const size_t capacity = map.capacity();
+        EXPECT_GE(capacity, 1000u);
+        for (uint32_t i = 0u; i < capacity; ++i)
+            map.put(i, i);
+        EXPECT_EQ(capacity, map.capacity());
+
+        FlatHashMap<uint32_t, uint32_t> map2(1000u);
+        EXPECT_EQ(capacity, map2.capacity());
+    }
+
+    TEST_F(AFlatHashMap, clearKeepsCapacity)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        for (uint32_t i = 0u; i < 100u; ++i)
+            map.put(i, i);
+        const size_t capacity = map.capacity();
+
+        map.clear();
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(capacity, map.capacity());
+        EXPECT_FALSE(map.contains(1u));
+
+        map.put(1u, 2u);
+        EXPECT_EQ(2u, *map.get(1u));
+    }
+
+    TEST_F(AFlatHashMap, canBeCopiedAndMoved)
+    {
+        FlatHashMap<uint32_t, uint32_t> map;
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+
+        FlatHashMap<uint32_t, uint32_t> copy(map);
+        EXPECT_EQ(2u, copy.size());
+        EXPECT_EQ(10u, *copy.get(1u));
+
+        FlatHashMap<uint32_t, uint32_t> moved(std::move(copy));
+        EXPECT_EQ(2u, moved.size());
+        EXPECT_EQ(20u, *moved.get(2u));
+
+        FlatHashMap<uint32_t, uint32_t> assigned;
+        assigned.put(3u, 30u);
+        assigned = std::move(moved);
+        EXPECT_EQ(2u, assigned.size());
+        EXPECT_FALSE(assigned.contains(3u));
+
+        // moved from map can be reused
+        moved.put(4u, 40u); // NOLINT(bugprone-use-after-move) moved from object is valid and empty
+        EXPECT_EQ(40u, *moved.get(4u));
+    }
+
+    TEST_F(AFlatHashMap, swapsContent)
+    {
+        FlatHashMap<uint32_t, uint32_t> first;
+        FlatHashMap<uint32_t, uint32_t> second;
+        first.put(1u, 10u);
+        first.put(2u, 20u);
+        second.put(3u, 30u);
+
+        using std::swap;
+        swap(first, second);
+        EXPECT_EQ(1u, first.size());
+        EXPECT_EQ(2u, second.size());
+        EXPECT_TRUE(first.contains(3u));
+        EXPECT_TRUE(second.contains(2u));
+    }
+
+    TEST_F(AFlatHashMap, worksWithHandleAndResourceHashKeys)
+    {
+        FlatHashMap<NodeHandle, TransformHandle> handleMap;
+        handleMap.put(NodeHandle(3u), TransformHandle(5u));
+        EXPECT_EQ(TransformHandle(5u), *handleMap.get(NodeHandle(3u)));
+        EXPECT_FALSE(handleMap.contains(NodeHandle(5u)));
+
+        FlatHashMap<ResourceContentHash, uint32_t> hashMap;
+        hashMap.put(ResourceContentHash(1u, 2u), 3u);
+        hashMap.put(ResourceContentHash(2u, 1u), 4u);
+        EXPECT_EQ(3u, *hashMap.get(ResourceContentHash(1u, 2u)));
+        EXPECT_EQ(4u, *hashMap.get(ResourceContentHash(2u, 1u)));
+    }
+
+    TEST_F(AFlatHashMap, keepsElementsConsistentWithReferenceMapForRandomOperations)
+    {
+        std::mt19937 rng(42u);
+        FlatHashMap<uint32_t, uint32_t> map;
+        std::unordered_map<uint32_t, uint32_t> reference;
+        for (uint32_t i = 0u; i < 20000u; ++i)
+        {
+            const uint32_t key = rng() % 1000u;
+            if (rng() % 3u == 0u)
+            {
+                EXPECT_EQ(reference.erase(key) != 0u, map.remove(key));
+            }
+            else
+            {
+                map.put(key, i);
+                reference[key] = i;
+            }
+        }
+
+        ASSERT_EQ(reference.size(), map.size());
+        for (const auto& pair : map)
+            EXPECT_EQ(reference[pair.key], pair.value);
+    }
+
+    TEST_F(AFlatHashMap, constructsAndDestructsElementsCorrectly)
+    {
+        ExpectRefCnt(0);
+        {
+            FlatHashMap<RCKey, RCValue> map;
+            map.put(RCKey(1), RCValue(2));
+            map.put(RCKey(2), RCValue(3));
+            map.put(RCKey(3), RCValue(4));
+            ExpectRefCnt(3);
+
+            // overwrite
+            map.put(RCKey(1), RCValue(5));
+            ExpectRefCnt(3);
+
+            {
+                RCValue value;
+                map.remove(RCKey(1), &value);
+                EXPECT_EQ(RCValue(5u), value);
+            }
+            ExpectRefCnt(2);
+
+            FlatHashMap<RCKey, RCValue> copy(map);
+            ExpectRefCnt(4);
+            copy.clear();
+            ExpectRefCnt(2);
+        }
+        ExpectRefCnt(0);
+    }
+}
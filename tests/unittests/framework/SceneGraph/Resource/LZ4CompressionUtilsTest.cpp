@@ -8,7 +8,9 @@
 
 #include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
 #include "gtest/gtest.h"
+#include <cstring>
 #include <numeric>
 
 namespace ramses::internal
@@ -19,7 +21,7 @@ namespace ramses::internal
                             LZ4CompressionUtils::CompressionLevel::High })
         {
             ResourceBlob inBlob(input.size(), input.data());
-            CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(inBlob, level);
+            CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(inBlob, level, LZ4CompressionUtils::BlockFormat::Enabled);
             EXPECT_GT(compBlob.size(), 0u);
             ASSERT_TRUE(compBlob.data() != nullptr);
 
@@ -31,14 +33,14 @@ namespace ramses::internal
 
     TEST(LZ4CompressionUtilsTest, TestEmptyCompressionFast)
     {
-        CompressedResourceBlob res = LZ4CompressionUtils::compress(ResourceBlob(), LZ4CompressionUtils::CompressionLevel::Fast);
+        CompressedResourceBlob res = LZ4CompressionUtils::compress(ResourceBlob(), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
         EXPECT_EQ(0u, res.size());
         EXPECT_TRUE(res.data() == nullptr);
     }
 
     TEST(LZ4CompressionUtilsTest, TestEmptyCompressionHigh)
     {
-        CompressedResourceBlob res = LZ4CompressionUtils::compress(ResourceBlob(), LZ4CompressionUtils::CompressionLevel::High);
+        CompressedResourceBlob res = LZ4CompressionUtils::compress(ResourceBlob(), LZ4CompressionUtils::CompressionLevel::High, LZ4CompressionUtils::BlockFormat::Enabled);
         EXPECT_EQ(0u, res.size());
         EXPECT_TRUE(res.data() == nullptr);
     }
@@ -69,4 +71,156 @@ namespace ramses::internal
         std::generate(big.begin(), big.end(), [](){ static uint8_t i{4}; return std::byte(++i); });
         checkCompressionDecompression(big);
     }
+
+    static std::vector<std::byte> createBlockFormatInput()
+    {
+        // two full blocks and one partial block
+        std::vector<std::byte> input(2u * LZ4CompressionUtils::BlockSize + 1000u);
+        for (size_t i = 0u; i < input.size(); ++i)
+            input[i] = std::byte(static_cast<uint8_t>((i * 7u) % 251u));
+        return input;
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDataUpToBlockSizeIsCompressedAsSingleBlock)
+    {
+        std::vector<std::byte> input(LZ4CompressionUtils::BlockSize, std::byte{ 3 });
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+        EXPECT_FALSE(LZ4CompressionUtils::isBlockFormat(compBlob.span()));
+        checkCompressionDecompression(input);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDataLargerThanBlockSizeIsCompressedInBlocks)
+    {
+        const auto input = createBlockFormatInput();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+        EXPECT_TRUE(LZ4CompressionUtils::isBlockFormat(compBlob.span()));
+
+        LZ4CompressionUtils::BlockIndex index;
+        ASSERT_TRUE(LZ4CompressionUtils::readBlockIndex(compBlob.span(), static_cast<uint32_t>(input.size()), index));
+        EXPECT_EQ(LZ4CompressionUtils::BlockSize, index.blockSize);
+        EXPECT_EQ(3u, index.compressedBlockSizes.size());
+        EXPECT_EQ(compBlob.size(), index.dataOffset + std::accumulate(index.compressedBlockSizes.cbegin(), index.compressedBlockSizes.cend(), size_t{ 0u }));
+
+        checkCompressionDecompression(input);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestBlocksCanBeDecompressedIncrementally)
+    {
+        const auto input = createBlockFormatInput();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::High, LZ4CompressionUtils::BlockFormat::Enabled);
+
+        // index is available as soon as its bytes were received
+        LZ4CompressionUtils::BlockIndex index;
+        EXPECT_FALSE(LZ4CompressionUtils::readBlockIndex(compBlob.span().subspan(0u, 8u), static_cast<uint32_t>(input.size()), index));
+        ASSERT_TRUE(LZ4CompressionUtils::readBlockIndex(compBlob.span().subspan(0u, 24u), static_cast<uint32_t>(input.size()), index));
+
+        std::vector<std::byte> output(input.size());
+        size_t compressedOffset = index.dataOffset;
+        for (size_t i = 0u; i < index.compressedBlockSizes.size(); ++i)
+        {
+            const size_t plainOffset = i * index.blockSize;
+            const size_t plainSize = std::min<size_t>(index.blockSize, input.size() - plainOffset);
+            ASSERT_TRUE(LZ4CompressionUtils::decompressBlock(compBlob.span().subspan(compressedOffset, index.compressedBlockSizes[i]), { output.data() + plainOffset, plainSize }));
+            EXPECT_EQ(absl::MakeConstSpan(input).subspan(plainOffset, plainSize), absl::MakeConstSpan(output).subspan(plainOffset, plainSize));
+            compressedOffset += index.compressedBlockSizes[i];
+        }
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestBlockFormatFailsWithWrongUncompressedSize)
+    {
+        const auto input = createBlockFormatInput();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size() + LZ4CompressionUtils::BlockSize)).size());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size() - 1u)).size());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestBlockFormatFailsWithTruncatedData)
+    {
+        const auto input = createBlockFormatInput();
+        CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+        const CompressedResourceBlob truncated(compBlob.size() - 10u, compBlob.data());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(truncated, static_cast<uint32_t>(input.size())).size());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDataLargerThanBlockSizeIsCompressedAsSingleBlockIfBlockFormatDisabled)
+    {
+        const auto input = createBlockFormatInput();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::High, LZ4CompressionUtils::BlockFormat::Disabled);
+        EXPECT_FALSE(LZ4CompressionUtils::isBlockFormat(compBlob.span()));
+
+        const ResourceBlob outBlob = LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size()));
+        EXPECT_EQ(input, outBlob.span());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestBlocksAreDecompressedConcurrentlyWithThreadPool)
+    {
+        const auto input = createBlockFormatInput();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+        ASSERT_TRUE(LZ4CompressionUtils::isBlockFormat(compBlob.span()));
+
+        WorkerThreadPool threadPool{ 2u };
+        const ResourceBlob outBlob = LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size()), threadPool);
+        EXPECT_EQ(input, outBlob.span());
+
+        const CompressedResourceBlob truncated(compBlob.size() - 10u, compBlob.data());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(truncated, static_cast<uint32_t>(input.size()), threadPool).size());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestBlocksAreCompressedConcurrentlyWithThreadPoolWithSameResult)
+    {
+        const auto input = createBlockFormatInput();
+        const ResourceBlob inBlob(input.size(), input.data());
+        WorkerThreadPool threadPool{ 2u };
+        for (auto level : { LZ4CompressionUtils::CompressionLevel::Fast,
+                            LZ4CompressionUtils::CompressionLevel::High })
+        {
+            const CompressedResourceBlob expectedBlob = LZ4CompressionUtils::compress(inBlob, level, LZ4CompressionUtils::BlockFormat::Enabled);
+            const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(inBlob, level, LZ4CompressionUtils::BlockFormat::Enabled, threadPool);
+            EXPECT_TRUE(LZ4CompressionUtils::isBlockFormat(compBlob.span()));
+            EXPECT_EQ(expectedBlob.span(), compBlob.span());
+        }
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestIncrementalDecompressorDecompressesBlocksWhileDataArrives)
+    {
+        const auto input = createBlockFormatInput();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+
+        LZ4CompressionUtils::IncrementalDecompressor decompressor{ static_cast<uint32_t>(input.size()) };
+        // data arrives in pieces not aligned to blocks
+        constexpr size_t PieceSize = 1000u;
+        for (size_t received = 1u; received < compBlob.size(); received += PieceSize)
+        {
+            ASSERT_TRUE(decompressor.update(compBlob.span().subspan(0u, received)));
+            EXPECT_FALSE(decompressor.isFinished());
+        }
+        ASSERT_TRUE(decompressor.update(compBlob.span()));
+        ASSERT_TRUE(decompressor.isFinished());
+
+        const ResourceBlob outBlob = decompressor.release();
+        EXPECT_EQ(input, outBlob.span());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestIncrementalDecompressorFailsForSingleBlockAndCorruptedData)
+    {
+        const auto input = createBlockFormatInput();
+        const ResourceBlob inBlob(input.size(), input.data());
+
+        const CompressedResourceBlob singleBlock = LZ4CompressionUtils::compress(inBlob, LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Disabled);
+        LZ4CompressionUtils::IncrementalDecompressor singleBlockDecompressor{ static_cast<uint32_t>(input.size()) };
+        EXPECT_FALSE(singleBlockDecompressor.update(singleBlock.span()));
+
+        CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(inBlob, LZ4CompressionUtils::CompressionLevel::Fast, LZ4CompressionUtils::BlockFormat::Enabled);
+        LZ4CompressionUtils::IncrementalDecompressor wrongSizeDecompressor{ static_cast<uint32_t>(input.size() + LZ4CompressionUtils::BlockSize) };
+        EXPECT_FALSE(wrongSizeDecompressor.update(compBlob.span()));
+
+        // index claims first block is shorter than it is, it cannot be decompressed to full block size
+        LZ4CompressionUtils::BlockIndex index;
+        ASSERT_TRUE(LZ4CompressionUtils::readBlockIndex(compBlob.span(), static_cast<uint32_t>(input.size()), index));
+        const uint32_t truncatedBlockSize = index.compressedBlockSizes[0] - 10u;
+        constexpr size_t FirstBlockSizeOffset = 12u; // magic, block size, block count
+        std::memcpy(compBlob.data() + FirstBlockSizeOffset, &truncatedBlockSize, sizeof(truncatedBlockSize));
+        LZ4CompressionUtils::IncrementalDecompressor corruptedDecompressor{ static_cast<uint32_t>(input.size()) };
+        EXPECT_FALSE(corruptedDecompressor.update(compBlob.span()));
+    }
 }
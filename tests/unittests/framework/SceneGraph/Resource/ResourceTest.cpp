@@ -8,6 +8,8 @@
 
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/SceneGraph/Resource/ResourceBase.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+#include "internal/Core/TaskFramework/WorkerThreadPool.h"
 #include "internal/Core/Utils/ThreadBarrier.h"
 #include "gtest/gtest.h"
 #include <memory>
@@ -273,6 +275,31 @@ namespace ramses::internal
         EXPECT_EQ(resA.getCompressedResourceData().span(), resB.getCompressedResourceData().span());
     }
 
+    TEST_F(AResource, usesLZ4BlockFormatOnlyForRealtimeCompressionOfLargeData)
+    {
+        std::vector<std::byte> largeData(2u * LZ4CompressionUtils::BlockSize + 100u);
+        for (size_t i = 0u; i < largeData.size(); ++i)
+            largeData[i] = std::byte(static_cast<uint8_t>((i * 13u) % 241u));
+
+        // offline compressed data is written to files which must stay readable by older runtimes
+        DummyResource resOffline;
+        resOffline.setResourceData(ResourceBlob{ largeData.size(), largeData.data() });
+        resOffline.compress(IResource::CompressionLevel::Offline);
+        EXPECT_FALSE(LZ4CompressionUtils::isBlockFormat(resOffline.getCompressedResourceData().span()));
+
+        DummyResource resRealtime;
+        resRealtime.setResourceData(ResourceBlob{ largeData.size(), largeData.data() });
+        resRealtime.compress(IResource::CompressionLevel::Realtime);
+        ASSERT_TRUE(LZ4CompressionUtils::isBlockFormat(resRealtime.getCompressedResourceData().span()));
+
+        WorkerThreadPool threadPool{ 2u };
+        DummyResource resFromCompressed;
+        resFromCompressed.setCompressedResourceData(CompressedResourceBlob(resRealtime.getCompressedResourceData().size(), resRealtime.getCompressedResourceData().data()),
+                                                    IResource::CompressionLevel::Realtime, resRealtime.getDecompressedDataSize(), resRealtime.getHash());
+        resFromCompressed.decompress(threadPool);
+        EXPECT_EQ(largeData, resFromCompressed.getResourceData().span());
+    }
+
     TEST_F(AResource, canBeCompressedAgainAfterSettingNewResourceData)
     {
         DummyResource resA(1);
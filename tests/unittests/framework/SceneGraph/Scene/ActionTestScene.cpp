@@ -36,6 +36,17 @@ namespace ramses::internal
         return m_scene.getEffectTimeSync();
     }
 
+    void ActionTestScene::setTransformationUpdateMode(ETransformationUpdateMode mode)
+    {
+        m_actionCollector.setTransformationUpdateMode(mode);
+        flushPendingSceneActions();
+    }
+
+    ETransformationUpdateMode ActionTestScene::getTransformationUpdateMode() const
+    {
+        return m_scene.getTransformationUpdateMode();
+    }
+
     uint32_t ActionTestScene::getRenderableCount() const
     {
         return m_scene.getRenderableCount();
@@ -102,6 +113,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        m_actionCollector.setRenderableBoundingBox(renderableHandle, boundingBox);
+        flushPendingSceneActions();
+    }
+
     const Renderable& ActionTestScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_scene.getRenderable(renderableHandle);
@@ -1060,6 +1077,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderPassStateSorting(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassStateSorting(pass, enable);
+        flushPendingSceneActions();
+    }
+
     void ActionTestScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         m_actionCollector.addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -30,6 +30,9 @@ namespace ramses::internal
         void   setEffectTimeSync(FlushTime::Clock::time_point t) override;
         [[nodiscard]] FlushTime::Clock::time_point getEffectTimeSync() const override;
 
+        void   setTransformationUpdateMode(ETransformationUpdateMode mode) override;
+        [[nodiscard]] ETransformationUpdateMode getTransformationUpdateMode() const override;
+
         // Renderable
         RenderableHandle            allocateRenderable              (NodeHandle nodeHandle, RenderableHandle handle) override;
         void                        releaseRenderable               (RenderableHandle renderableHandle) override;
@@ -42,6 +45,7 @@ namespace ramses::internal
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) override;
         [[nodiscard]] const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const override;
 
         // Render state
@@ -200,6 +204,7 @@ namespace ramses::internal
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         [[nodiscard]] const RenderPass&           getRenderPass                   (RenderPassHandle passHandle) const override;
@@ -0,0 +1,96 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/SceneGraph/Scene/DataInstanceArena.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace ramses::internal
+{
+    TEST(ADataInstanceArena, allocatesZeroInitializedAlignedMemory)
+    {
+        DataInstanceArena arena;
+        std::byte* data1 = arena.allocate(3u);
+        std::byte* data2 = arena.allocate(100u);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data1) % alignof(std::max_align_t)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data2) % alignof(std::max_align_t)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        EXPECT_TRUE(std::all_of(data2, data2 + 100u, [](std::byte b) { return b == std::byte{ 0 }; }));
+        EXPECT_EQ(1u, arena.getChunkCount());
+    }
+
+    TEST(ADataInstanceArena, packsAllocationsIntoChunks)
+    {
+        DataInstanceArena arena{ 1024u };
+        std::byte* data1 = arena.allocate(64u);
+        std::byte* data2 = arena.allocate(64u);
+        EXPECT_EQ(data1 + 64u, data2);
+        for (int i = 0; i < 14; ++i)
+            std::ignore = arena.allocate(64u);
+        EXPECT_EQ(1u, arena.getChunkCount());
+
+        std::ignore = arena.allocate(64u);
+        EXPECT_EQ(2u, arena.getChunkCount());
+    }
+
+    TEST(ADataInstanceArena, allocatesOwnChunkForAllocationBiggerThanChunkSize)
+    {
+        DataInstanceArena arena{ 1024u };
+        std::byte* data = arena.allocate(4096u);
+        std::memset(data, 1, 4096u);
+        EXPECT_EQ(1u, arena.getChunkCount());
+        std::ignore = arena.allocate(16u);
+        EXPECT_EQ(2u, arena.getChunkCount());
+    }
+
+    TEST(ADataInstanceArena, reusesReleasedMemoryOfSameSizeAndZeroInitializesIt)
+    {
+        DataInstanceArena arena;
+        std::byte* data1 = arena.allocate(32u);
+        std::memset(data1, 1, 32u);
+        arena.release(data1, 32u);
+
+        std::byte* data2 = arena.allocate(32u);
+        EXPECT_EQ(data1, data2);
+        EXPECT_TRUE(std::all_of(data2, data2 + 32u, [](std::byte b) { return b == std::byte{ 0 }; }));
+    }
+
+    TEST(ADataInstanceArena, canBeUsedAsSceneDataInstanceStorage)
+    {
+        Scene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Float), DataFieldInfo(EDataType::DataReference) }, ResourceContentHash(123u, 0u), {});
+        const DataInstanceHandle ownedInstance = scene.allocateDataInstance(layout, {});
+        scene.setDataSingleFloat(ownedInstance, DataFieldHandle(0u), 1.f);
+
+        scene.enableDataInstanceArena();
+        ASSERT_NE(nullptr, scene.getDataInstanceArena());
+        const DataInstanceHandle instance1 = scene.allocateDataInstance(layout, {});
+        const DataInstanceHandle instance2 = scene.allocateDataInstance(layout, {});
+        EXPECT_EQ(1u, scene.getDataInstanceArena()->getChunkCount());
+
+        scene.setDataSingleFloat(instance1, DataFieldHandle(0u), 2.f);
+        scene.setDataSingleFloat(instance2, DataFieldHandle(0u), 3.f);
+        const float* instance1Data = scene.getDataFloatArray(instance1, DataFieldHandle(0u));
+        EXPECT_FALSE(scene.getDataReference(instance1, DataFieldHandle(1u)).isValid());
+
+        // data stays at same address when scene allocates more data instances
+        for (int i = 0; i < 1000; ++i)
+            std::ignore = scene.allocateDataInstance(layout, {});
+        EXPECT_EQ(instance1Data, scene.getDataFloatArray(instance1, DataFieldHandle(0u)));
+
+        scene.releaseDataInstance(ownedInstance);
+        scene.releaseDataInstance(instance2);
+        const DataInstanceHandle instance3 = scene.allocateDataInstance(layout, {});
+        EXPECT_EQ(0.f, scene.getDataSingleFloat(instance3, DataFieldHandle(0u)));
+        EXPECT_FALSE(scene.getDataReference(instance3, DataFieldHandle(1u)).isValid());
+
+        EXPECT_EQ(2.f, scene.getDataSingleFloat(instance1, DataFieldHandle(0u)));
+    }
+}
@@ -0,0 +1,147 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include <gtest/gtest.h>
+#include <array>
+
+namespace ramses::internal
+{
+    class ASceneActionCoalescer : public ::testing::Test
+    {
+    public:
+        ASceneActionCoalescer()
+            : creator(collection)
+        {
+        }
+
+    protected:
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator;
+        SceneActionCoalescer coalescer;
+    };
+
+    TEST_F(ASceneActionCoalescer, doesNotModifyCollectionWithoutRedundantActions)
+    {
+        creator.allocateNode(0u, NodeHandle(1u));
+        creator.allocateTransform(NodeHandle(1u), TransformHandle(2u));
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.setRotation(TransformHandle(2u), glm::vec4(1.f), ERotationType::Euler_XYZ);
+        const SceneActionCollection original = collection.copy();
+
+        EXPECT_EQ(0u, coalescer.coalesce(collection));
+        EXPECT_EQ(original, collection);
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsOnlyLastTranslationOfSameTransform)
+    {
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.setTranslation(TransformHandle(3u), glm::vec3(2.f));
+        creator.setTranslation(TransformHandle(2u), glm::vec3(3.f));
+
+        EXPECT_EQ(1u, coalescer.coalesce(collection));
+        ASSERT_EQ(2u, collection.numberOfActions());
+
+        auto first = collection[0];
+        TransformHandle handle;
+        glm::vec3 value;
+        first.read(handle);
+        first.read(value);
+        EXPECT_EQ(TransformHandle(3u), handle);
+        EXPECT_EQ(glm::vec3(2.f), value);
+
+        auto second = collection[1];
+        second.read(handle);
+        second.read(value);
+        EXPECT_EQ(TransformHandle(2u), handle);
+        EXPECT_EQ(glm::vec3(3.f), value);
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsOrderOfActionsWhichAreNotCoalescable)
+    {
+        creator.setRenderableVisibility(RenderableHandle(1u), EVisibilityMode::Off);
+        creator.allocateNode(0u, NodeHandle(5u));
+        creator.setRenderableVisibility(RenderableHandle(1u), EVisibilityMode::Visible);
+        creator.allocateNode(0u, NodeHandle(6u));
+
+        EXPECT_EQ(1u, coalescer.coalesce(collection));
+        ASSERT_EQ(3u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId::AllocateNode, collection[0].type());
+        EXPECT_EQ(ESceneActionId::SetRenderableVisibility, collection[1].type());
+        EXPECT_EQ(ESceneActionId::AllocateNode, collection[2].type());
+    }
+
+    TEST_F(ASceneActionCoalescer, doesNotMergeDifferentActionTypesOnSameTransform)
+    {
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.setScaling(TransformHandle(2u), glm::vec3(2.f));
+        creator.setRotation(TransformHandle(2u), glm::vec4(1.f), ERotationType::Euler_XYZ);
+
+        EXPECT_EQ(0u, coalescer.coalesce(collection));
+        EXPECT_EQ(3u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, doesNotMergeDataWritesWithDifferentFieldOrElementCount)
+    {
+        const std::array<float, 2u> values{ 1.f, 2.f };
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(0u), 2u, values.data());
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(1u), 2u, values.data());
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(0u), 1u, values.data());
+
+        EXPECT_EQ(0u, coalescer.coalesce(collection));
+        EXPECT_EQ(3u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, producesSameSceneStateAsOriginalActions)
+    {
+        creator.allocateNode(0u, NodeHandle(1u));
+        creator.allocateTransform(NodeHandle(1u), TransformHandle(2u));
+        creator.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F } }, ResourceContentHash::Invalid(), DataLayoutHandle(3u));
+        creator.allocateDataInstance(DataLayoutHandle(3u), DataInstanceHandle(4u));
+        for (uint32_t i = 0u; i < 10u; ++i)
+        {
+            const auto value = static_cast<float>(i);
+            creator.setTranslation(TransformHandle(2u), glm::vec3(value));
+            creator.setRotation(TransformHandle(2u), glm::vec4(value), ERotationType::Euler_ZYX);
+            const glm::vec4 data{ value };
+            creator.setDataVector4fArray(DataInstanceHandle(4u), DataFieldHandle(0u), 1u, &data);
+        }
+
+        Scene expectedScene;
+        SceneActionApplier::ApplyActionsOnScene(expectedScene, collection);
+
+        EXPECT_EQ(27u, coalescer.coalesce(collection));
+        EXPECT_EQ(7u, collection.numberOfActions());
+
+        Scene coalescedScene;
+        SceneActionApplier::ApplyActionsOnScene(coalescedScene, collection);
+
+        EXPECT_EQ(expectedScene.getTranslation(TransformHandle(2u)), coalescedScene.getTranslation(TransformHandle(2u)));
+        EXPECT_EQ(expectedScene.getRotation(TransformHandle(2u)), coalescedScene.getRotation(TransformHandle(2u)));
+        EXPECT_EQ(expectedScene.getRotationType(TransformHandle(2u)), coalescedScene.getRotationType(TransformHandle(2u)));
+        EXPECT_EQ(expectedScene.getDataSingleVector4f(DataInstanceHandle(4u), DataFieldHandle(0u)), coalescedScene.getDataSingleVector4f(DataInstanceHandle(4u), DataFieldHandle(0u)));
+        EXPECT_EQ(glm::vec3(9.f), coalescedScene.getTranslation(TransformHandle(2u)));
+    }
+
+    TEST_F(ASceneActionCoalescer, canBeReusedForMultipleCollections)
+    {
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.setTranslation(TransformHandle(2u), glm::vec3(2.f));
+        EXPECT_EQ(1u, coalescer.coalesce(collection));
+
+        SceneActionCollection otherCollection;
+        SceneActionCollectionCreator otherCreator(otherCollection);
+        otherCreator.setTranslation(TransformHandle(2u), glm::vec3(3.f));
+        EXPECT_EQ(0u, coalescer.coalesce(otherCollection));
+        EXPECT_EQ(1u, otherCollection.numberOfActions());
+        EXPECT_EQ(1u, collection.numberOfActions());
+    }
+}
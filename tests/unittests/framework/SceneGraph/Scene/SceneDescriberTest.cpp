@@ -205,6 +205,38 @@ namespace ramses::internal
         EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId::CompoundRenderable));
     }
 
+    TEST_F(SceneDescriberTest, checksDescriptionActionsForSceneWithRenderableWithBoundingBox)
+    {
+        createRenderable();
+        const BoundingBox boundingBox{ glm::vec3{ -1.f, -2.f, -3.f }, glm::vec3{ 1.f, 2.f, 3.f } };
+        m_scene.setRenderableBoundingBox(RenderableHandle{ 0u }, boundingBox);
+        SceneDescriber::describeScene<IScene>(m_scene, creator);
+
+        ASSERT_EQ(3u, actions.numberOfActions());
+        EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId::CompoundRenderable));
+        EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId::SetRenderableBoundingBox));
+
+        Scene newScene;
+        SceneActionApplier::ApplyActionsOnScene(newScene, actions);
+        EXPECT_EQ(boundingBox, newScene.getRenderable(RenderableHandle{ 0u }).boundingBox);
+    }
+
+    TEST_F(SceneDescriberTest, describesTransformationUpdateModeOnlyIfNotDefault)
+    {
+        SceneDescriber::describeScene<IScene>(m_scene, creator);
+        EXPECT_EQ(0u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId::SetTransformationUpdateMode));
+
+        actions.clear();
+        m_scene.setTransformationUpdateMode(ETransformationUpdateMode::BreadthFirst);
+        SceneDescriber::describeScene<IScene>(m_scene, creator);
+        ASSERT_EQ(1u, actions.numberOfActions());
+        EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId::SetTransformationUpdateMode));
+
+        Scene newScene;
+        SceneActionApplier::ApplyActionsOnScene(newScene, actions);
+        EXPECT_EQ(ETransformationUpdateMode::BreadthFirst, newScene.getTransformationUpdateMode());
+    }
+
     TEST_F(SceneDescriberTest, checksDescriptionActionsForSceneWithStateAndCompoundAction)
     {
         createState();
@@ -89,4 +89,11 @@ namespace ramses::internal
         EXPECT_EQ(sceneInfo.sceneID, scene.getSceneId());
         EXPECT_EQ(sceneInfo.friendlyName, scene.getName());
     }
+
+    TYPED_TEST(AScene, SetsTransformationUpdateMode)
+    {
+        EXPECT_EQ(ETransformationUpdateMode::Lazy, this->m_scene.getTransformationUpdateMode());
+        this->m_scene.setTransformationUpdateMode(ETransformationUpdateMode::BreadthFirst);
+        EXPECT_EQ(ETransformationUpdateMode::BreadthFirst, this->m_scene.getTransformationUpdateMode());
+    }
 }
@@ -38,6 +38,7 @@ namespace ramses::internal
         EXPECT_FALSE(rp.renderTarget.isValid());
         EXPECT_EQ(0, rp.renderOrder);
         EXPECT_FALSE(rp.isRenderOnce);
+        EXPECT_FALSE(rp.isStateSortingEnabled);
     }
 
     TYPED_TEST(AScene, RenderPassReleased)
@@ -171,4 +172,13 @@ namespace ramses::internal
         this->m_scene.setRenderPassRenderOnce(pass, false);
         EXPECT_FALSE(this->m_scene.getRenderPass(pass).isRenderOnce);
     }
+
+    TYPED_TEST(AScene, canSetStateSorting)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass(0, {});
+        this->m_scene.setRenderPassStateSorting(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isStateSortingEnabled);
+        this->m_scene.setRenderPassStateSorting(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isStateSortingEnabled);
+    }
 }
@@ -122,4 +122,15 @@ namespace ramses::internal
         this->m_scene.setRenderableStartVertex(renderable, 132u);
         EXPECT_EQ(132u, this->m_scene.getRenderable(renderable).startVertex);
     }
+
+    TYPED_TEST(AScene, SetsBoundingBoxOfRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        EXPECT_FALSE(this->m_scene.getRenderable(renderable).boundingBox.isValid());
+
+        const BoundingBox boundingBox{ glm::vec3{ -1.f, -2.f, -3.f }, glm::vec3{ 1.f, 2.f, 3.f } };
+        this->m_scene.setRenderableBoundingBox(renderable, boundingBox);
+        EXPECT_TRUE(this->m_scene.getRenderable(renderable).boundingBox.isValid());
+        EXPECT_EQ(boundingBox, this->m_scene.getRenderable(renderable).boundingBox);
+    }
 }
@@ -162,6 +162,7 @@ namespace ramses::internal
             scene.setRenderPassRenderOrder(renderPass, 1);
             scene.setRenderPassEnabled(renderPass, false);
             scene.setRenderPassRenderOnce(renderPass, true);
+            scene.setRenderPassStateSorting(renderPass, true);
 
             scene.addRenderGroupToRenderPass(renderPass, renderGroup, 15);
             scene.addRenderGroupToRenderPass(renderPass, renderGroup2, 5);
@@ -489,6 +490,7 @@ namespace ramses::internal
             EXPECT_EQ(EClearFlag::None, rp.clearFlags);
             EXPECT_FALSE(rp.isEnabled);
             EXPECT_TRUE(rp.isRenderOnce);
+            EXPECT_TRUE(rp.isStateSortingEnabled);
 
             ASSERT_TRUE(RenderGroupUtils::ContainsRenderGroup(renderGroup, rp));
             EXPECT_FALSE(RenderGroupUtils::ContainsRenderGroup(renderGroup2, rp));
@@ -12,6 +12,8 @@
 #include "internal/Core/Math3d/Rotation.h"
 #include "glm/gtx/transform.hpp"
 
+#include <array>
+
 using namespace testing;
 
 namespace ramses::internal
@@ -466,4 +468,103 @@ namespace ramses::internal
 
         this->expectCorrectMatrices(child, expectedUpdatedChildWorldMatrix, expectedUpdatedChildObjectMatrix);
     }
+
+    TEST_F(ATransformationCachedScene, UsesLazyTransformationUpdateByDefault)
+    {
+        EXPECT_EQ(ETransformationUpdateMode::Lazy, this->scene.getTransformationUpdateMode());
+
+        this->scene.setTranslation(this->transform, glm::vec3(1, 2, 3));
+        this->scene.updateWorldMatricesBreadthFirst();
+        EXPECT_TRUE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithTransform));
+    }
+
+    TEST_F(ATransformationCachedScene, BreadthFirstUpdateCleansWorldMatricesOfWholeHierarchy)
+    {
+        this->scene.setTransformationUpdateMode(ETransformationUpdateMode::BreadthFirst);
+
+        const NodeHandle child = this->scene.allocateNode(0, {});
+        const NodeHandle grandChild = this->scene.allocateNode(0, {});
+        const TransformHandle grandChildTransform = this->scene.allocateTransform(grandChild, {});
+        this->scene.addChildToNode(this->nodeWithTransform, child);
+        this->scene.addChildToNode(child, grandChild);
+
+        const glm::vec3 parentTranslation(1, 2, 3);
+        const glm::vec4 parentRotation(10, 20, 30, 1);
+        const glm::vec3 grandChildScaling(2, 3, 4);
+        this->scene.setTranslation(this->transform, parentTranslation);
+        this->scene.setRotation(this->transform, parentRotation, ERotationType::Euler_ZYX);
+        this->scene.setScaling(grandChildTransform, grandChildScaling);
+
+        this->scene.updateWorldMatricesBreadthFirst();
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithTransform));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithoutTransform));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, child));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, grandChild));
+        // object matrices are still updated lazily
+        EXPECT_TRUE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_Object, grandChild));
+
+        const auto parentWorldMatrix = glm::translate(parentTranslation) * Math3d::Rotation(parentRotation, ERotationType::Euler_ZYX);
+        expectMatrixFloatEqual(parentWorldMatrix, this->scene.updateMatrixCache(ETransformationMatrixType_World, child));
+        expectMatrixFloatEqual(parentWorldMatrix * glm::scale(grandChildScaling), this->scene.updateMatrixCache(ETransformationMatrixType_World, grandChild));
+        this->expectIdentityMatrices(this->nodeWithoutTransform);
+    }
+
+    TEST_F(ATransformationCachedScene, BreadthFirstUpdateGivesSameResultsAsLazyUpdateAfterModifications)
+    {
+        TransformationCachedScene lazyScene;
+        std::array<NodeHandle, 6u> nodes;
+        std::array<NodeHandle, 6u> lazyNodes;
+        std::array<TransformHandle, 6u> transforms;
+        std::array<TransformHandle, 6u> lazyTransforms;
+        this->scene.setTransformationUpdateMode(ETransformationUpdateMode::BreadthFirst);
+
+        for (size_t i = 0u; i < nodes.size(); ++i)
+        {
+            nodes[i] = this->scene.allocateNode(0, {});
+            lazyNodes[i] = lazyScene.allocateNode(0, {});
+            transforms[i] = this->scene.allocateTransform(nodes[i], {});
+            lazyTransforms[i] = lazyScene.allocateTransform(lazyNodes[i], {});
+            // 0 is root, 1 and 2 children of 0, 3 and 4 children of 1, 5 child of 4
+            if (i > 0u)
+            {
+                const size_t parent = (i == 5u ? 4u : (i - 1u) / 2u);
+                this->scene.addChildToNode(nodes[parent], nodes[i]);
+                lazyScene.addChildToNode(lazyNodes[parent], lazyNodes[i]);
+            }
+            const glm::vec3 translation{ float(i), 1.f, -float(i) };
+            this->scene.setTranslation(transforms[i], translation);
+            lazyScene.setTranslation(lazyTransforms[i], translation);
+        }
+
+        const auto expectSameWorldMatrices = [&]()
+        {
+            this->scene.updateWorldMatricesBreadthFirst();
+            for (size_t i = 0u; i < nodes.size(); ++i)
+            {
+                EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, nodes[i]));
+                expectMatrixFloatEqual(lazyScene.updateMatrixCache(ETransformationMatrixType_World, lazyNodes[i]), this->scene.updateMatrixCache(ETransformationMatrixType_World, nodes[i]));
+            }
+        };
+        expectSameWorldMatrices();
+
+        // modify only inner node
+        this->scene.setScaling(transforms[1], glm::vec3(2.f));
+        lazyScene.setScaling(lazyTransforms[1], glm::vec3(2.f));
+        EXPECT_TRUE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, nodes[5]));
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, nodes[2]));
+        expectSameWorldMatrices();
+
+        // lazy update in between must not break following breadth first update
+        this->scene.setRotation(transforms[0], glm::vec4(0.f, 90.f, 0.f, 1.f), ERotationType::Euler_XYZ);
+        lazyScene.setRotation(lazyTransforms[0], glm::vec4(0.f, 90.f, 0.f, 1.f), ERotationType::Euler_XYZ);
+        std::ignore = this->scene.updateMatrixCache(ETransformationMatrixType_World, nodes[3]);
+        expectSameWorldMatrices();
+
+        // hierarchy changes
+        this->scene.removeChildFromNode(nodes[1], nodes[4]);
+        lazyScene.removeChildFromNode(lazyNodes[1], lazyNodes[4]);
+        this->scene.addChildToNode(nodes[2], nodes[4]);
+        lazyScene.addChildToNode(lazyNodes[2], lazyNodes[4]);
+        expectSameWorldMatrices();
+    }
 }
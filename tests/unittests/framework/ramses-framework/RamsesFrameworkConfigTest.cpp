@@ -9,6 +9,7 @@
 #include "gmock/gmock.h"
 #include "ramses/framework/RamsesFrameworkConfig.h"
 #include "impl/RamsesFrameworkConfigImpl.h"
+#include "internal/Components/ResourceCompressionThreadPool.h"
 
 namespace ramses::internal
 {
@@ -197,6 +198,8 @@ namespace ramses::internal
         EXPECT_EQ(EConnectionProtocol::TCP, frameworkConfig.impl().getUsedProtocol());
         EXPECT_TRUE(frameworkConfig.setConnectionSystem(EConnectionSystem::Off));
         EXPECT_EQ(EConnectionProtocol::Off, frameworkConfig.impl().getUsedProtocol());
+        EXPECT_TRUE(frameworkConfig.setConnectionSystem(EConnectionSystem::Local));
+        EXPECT_EQ(EConnectionProtocol::Local, frameworkConfig.impl().getUsedProtocol());
         EXPECT_TRUE(frameworkConfig.setConnectionSystem(EConnectionSystem::TCP));
         EXPECT_EQ(EConnectionProtocol::TCP, frameworkConfig.impl().getUsedProtocol());
     }
@@ -209,4 +212,36 @@ namespace ramses::internal
         EXPECT_EQ(std::chrono::milliseconds(250), frameworkConfig.impl().m_tcpConfig.getAliveInterval());
         EXPECT_EQ(std::chrono::milliseconds(9000), frameworkConfig.impl().m_tcpConfig.getAliveTimeout());
     }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetTCPSendCoalescingSize)
+    {
+        EXPECT_EQ(256u * 1024u, frameworkConfig.impl().m_tcpConfig.getSendCoalescingSize());
+        frameworkConfig.setConnectionSendCoalescingSize(0u);
+        EXPECT_EQ(0u, frameworkConfig.impl().m_tcpConfig.getSendCoalescingSize());
+        frameworkConfig.setConnectionSendCoalescingSize(1024u);
+        EXPECT_EQ(1024u, frameworkConfig.impl().m_tcpConfig.getSendCoalescingSize());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetLocalConnectionDirectory)
+    {
+        EXPECT_EQ("", frameworkConfig.impl().m_tcpConfig.getLocalSocketDirectory());
+        frameworkConfig.setLocalConnectionDirectory("/run/ramses-test");
+        EXPECT_EQ("/run/ramses-test", frameworkConfig.impl().m_tcpConfig.getLocalSocketDirectory());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetResourceProcessingThreadCount)
+    {
+        EXPECT_EQ(ResourceCompressionThreadPool::GetDefaultWorkerCount(), frameworkConfig.impl().getResourceProcessingThreadCount());
+        EXPECT_TRUE(frameworkConfig.setResourceProcessingThreadCount(0u));
+        EXPECT_EQ(0u, frameworkConfig.impl().getResourceProcessingThreadCount());
+        EXPECT_TRUE(frameworkConfig.setResourceProcessingThreadCount(8u));
+        EXPECT_EQ(8u, frameworkConfig.impl().getResourceProcessingThreadCount());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, FailsToSetTooManyResourceProcessingThreads)
+    {
+        EXPECT_TRUE(frameworkConfig.setResourceProcessingThreadCount(2u));
+        EXPECT_FALSE(frameworkConfig.setResourceProcessingThreadCount(RamsesFrameworkConfigImpl::MaxResourceProcessingThreadCount + 1u));
+        EXPECT_EQ(2u, frameworkConfig.impl().getResourceProcessingThreadCount());
+    }
 }
@@ -59,6 +59,8 @@ namespace ramses::internal
         EXPECT_THROW(cli.parse(std::vector<std::string>{"--connection"}), CLI::ParseError);
         cli.parse(std::vector<std::string>{"--connection=off"});
         EXPECT_EQ(EConnectionProtocol::Off, config.impl().getUsedProtocol());
+        cli.parse(std::vector<std::string>{"--connection=local"});
+        EXPECT_EQ(EConnectionProtocol::Local, config.impl().getUsedProtocol());
         cli.parse(std::vector<std::string>{"--connection=tcp"});
         EXPECT_EQ(EConnectionProtocol::TCP, config.impl().getUsedProtocol());
     }
@@ -123,6 +125,29 @@ namespace ramses::internal
         EXPECT_EQ(std::chrono::milliseconds(5000u), config.impl().m_tcpConfig.getAliveTimeout());
     }
 
+    TEST_F(ARamsesFrameworkConfig, cliTcpSendCoalescing)
+    {
+        EXPECT_EQ(256u * 1024u, config.impl().m_tcpConfig.getSendCoalescingSize());
+        EXPECT_THROW(cli.parse(std::vector<std::string>{"--tcp-send-coalescing"}), CLI::ParseError);
+        cli.parse(std::vector<std::string>{"--tcp-send-coalescing=0"});
+        EXPECT_EQ(0u, config.impl().m_tcpConfig.getSendCoalescingSize());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, cliLocalDir)
+    {
+        EXPECT_EQ("", config.impl().m_tcpConfig.getLocalSocketDirectory());
+        EXPECT_THROW(cli.parse(std::vector<std::string>{"--local-dir"}), CLI::ParseError);
+        cli.parse(std::vector<std::string>{"--local-dir=/run/ramses-test"});
+        EXPECT_EQ("/run/ramses-test", config.impl().m_tcpConfig.getLocalSocketDirectory());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, cliResourceThreads)
+    {
+        EXPECT_THROW(cli.parse(std::vector<std::string>{"--resource-threads"}), CLI::ParseError);
+        cli.parse(std::vector<std::string>{"--resource-threads=3"});
+        EXPECT_EQ(3u, config.impl().getResourceProcessingThreadCount());
+    }
+
     TEST_F(ARamsesFrameworkConfig, cliPeriodicLogTimeout)
     {
         EXPECT_EQ(2u, config.impl().periodicLogTimeout);
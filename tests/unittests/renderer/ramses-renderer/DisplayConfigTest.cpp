@@ -368,6 +368,27 @@ namespace ramses::internal
         EXPECT_FALSE(config.impl().getInternalDisplayConfig().isAsyncEffectUploadEnabled());
     }
 
+    TEST_F(ADisplayConfig, setAsyncResourceUploadEnabled)
+    {
+        EXPECT_FALSE(config.impl().getInternalDisplayConfig().isAsyncResourceUploadEnabled());
+        EXPECT_TRUE(config.setAsyncResourceUploadEnabled(true));
+        EXPECT_TRUE(config.impl().getInternalDisplayConfig().isAsyncResourceUploadEnabled());
+    }
+
+    TEST_F(ADisplayConfig, setAsyncReadPixelsEnabled)
+    {
+        EXPECT_FALSE(config.impl().getInternalDisplayConfig().isAsyncReadPixelsEnabled());
+        EXPECT_TRUE(config.setAsyncReadPixelsEnabled(true));
+        EXPECT_TRUE(config.impl().getInternalDisplayConfig().isAsyncReadPixelsEnabled());
+    }
+
+    TEST_F(ADisplayConfig, setRenderCommandRecordingEnabled)
+    {
+        EXPECT_FALSE(config.impl().getInternalDisplayConfig().isRenderCommandRecordingEnabled());
+        EXPECT_TRUE(config.setRenderCommandRecordingEnabled(true));
+        EXPECT_TRUE(config.impl().getInternalDisplayConfig().isRenderCommandRecordingEnabled());
+    }
+
     TEST_F(ADisplayConfig, canSetEmbeddedCompositingSocketGroup)
     {
         config.setWaylandEmbeddedCompositingSocketGroup("permissionGroup");
@@ -102,4 +102,16 @@ namespace ramses::internal
         EXPECT_TRUE(config.setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds(1234)));
         EXPECT_EQ(std::chrono::milliseconds(1234), config.getRenderThreadLoopTimingReportingPeriod());
     }
+
+    TEST(ARendererConfig, setsAndGetsSceneUpdateWorkerCount)
+    {
+        ramses::RendererConfig config;
+        EXPECT_EQ(0u, config.getSceneUpdateWorkerCount());
+        EXPECT_TRUE(config.setSceneUpdateWorkerCount(4u));
+        EXPECT_EQ(4u, config.getSceneUpdateWorkerCount());
+        EXPECT_EQ(4u, config.impl().getInternalRendererConfig().getSceneUpdateWorkerCount());
+
+        EXPECT_FALSE(config.setSceneUpdateWorkerCount(33u));
+        EXPECT_EQ(4u, config.getSceneUpdateWorkerCount());
+    }
 }
@@ -9,6 +9,8 @@
 
 #include "internal/RendererLib/AsyncEffectUploader.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include <array>
 #include "PlatformMock.h"
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
 
@@ -125,6 +127,27 @@ namespace ramses::internal
             expectShaderUploadingResult(effectsToUpload);
         }
 
+        DataGpuResources syncResourcesUntilUploaded(const DataRawResources& resourcesToUpload, size_t expectedCount)
+        {
+            constexpr std::chrono::seconds timeoutTime{ 2u };
+            constexpr std::chrono::milliseconds sleepTime{ 5u };
+
+            DataGpuResources result;
+            asyncEffectUploader.syncResources(resourcesToUpload, result);
+            EXPECT_TRUE(result.empty());
+
+            const auto startTime = std::chrono::steady_clock::now();
+            while (result.size() < expectedCount && timeoutTime > (std::chrono::steady_clock::now() - startTime))
+            {
+                std::this_thread::sleep_for(sleepTime);
+                DataGpuResources uploaded;
+                asyncEffectUploader.syncResources({}, uploaded);
+                std::move(uploaded.begin(), uploaded.end(), std::back_inserter(result));
+            }
+
+            return result;
+        }
+
         PlatformStrictMock platformMock;
         StrictMock<ThreadAliveNotifierMock> notifier;
         AsyncEffectUploader asyncEffectUploader;
@@ -315,4 +338,63 @@ namespace ramses::internal
         const auto maxDurationShaderUpload = nonTrivialTime * (effectCount - 1u);
         EXPECT_TRUE(durationDestroyCallBlocked < maxDurationShaderUpload);
     }
+
+    TEST_F(AnAsyncEffectUploader, UploadsDataResourcesAndHandsThemOverAfterFenceWasSignaled)
+    {
+        createResourceUploadingRenderBackend();
+
+        const std::array<float, 3u> vertData{ 1.f, 2.f, 3.f };
+        const std::array<uint16_t, 3u> indexData{ 0u, 1u, 2u };
+        const ArrayResource vertArray(EResourceType::VertexArray, 3u, EDataType::Float, vertData.data(), {});
+        const ArrayResource indexArray(EResourceType::IndexArray, 3u, EDataType::UInt16, indexData.data(), {});
+
+        auto& deviceMock = platformMock.resourceUploadRenderBackendMock.deviceMock;
+        {
+            InSequence s;
+            EXPECT_CALL(deviceMock, allocateVertexBuffer(12u)).WillOnce(Return(DeviceMock::FakeVertexBufferDeviceHandle));
+            EXPECT_CALL(deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, _, 12u));
+            EXPECT_CALL(deviceMock, allocateIndexBuffer(EDataType::UInt16, 6u)).WillOnce(Return(DeviceMock::FakeIndexBufferDeviceHandle));
+            EXPECT_CALL(deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, _, 6u));
+            EXPECT_CALL(deviceMock, insertFenceAndWait()).WillOnce(Return(true));
+            EXPECT_CALL(deviceMock, releaseResource(DeviceMock::FakeVertexBufferDeviceHandle)).WillOnce(Return(ByMove(std::make_unique<const GPUResource>(1u, 12u))));
+            EXPECT_CALL(deviceMock, releaseResource(DeviceMock::FakeIndexBufferDeviceHandle)).WillOnce(Return(ByMove(std::make_unique<const GPUResource>(2u, 6u))));
+        }
+
+        const auto uploaded = syncResourcesUntilUploaded({ &vertArray, &indexArray }, 2u);
+        ASSERT_EQ(2u, uploaded.size());
+        EXPECT_EQ(vertArray.getHash(), uploaded[0].hash);
+        ASSERT_TRUE(uploaded[0].gpuResource);
+        EXPECT_EQ(1u, uploaded[0].gpuResource->getGPUAddress());
+        EXPECT_EQ(12u, uploaded[0].vramSize);
+        EXPECT_EQ(indexArray.getHash(), uploaded[1].hash);
+        ASSERT_TRUE(uploaded[1].gpuResource);
+        EXPECT_EQ(2u, uploaded[1].gpuResource->getGPUAddress());
+        EXPECT_EQ(6u, uploaded[1].vramSize);
+
+        destroyResourceUploadingRenderBackend();
+    }
+
+    TEST_F(AnAsyncEffectUploader, ReportsDataResourceAsFailedAndDeletesItIfWaitingForFenceFails)
+    {
+        createResourceUploadingRenderBackend();
+
+        const std::array<float, 3u> vertData{ 1.f, 2.f, 3.f };
+        const ArrayResource vertArray(EResourceType::VertexArray, 3u, EDataType::Float, vertData.data(), {});
+
+        auto& deviceMock = platformMock.resourceUploadRenderBackendMock.deviceMock;
+        {
+            InSequence s;
+            EXPECT_CALL(deviceMock, allocateVertexBuffer(12u)).WillOnce(Return(DeviceMock::FakeVertexBufferDeviceHandle));
+            EXPECT_CALL(deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, _, 12u));
+            EXPECT_CALL(deviceMock, insertFenceAndWait()).WillOnce(Return(false));
+            EXPECT_CALL(deviceMock, deleteVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle));
+        }
+
+        const auto uploaded = syncResourcesUntilUploaded({ &vertArray }, 1u);
+        ASSERT_EQ(1u, uploaded.size());
+        EXPECT_EQ(vertArray.getHash(), uploaded[0].hash);
+        EXPECT_FALSE(uploaded[0].gpuResource);
+
+        destroyResourceUploadingRenderBackend();
+    }
 }
@@ -34,6 +34,9 @@ namespace ramses::internal
         EXPECT_EQ("", m_config.getWaylandDisplay());
         EXPECT_EQ(ramses::EDepthBufferType::DepthStencil, m_config.getDepthStencilBufferType());
         EXPECT_TRUE(m_config.isAsyncEffectUploadEnabled());
+        EXPECT_FALSE(m_config.isAsyncResourceUploadEnabled());
+        EXPECT_FALSE(m_config.isAsyncReadPixelsEnabled());
+        EXPECT_FALSE(m_config.isRenderCommandRecordingEnabled());
         EXPECT_EQ(std::string(""), m_config.getWaylandSocketEmbedded());
         EXPECT_EQ(std::string(""), m_config.getWaylandSocketEmbeddedGroup());
         EXPECT_EQ(-1, m_config.getWaylandSocketEmbeddedFD());
@@ -95,6 +98,15 @@ namespace ramses::internal
         m_config.setAsyncEffectUploadEnabled(false);
         EXPECT_FALSE(m_config.isAsyncEffectUploadEnabled());
 
+        m_config.setAsyncResourceUploadEnabled(true);
+        EXPECT_TRUE(m_config.isAsyncResourceUploadEnabled());
+
+        m_config.setAsyncReadPixelsEnabled(true);
+        EXPECT_TRUE(m_config.isAsyncReadPixelsEnabled());
+
+        m_config.setRenderCommandRecordingEnabled(true);
+        EXPECT_TRUE(m_config.isRenderCommandRecordingEnabled());
+
         m_config.setWaylandEmbeddedCompositingSocketName("wayland-11");
         EXPECT_EQ(std::string("wayland-11"), m_config.getWaylandSocketEmbedded());
 
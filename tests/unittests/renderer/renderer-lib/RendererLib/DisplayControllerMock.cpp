@@ -20,6 +20,7 @@ namespace ramses::internal {
         ON_CALL(*this, getDisplayWidth()).WillByDefault(Return(WindowMock::FakeWidth));
         ON_CALL(*this, getDisplayHeight()).WillByDefault(Return(WindowMock::FakeHeight));
         ON_CALL(*this, renderScene(_, _, _)).WillByDefault(Return(SceneRenderExecutionIterator()));
+        ON_CALL(*this, getUniformCache()).WillByDefault(ReturnRef(m_uniformCache));
     }
 
     DisplayControllerMock::~DisplayControllerMock() = default;
@@ -29,13 +29,21 @@ namespace ramses::internal{
         MOCK_METHOD(void, swapBuffers, (), (override));
         MOCK_METHOD(void, clearBuffer, (DeviceResourceHandle, ClearFlags clearFlags, const glm::vec4&), (override));
         MOCK_METHOD(SceneRenderExecutionIterator, renderScene, (const RendererCachedScene&, RenderingContext&, const FrameTimer*), (override));
+        MOCK_METHOD(void, recordScene, (const RendererCachedScene&, RenderingContext&, RenderCommandList&), (const, override));
+        MOCK_METHOD(void, executeCommandList, (const RenderCommandList&), (override));
         MOCK_METHOD(DeviceResourceHandle, getDisplayBuffer, (), (const, override));
         MOCK_METHOD(void, readPixels, (DeviceResourceHandle framebufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut), (override));
+        MOCK_METHOD(DeviceResourceHandle, readPixelsAsync, (DeviceResourceHandle framebufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height), (override));
+        MOCK_METHOD(bool, getReadPixelsAsyncResult, (DeviceResourceHandle readback, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut), (override));
+        MOCK_METHOD(void, discardReadPixelsAsync, (DeviceResourceHandle readback), (override));
         MOCK_METHOD(uint32_t, getDisplayWidth, (), (const, override));
         MOCK_METHOD(uint32_t, getDisplayHeight, (), (const, override));
         MOCK_METHOD(IRenderBackend&, getRenderBackend, (), (const, override));
         MOCK_METHOD(IEmbeddedCompositingManager&, getEmbeddedCompositingManager, (), (override));
         MOCK_METHOD(void, validateRenderingStatusHealthy, (), (const, override));
+        MOCK_METHOD(ProgramUniformCache&, getUniformCache, (), (override));
+
+        ProgramUniformCache m_uniformCache;
     };
 }
 
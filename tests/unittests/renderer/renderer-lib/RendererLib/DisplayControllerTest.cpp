@@ -167,4 +167,42 @@ namespace ramses::internal
 
         DestroyDisplayController(displayController);
     }
+
+    TEST_F(ADisplayController, readsPixelsAsyncFromOffscreenBuffer)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        const uint32_t width = 2u;
+        const uint32_t height = 3u;
+        const DeviceResourceHandle obRenderTargetDeviceHandle{ 7799u };
+        const DeviceResourceHandle readback{ 1u };
+
+        InSequence seq;
+        EXPECT_CALL(m_renderBackend.deviceMock, activateRenderTarget(obRenderTargetDeviceHandle));
+        EXPECT_CALL(m_renderBackend.deviceMock, readPixelsAsync(1u, 2u, width, height)).WillOnce(Return(readback));
+        EXPECT_EQ(readback, displayController.readPixelsAsync(obRenderTargetDeviceHandle, 1u, 2u, width, height));
+
+        std::vector<uint8_t> pixels;
+        EXPECT_CALL(m_renderBackend.deviceMock, isReadPixelsAsyncFinished(readback)).WillOnce(Return(false));
+        EXPECT_FALSE(displayController.getReadPixelsAsyncResult(readback, width, height, pixels));
+        EXPECT_TRUE(pixels.empty());
+
+        EXPECT_CALL(m_renderBackend.deviceMock, isReadPixelsAsyncFinished(readback)).WillOnce(Return(true));
+        EXPECT_CALL(m_renderBackend.deviceMock, getReadPixelsAsyncResult(readback, NotNull()));
+        EXPECT_TRUE(displayController.getReadPixelsAsyncResult(readback, width, height, pixels));
+        EXPECT_EQ(width * height * 4u, pixels.size());
+
+        DestroyDisplayController(displayController);
+    }
+
+    TEST_F(ADisplayController, discardsAsyncReadPixels)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        const DeviceResourceHandle readback{ 1u };
+        EXPECT_CALL(m_renderBackend.deviceMock, getReadPixelsAsyncResult(readback, nullptr));
+        displayController.discardReadPixelsAsync(readback);
+
+        DestroyDisplayController(displayController);
+    }
 }
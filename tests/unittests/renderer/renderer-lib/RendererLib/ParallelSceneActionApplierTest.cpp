@@ -0,0 +1,109 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/RendererLib/ParallelSceneActionApplier.h"
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+
+namespace ramses::internal
+{
+    class AParallelSceneActionApplier : public ::testing::Test
+    {
+    protected:
+        AParallelSceneActionApplier()
+        {
+            creator.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F }, DataFieldInfo{ EDataType::Float } }, ResourceContentHash::Invalid(), layout);
+        }
+
+        void setValues(DataInstanceHandle instance, float value)
+        {
+            const glm::vec4 vec{ value };
+            creator.setDataVector4fArray(instance, DataFieldHandle{ 0u }, 1u, &vec);
+            creator.setDataFloatArray(instance, DataFieldHandle{ 1u }, 1u, &value);
+        }
+
+        void expectValues(DataInstanceHandle instance, float value) const
+        {
+            EXPECT_EQ(glm::vec4{ value }, scene.getDataSingleVector4f(instance, DataFieldHandle{ 0u }));
+            EXPECT_FLOAT_EQ(value, scene.getDataSingleFloat(instance, DataFieldHandle{ 1u }));
+        }
+
+        static constexpr uint32_t InstanceCount = ParallelSceneActionApplier::MinDataValueActionsToApplyInParallel;
+        const DataLayoutHandle layout{ 0u };
+
+        SceneUpdateThreadPool threadPool{ 3u };
+        ParallelSceneActionApplier applier{ threadPool };
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator{ actions };
+        Scene scene;
+    };
+
+    TEST_F(AParallelSceneActionApplier, classifiesOnlyDataArraySettersAsDataValueActions)
+    {
+        EXPECT_TRUE(ParallelSceneActionApplier::IsDataValueAction(ESceneActionId::SetDataFloatArray));
+        EXPECT_TRUE(ParallelSceneActionApplier::IsDataValueAction(ESceneActionId::SetDataMatrix44fArray));
+        EXPECT_FALSE(ParallelSceneActionApplier::IsDataValueAction(ESceneActionId::SetDataResource));
+        EXPECT_FALSE(ParallelSceneActionApplier::IsDataValueAction(ESceneActionId::SetDataReference));
+        EXPECT_FALSE(ParallelSceneActionApplier::IsDataValueAction(ESceneActionId::AllocateDataInstance));
+
+        EXPECT_TRUE(ParallelSceneActionApplier::IsIndependentOfDataValues(ESceneActionId::AllocateDataInstance));
+        EXPECT_TRUE(ParallelSceneActionApplier::IsIndependentOfDataValues(ESceneActionId::SetTranslation));
+        EXPECT_FALSE(ParallelSceneActionApplier::IsIndependentOfDataValues(ESceneActionId::ReleaseDataInstance));
+        EXPECT_FALSE(ParallelSceneActionApplier::IsIndependentOfDataValues(ESceneActionId::AllocateDataSlot));
+        EXPECT_FALSE(ParallelSceneActionApplier::IsIndependentOfDataValues(ESceneActionId::AllocateCamera));
+    }
+
+    TEST_F(AParallelSceneActionApplier, appliesAllActionsOfLargeFlush)
+    {
+        for (uint32_t i = 0u; i < InstanceCount; ++i)
+        {
+            creator.allocateDataInstance(layout, DataInstanceHandle{ i });
+            setValues(DataInstanceHandle{ i }, static_cast<float>(i));
+            creator.allocateNode(0u, NodeHandle{ i });
+        }
+        applier.applyActionsOnScene(scene, actions);
+
+        EXPECT_EQ(InstanceCount, scene.getNodeCount());
+        for (uint32_t i = 0u; i < InstanceCount; ++i)
+            expectValues(DataInstanceHandle{ i }, static_cast<float>(i));
+    }
+
+    TEST_F(AParallelSceneActionApplier, keepsOrderOfValuesSetToSameDataInstance)
+    {
+        for (uint32_t i = 0u; i < InstanceCount; ++i)
+        {
+            creator.allocateDataInstance(layout, DataInstanceHandle{ i });
+            setValues(DataInstanceHandle{ i }, 1.f);
+        }
+        for (uint32_t i = 0u; i < InstanceCount; ++i)
+            setValues(DataInstanceHandle{ i }, static_cast<float>(i));
+        applier.applyActionsOnScene(scene, actions);
+
+        for (uint32_t i = 0u; i < InstanceCount; ++i)
+            expectValues(DataInstanceHandle{ i }, static_cast<float>(i));
+    }
+
+    TEST_F(AParallelSceneActionApplier, appliesCollectedValuesBeforeDataInstanceIsReleasedAndReallocated)
+    {
+        for (uint32_t i = 0u; i < InstanceCount; ++i)
+        {
+            creator.allocateDataInstance(layout, DataInstanceHandle{ i });
+            setValues(DataInstanceHandle{ i }, static_cast<float>(i));
+        }
+        creator.releaseDataInstance(DataInstanceHandle{ 0u });
+        creator.allocateDataInstance(layout, DataInstanceHandle{ 0u });
+        setValues(DataInstanceHandle{ 0u }, 42.f);
+        applier.applyActionsOnScene(scene, actions);
+
+        expectValues(DataInstanceHandle{ 0u }, 42.f);
+        for (uint32_t i = 1u; i < InstanceCount; ++i)
+            expectValues(DataInstanceHandle{ i }, static_cast<float>(i));
+    }
+}
@@ -0,0 +1,151 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/RenderCommandRecorder.h"
+#include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
+#include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
+#include "DeviceMock.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    using namespace testing;
+
+    class ARenderCommandList : public ::testing::Test
+    {
+    protected:
+        RenderCommandList commandList;
+        RenderCommandRecorder recorder{ commandList };
+        StrictMock<DeviceMock> device;
+    };
+
+    TEST_F(ARenderCommandList, isEmptyInitially)
+    {
+        EXPECT_TRUE(commandList.empty());
+        EXPECT_EQ(0u, commandList.getCommandCount());
+        EXPECT_EQ(0u, commandList.getDataSize());
+
+        // nothing is replayed
+        commandList.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, replaysRecordedStatesAndDrawCallsInOrder)
+    {
+        const RenderState::ScissorRegion scissorRegion{ 1, 2, 3u, 4u };
+        recorder.activateRenderTarget(DeviceResourceHandle(1u));
+        recorder.setViewport(1, 2, 3u, 4u);
+        recorder.colorMask(true, false, true, false);
+        recorder.clearColor({ 0.1f, 0.2f, 0.3f, 0.4f });
+        recorder.clear(EClearFlag::Color | EClearFlag::Depth);
+        recorder.scissorTest(EScissorTest::Enabled, scissorRegion);
+        recorder.blendFactors(EBlendFactor::One, EBlendFactor::Zero, EBlendFactor::SrcAlpha, EBlendFactor::DstAlpha);
+        recorder.stencilFunc(EStencilFunc::Equal, 2u, 0xf0);
+        recorder.activateShader(DeviceResourceHandle(2u));
+        recorder.activateVertexArray(DeviceResourceHandle(3u));
+        recorder.activateTexture(DeviceResourceHandle(4u), DataFieldHandle(5u));
+        recorder.drawIndexedTriangles(6, 7, 8u);
+        recorder.drawTriangles(9, 10, 11u);
+        recorder.discardDepthStencil();
+        EXPECT_EQ(14u, commandList.getCommandCount());
+
+        InSequence seq;
+        EXPECT_CALL(device, activateRenderTarget(DeviceResourceHandle(1u)));
+        EXPECT_CALL(device, setViewport(1, 2, 3u, 4u));
+        EXPECT_CALL(device, colorMask(true, false, true, false));
+        EXPECT_CALL(device, clearColor(glm::vec4{ 0.1f, 0.2f, 0.3f, 0.4f }));
+        EXPECT_CALL(device, clear(ClearFlags(EClearFlag::Color | EClearFlag::Depth)));
+        EXPECT_CALL(device, scissorTest(EScissorTest::Enabled, scissorRegion));
+        EXPECT_CALL(device, blendFactors(EBlendFactor::One, EBlendFactor::Zero, EBlendFactor::SrcAlpha, EBlendFactor::DstAlpha));
+        EXPECT_CALL(device, stencilFunc(EStencilFunc::Equal, 2u, 0xf0));
+        EXPECT_CALL(device, activateShader(DeviceResourceHandle(2u)));
+        EXPECT_CALL(device, activateVertexArray(DeviceResourceHandle(3u)));
+        EXPECT_CALL(device, activateTexture(DeviceResourceHandle(4u), DataFieldHandle(5u)));
+        EXPECT_CALL(device, drawIndexedTriangles(6, 7, 8u));
+        EXPECT_CALL(device, drawTriangles(9, 10, 11u));
+        EXPECT_CALL(device, discardDepthStencil());
+        commandList.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, copiesUniformValuesSoThatSourceCanChangeAfterRecording)
+    {
+        std::array<float, 3> floats{ 1.f, 2.f, 3.f };
+        glm::mat4 matrix{ 5.f };
+        std::array<bool, 1> flag{ true };
+        recorder.setConstant(DataFieldHandle(1u), 3u, floats.data());
+        recorder.setConstant(DataFieldHandle(2u), 1u, flag.data());
+        // matrix follows a bool, must still be replayed properly aligned
+        recorder.setConstant(DataFieldHandle(3u), 1u, &matrix);
+
+        floats = { 0.f, 0.f, 0.f };
+        matrix = glm::mat4{ 0.f };
+        flag[0] = false;
+
+        InSequence seq;
+        EXPECT_CALL(device, setConstant(DataFieldHandle(1u), 3u, Matcher<const float*>(_))).WillOnce(Invoke([](auto, auto, const float* values) {
+            EXPECT_FLOAT_EQ(1.f, values[0]);
+            EXPECT_FLOAT_EQ(2.f, values[1]);
+            EXPECT_FLOAT_EQ(3.f, values[2]);
+            return true;
+        }));
+        EXPECT_CALL(device, setConstant(DataFieldHandle(2u), 1u, Matcher<const bool*>(_))).WillOnce(Invoke([](auto, auto, const bool* values) {
+            EXPECT_TRUE(values[0]);
+            return true;
+        }));
+        EXPECT_CALL(device, setConstant(DataFieldHandle(3u), 1u, Matcher<const glm::mat4*>(_))).WillOnce(Invoke([](auto, auto, const glm::mat4* values) {
+            EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(values) % alignof(glm::mat4)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) checking alignment
+            EXPECT_EQ(glm::mat4{ 5.f }, values[0]);
+            return true;
+        }));
+        commandList.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, replaysBlitAndSamplerCommands)
+    {
+        const PixelRectangle srcRect{ 1u, 2u, 3, 4 };
+        const PixelRectangle dstRect{ 5u, 6u, 7, 8 };
+        TextureSamplerStates samplerStates{ ETextureAddressMode::Clamp, ETextureAddressMode::Repeat, ETextureAddressMode::Mirror, ETextureSamplingMethod::Linear, ETextureSamplingMethod::Nearest, 4u };
+        recorder.blitRenderTargets(DeviceResourceHandle(1u), DeviceResourceHandle(2u), srcRect, dstRect, true);
+        recorder.activateTextureSamplerObject(samplerStates, DataFieldHandle(3u));
+
+        InSequence seq;
+        EXPECT_CALL(device, blitRenderTargets(DeviceResourceHandle(1u), DeviceResourceHandle(2u), _, _, true)).WillOnce(Invoke([](auto, auto, const PixelRectangle& src, const PixelRectangle& dst, auto) {
+            EXPECT_EQ(2u, src.y);
+            EXPECT_EQ(4, src.height);
+            EXPECT_EQ(5u, dst.x);
+            EXPECT_EQ(7, dst.width);
+        }));
+        EXPECT_CALL(device, activateTextureSamplerObject(_, DataFieldHandle(3u))).WillOnce(Invoke([](const TextureSamplerStates& states, auto) {
+            EXPECT_EQ(ETextureAddressMode::Repeat, states.m_addressModeV);
+            EXPECT_EQ(ETextureSamplingMethod::Nearest, states.m_magSamplingMode);
+            EXPECT_EQ(4u, states.m_anisotropyLevel);
+        }));
+        commandList.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, canBeReplayedRepeatedly)
+    {
+        recorder.drawTriangles(1, 2, 3u);
+
+        EXPECT_CALL(device, drawTriangles(1, 2, 3u)).Times(2u);
+        commandList.replay(device);
+        commandList.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, isEmptyAfterClear)
+    {
+        recorder.drawTriangles(1, 2, 3u);
+        EXPECT_FALSE(commandList.empty());
+        EXPECT_GT(commandList.getDataSize(), 0u);
+
+        commandList.clear();
+        EXPECT_TRUE(commandList.empty());
+        EXPECT_EQ(0u, commandList.getDataSize());
+        commandList.replay(device);
+    }
+}
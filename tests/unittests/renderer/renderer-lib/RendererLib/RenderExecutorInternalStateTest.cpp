@@ -186,6 +186,7 @@ namespace ramses::internal
         NiceMock<ResourceDeviceHandleAccessorMock> resourceAccessor;
         m_scene.updateRenderablesAndResourceCache(resourceAccessor);
         m_scene.updateRenderableWorldMatrices();
+        m_scene.updateRenderableVisibility();
 
         m_executorState.setRenderable(renderable);
 
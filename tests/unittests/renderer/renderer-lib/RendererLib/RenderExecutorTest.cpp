@@ -14,6 +14,11 @@
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/SceneGraph/SceneUtils/DataLayoutCreationHelper.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/LoggingDevice.h"
+#include "internal/RendererLib/RendererLogContext.h"
+#include "internal/RendererLib/ProgramUniformCache.h"
+#include "internal/RendererLib/RenderCommandList.h"
+#include "internal/RendererLib/RenderCommandRecorder.h"
 #include "SceneAllocateHelper.h"
 #include "internal/PlatformAbstraction/PlatformMath.h"
 #include "internal/Components/EffectUniformTime.h"
@@ -544,6 +549,7 @@ namespace ramses::internal {
             scene.updateRenderableVertexArrays(resourceManager, renderablesWithUpdatedVAOs);
             scene.markVertexArraysClean();
             scene.updateRenderableWorldMatrices();
+            scene.updateRenderableVisibility();
         }
 
         void expectRenderingWithProjection(RenderableHandle renderable, const glm::mat4& projMatrix, const uint32_t instanceCount = 1u)
@@ -1780,4 +1786,107 @@ namespace ramses::internal {
 
         executeScene();
     }
+
+    TEST_F(ARenderExecutor, SkipsUniformValuesAlreadySetOnShaderProgram)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams());
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances = createTestDataInstance();
+        const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+        const RenderableHandle renderable2 = createTestRenderable(dataInstances, group);
+        updateScenes({ renderable1, renderable2 });
+
+        RendererLogContext logContext(ERendererLogLevelFlag_Details);
+        LoggingDevice loggingDevice(device, logContext);
+        ProgramUniformCache uniformCache;
+        const auto renderAndCountLoggedUniformValues = [&]() {
+            const std::string logBefore{ logContext.getStream().c_str() };
+            RenderExecutor executor(loggingDevice, renderContext, nullptr, &uniformCache);
+            std::ignore = executor.executeScene(scene);
+            const std::string log = std::string{ logContext.getStream().c_str() }.substr(logBefore.size());
+            size_t count = 0u;
+            for (auto pos = log.find("] Load "); pos != std::string::npos; pos = log.find("] Load ", pos + 1u))
+                ++count;
+            return count;
+        };
+
+        // 7 value uniforms are set for first renderable, second renderable uses same shader and same values
+        EXPECT_EQ(7u, renderAndCountLoggedUniformValues());
+        // rendering scene again (e.g. in next frame) re-activates shader but values are still held by program
+        EXPECT_EQ(0u, renderAndCountLoggedUniformValues());
+        EXPECT_EQ(7u, uniformCache.getUpdateCounts().numSet);
+        EXPECT_EQ(21u, uniformCache.getUpdateCounts().numSkipped);
+
+        // reading counts does not forget values
+        EXPECT_EQ(0u, renderAndCountLoggedUniformValues());
+        EXPECT_EQ(7u, uniformCache.getUpdateCounts().numSet);
+        EXPECT_EQ(35u, uniformCache.getUpdateCounts().numSkipped);
+    }
+
+    TEST_F(ARenderExecutor, SetsAllUniformValuesAgainAfterShaderProgramWasInvalidated)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams());
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances = createTestDataInstance();
+        const RenderableHandle renderable = createTestRenderable(dataInstances, group);
+        updateScenes({ renderable });
+
+        RendererLogContext logContext(ERendererLogLevelFlag_Details);
+        LoggingDevice loggingDevice(device, logContext);
+        ProgramUniformCache uniformCache;
+        const auto renderAndCountLoggedUniformValues = [&]() {
+            const std::string logBefore{ logContext.getStream().c_str() };
+            RenderExecutor executor(loggingDevice, renderContext, nullptr, &uniformCache);
+            std::ignore = executor.executeScene(scene);
+            const std::string log = std::string{ logContext.getStream().c_str() }.substr(logBefore.size());
+            size_t count = 0u;
+            for (auto pos = log.find("] Load "); pos != std::string::npos; pos = log.find("] Load ", pos + 1u))
+                ++count;
+            return count;
+        };
+
+        EXPECT_EQ(7u, renderAndCountLoggedUniformValues());
+        EXPECT_EQ(0u, renderAndCountLoggedUniformValues());
+
+        // invalidating other program keeps values
+        uniformCache.invalidateProgram(DeviceResourceHandle{ 12345u });
+        EXPECT_EQ(0u, renderAndCountLoggedUniformValues());
+
+        // program was deleted and handle reused by newly uploaded program
+        uniformCache.invalidateProgram(DeviceMock::FakeShaderDeviceHandle);
+        EXPECT_EQ(7u, renderAndCountLoggedUniformValues());
+    }
+
+    TEST_F(ARenderExecutor, ReplayOfRecordedCommandsIssuesSameDeviceCallsAsDirectExecution)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams());
+        const RenderGroupHandle group = createRenderGroup(pass);
+        const DataInstances dataInstances1 = createTestDataInstance();
+        const DataInstances dataInstances2 = createTestDataInstance();
+        const RenderableHandle renderable1 = createTestRenderable(dataInstances1, group);
+        const RenderableHandle renderable2 = createTestRenderable(dataInstances2, group);
+        updateScenes({ renderable1, renderable2 });
+
+        RendererLogContext directLogContext(ERendererLogLevelFlag_Details);
+        LoggingDevice directLoggingDevice(device, directLogContext);
+        RenderingContext directRenderContext = renderContext;
+        RenderExecutor directExecutor(directLoggingDevice, directRenderContext);
+        std::ignore = directExecutor.executeScene(scene);
+
+        RenderCommandList commandList;
+        RenderCommandRecorder recorder(commandList);
+        RenderingContext recordRenderContext = renderContext;
+        RenderExecutor recordingExecutor(recorder, recordRenderContext);
+        std::ignore = recordingExecutor.executeScene(scene);
+        EXPECT_FALSE(commandList.empty());
+
+        // recorded list can be replayed any number of times
+        for (int i = 0; i < 2; ++i)
+        {
+            RendererLogContext replayLogContext(ERendererLogLevelFlag_Details);
+            LoggingDevice replayLoggingDevice(device, replayLogContext);
+            commandList.replay(replayLoggingDevice);
+            EXPECT_STREQ(directLogContext.getStream().c_str(), replayLogContext.getStream().c_str());
+        }
+    }
 }
@@ -10,6 +10,8 @@
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include "glm/gtx/transform.hpp"
+#include <array>
 
 namespace ramses::internal
 {
@@ -34,6 +36,35 @@ namespace ramses::internal
                 EXPECT_EQ(r, orderedRenderables[i++]);
         }
 
+        RenderPassHandle createRenderPassWithOrthographicCamera()
+        {
+            const RenderPassHandle pass = sceneAllocator.allocateRenderPass();
+            const auto dataLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {});
+            const auto dataInstance = sceneAllocator.allocateDataInstance(dataLayout);
+            const auto vpDataRefLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {});
+            const auto frustumPlanesLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector4F} }, {});
+            const auto frustumNearFarLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2F} }, {});
+            const auto frustumPlanes = sceneAllocator.allocateDataInstance(frustumPlanesLayout);
+            const auto frustumNearFar = sceneAllocator.allocateDataInstance(frustumNearFarLayout);
+            scene.setDataReference(dataInstance, Camera::ViewportOffsetField, sceneAllocator.allocateDataInstance(vpDataRefLayout));
+            scene.setDataReference(dataInstance, Camera::ViewportSizeField, sceneAllocator.allocateDataInstance(vpDataRefLayout));
+            scene.setDataReference(dataInstance, Camera::FrustumPlanesField, frustumPlanes);
+            scene.setDataReference(dataInstance, Camera::FrustumNearFarPlanesField, frustumNearFar);
+            scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { -1.f, 1.f, -1.f, 1.f });
+            scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { 1.f, 10.f });
+
+            const CameraHandle camera = sceneAllocator.allocateCamera(ECameraProjectionType::Orthographic, sceneAllocator.allocateNode(), dataInstance);
+            scene.setRenderPassCamera(pass, camera);
+            return pass;
+        }
+
+        TransformHandle setRenderableTranslation(RenderableHandle renderable, const glm::vec3& translation)
+        {
+            const TransformHandle transform = sceneAllocator.allocateTransform(scene.getRenderable(renderable).node);
+            scene.setTranslation(transform, translation);
+            return transform;
+        }
+
         RendererEventCollector rendererEventCollector;
         RendererScenes rendererScenes;
         RendererCachedScene& scene;
@@ -1075,6 +1106,30 @@ namespace ramses::internal
         EXPECT_EQ(expectedWorldMatrix, cachedWorldMatrix);
     }
 
+    TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderableWithBreadthFirstTransformationUpdate)
+    {
+        scene.setTransformationUpdateMode(ETransformationUpdateMode::BreadthFirst);
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = sceneHelper.createRenderable(group);
+        const NodeHandle rendNode = scene.getRenderable(rend).node;
+
+        const NodeHandle transformNode = sceneAllocator.allocateNode();
+        const TransformHandle transform = sceneAllocator.allocateTransform(transformNode);
+
+        scene.addChildToNode(transformNode, rendNode);
+        scene.setTranslation(transform, glm::vec3(1, 2, 3));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatricesWithLinks();
+        EXPECT_FALSE(scene.isMatrixCacheDirty(ETransformationMatrixType_World, transformNode));
+        EXPECT_EQ(glm::translate(glm::vec3(1, 2, 3)), scene.getRenderableWorldMatrix(rend));
+
+        scene.setTranslation(transform, glm::vec3(4, 5, 6));
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(glm::translate(glm::vec3(4, 5, 6)), scene.getRenderableWorldMatrix(rend));
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable_LinksVersionEquivalentToRegularVersionIfNoTransformationLinksInvolved)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1096,6 +1151,223 @@ namespace ramses::internal
         EXPECT_EQ(expectedWorldMatrix, cachedWorldMatrix);
     }
 
+    TEST_F(ARendererCachedScene, doesNotCullRenderablesWithoutBoundingBox)
+    {
+        const RenderPassHandle pass = createRenderPassWithOrthographicCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = sceneHelper.createRenderable(group);
+        setRenderableTranslation(rend, { 100.f, 0.f, -5.f });
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+
+        ASSERT_EQ(1u, scene.getVisibleRenderablesForPass(pass).size());
+        EXPECT_EQ(rend, scene.getVisibleRenderablesForPass(pass)[0]);
+        EXPECT_EQ(0u, scene.getNumCulledRenderables());
+        EXPECT_EQ(1u, scene.getNumVisibleRenderables());
+    }
+
+    TEST_F(ARendererCachedScene, cullsRenderablesWithBoundingBoxOutsideOfCameraFrustum)
+    {
+        const RenderPassHandle pass = createRenderPassWithOrthographicCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rendInside = sceneHelper.createRenderable(group);
+        const RenderableHandle rendOutside = sceneHelper.createRenderable(group);
+        const RenderableHandle rendIntersecting = sceneHelper.createRenderable(group);
+        setRenderableTranslation(rendInside, { 0.f, 0.f, -5.f });
+        const TransformHandle transformOutside = setRenderableTranslation(rendOutside, { 100.f, 0.f, -5.f });
+        setRenderableTranslation(rendIntersecting, { 1.2f, 0.f, -5.f });
+
+        BoundingBox box;
+        box.min = glm::vec3(-0.5f);
+        box.max = glm::vec3(0.5f);
+        scene.setRenderableBoundingBox(rendInside, box);
+        scene.setRenderableBoundingBox(rendOutside, box);
+        scene.setRenderableBoundingBox(rendIntersecting, box);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+
+        const auto& visibleRenderables = scene.getVisibleRenderablesForPass(pass);
+        ASSERT_EQ(2u, visibleRenderables.size());
+        EXPECT_EQ(rendInside, visibleRenderables[0]);
+        EXPECT_EQ(rendIntersecting, visibleRenderables[1]);
+        EXPECT_EQ(1u, scene.getNumCulledRenderables());
+        EXPECT_EQ(2u, scene.getNumVisibleRenderables());
+
+        // moving renderable into frustum makes it visible again
+        scene.setTranslation(transformOutside, { 0.f, 0.5f, -5.f });
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatricesWithLinks();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(3u, scene.getVisibleRenderablesForPass(pass).size());
+        EXPECT_EQ(0u, scene.getNumCulledRenderables());
+        EXPECT_EQ(3u, scene.getNumVisibleRenderables());
+    }
+
+    TEST_F(ARendererCachedScene, cullsWithCameraValuesChangedAfterWorldMatricesUpdate)
+    {
+        const RenderPassHandle pass = createRenderPassWithOrthographicCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = sceneHelper.createRenderable(group);
+        setRenderableTranslation(rend, { 100.f, 0.f, -5.f });
+        BoundingBox box;
+        box.min = glm::vec3(-0.5f);
+        box.max = glm::vec3(0.5f);
+        scene.setRenderableBoundingBox(rend, box);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_TRUE(scene.getVisibleRenderablesForPass(pass).empty());
+
+        // frustum changes between world matrices and visibility update as done by data links resolved in between
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        const Camera& camera = scene.getCamera(scene.getRenderPass(pass).camera);
+        const DataInstanceHandle frustumPlanes = scene.getDataReference(camera.dataInstance, Camera::FrustumPlanesField);
+        scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { 99.f, 101.f, -1.f, 1.f });
+        scene.updateRenderableVisibility();
+        ASSERT_EQ(1u, scene.getVisibleRenderablesForPass(pass).size());
+        EXPECT_EQ(rend, scene.getVisibleRenderablesForPass(pass)[0]);
+        EXPECT_EQ(0u, scene.getNumCulledRenderables());
+    }
+
+    TEST_F(ARendererCachedScene, sortsRenderablesByStatesInStateSortedPassOnly)
+    {
+        const RenderPassHandle pass = createRenderPassWithOrthographicCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(sceneHelper.testGeometryLayout);
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+
+        std::array<RenderableHandle, 4u> renderables;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            const RenderableHandle renderable = sceneAllocator.allocateRenderable(sceneAllocator.allocateNode());
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, sceneAllocator.allocateDataInstance(sceneHelper.testUniformLayout));
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableRenderState(renderable, (i % 2 == 0) ? state1 : state2);
+            scene.addRenderableToRenderGroup(group, renderable, i);
+            renderables[i] = renderable;
+        }
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[1], renderables[2], renderables[3] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(3u, scene.getNumStateSwitches());
+
+        // render order is kept for renderables with equal states
+        scene.setRenderPassStateSorting(pass, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[2], renderables[1], renderables[3] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[2], renderables[1], renderables[3] }), scene.getVisibleRenderablesForPass(pass));
+        EXPECT_EQ(1u, scene.getNumStateSwitches());
+
+        // changing state of renderable updates sorting
+        scene.setRenderableRenderState(renderables[0], state2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[2], renderables[0], renderables[1], renderables[3] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(1u, scene.getNumStateSwitches());
+
+        scene.setRenderPassStateSorting(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[1], renderables[2], renderables[3] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(2u, scene.getNumStateSwitches());
+    }
+
+    TEST_F(ARendererCachedScene, updatesStateSwitchesWhenStateOfRenderableInUnsortedPassChanges)
+    {
+        const RenderPassHandle pass = createRenderPassWithOrthographicCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(sceneHelper.testGeometryLayout);
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+
+        std::array<RenderableHandle, 3u> renderables;
+        for (int32_t i = 0; i < 3; ++i)
+        {
+            const RenderableHandle renderable = sceneAllocator.allocateRenderable(sceneAllocator.allocateNode());
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, sceneAllocator.allocateDataInstance(sceneHelper.testUniformLayout));
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableRenderState(renderable, state1);
+            scene.addRenderableToRenderGroup(group, renderable, i);
+            renderables[i] = renderable;
+        }
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(0u, scene.getNumStateSwitches());
+
+        scene.setRenderableRenderState(renderables[1], state2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[1], renderables[2] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(2u, scene.getNumStateSwitches());
+
+        scene.setRenderableDataInstance(renderables[2], ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(sceneHelper.testGeometryLayout));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(3u, scene.getNumStateSwitches());
+    }
+
+    TEST_F(ARendererCachedScene, updatesStateSortingWhenTextureSamplerOfRenderableChanges)
+    {
+        const RenderPassHandle pass = createRenderPassWithOrthographicCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(sceneHelper.testGeometryLayout);
+        const RenderStateHandle state = sceneAllocator.allocateRenderState();
+        const TextureSamplerHandle sampler1 = sceneHelper.createTextureSampler(MockResourceHash::TextureHash);
+        const TextureSamplerHandle sampler2 = sceneHelper.createTextureSampler(MockResourceHash::TextureHash2);
+
+        std::array<RenderableHandle, 4u> renderables;
+        std::array<DataInstanceHandle, 4u> uniforms;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            const RenderableHandle renderable = sceneAllocator.allocateRenderable(sceneAllocator.allocateNode());
+            uniforms[i] = sceneHelper.createAndAssignUniformDataInstance(renderable, (i % 2 == 0) ? sampler2 : sampler1);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableRenderState(renderable, state);
+            scene.addRenderableToRenderGroup(group, renderable, i);
+            renderables[i] = renderable;
+        }
+
+        scene.setRenderPassStateSorting(pass, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[1], renderables[3], renderables[0], renderables[2] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(1u, scene.getNumStateSwitches());
+
+        // assigning other sampler to renderable updates sorting
+        scene.setDataTextureSamplerHandle(uniforms[0], sceneHelper.samplerField, sampler1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[1], renderables[3], renderables[2] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(1u, scene.getNumStateSwitches());
+
+        // changing content of sampler updates sorting
+        sceneHelper.recreateSamplerWithDifferentContent(sampler2, MockResourceHash::TextureHash);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        scene.updateRenderableVisibility();
+        EXPECT_EQ(RenderableVector({ renderables[0], renderables[1], renderables[2], renderables[3] }), scene.getOrderedRenderablesForPass(pass));
+        EXPECT_EQ(0u, scene.getNumStateSwitches());
+    }
+
     TEST_F(ARendererCachedScene, CanSortPassesWithRenderOrder_RenderPasses)
     {
         const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
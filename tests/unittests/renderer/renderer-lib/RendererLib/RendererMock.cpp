@@ -57,6 +57,7 @@ namespace ramses::internal {
         EXPECT_CALL(*m_displayController, getDisplayBuffer()).Times(AnyNumber());
         EXPECT_CALL(*m_displayController, getRenderBackend()).Times(AnyNumber());
         EXPECT_CALL(*m_displayController, getEmbeddedCompositingManager()).Times(AnyNumber());
+        EXPECT_CALL(*m_displayController, getUniformCache()).Times(AnyNumber());
 
         EXPECT_CALL(m_platform.renderBackendMock.contextMock, disable()).Times(AtMost(1)).WillRepeatedly(Return(true));
         EXPECT_CALL(m_platform.renderBackendMock.contextMock, enable()).Times(AtMost(1)).WillRepeatedly(Return(true));
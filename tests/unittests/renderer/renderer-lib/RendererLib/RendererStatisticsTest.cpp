@@ -49,6 +49,36 @@ namespace ramses::internal
         EXPECT_EQ(3u, stats.getDrawCallsPerFrame());
     }
 
+    TEST_F(ARendererStatistics, tracksUniformUpdatesPerFrame)
+    {
+        stats.trackUniformUpdates(10u, 30u);
+        stats.frameFinished(0u);
+        stats.trackUniformUpdates(20u, 20u);
+        stats.frameFinished(0u);
+        EXPECT_EQ(15u, stats.getUniformsSetPerFrame());
+        EXPECT_EQ(25u, stats.getUniformsSkippedPerFrame());
+        EXPECT_THAT(logOutput(), HasSubstr("numFrames 2, uniforms set/skipped per frame (15/25)"));
+
+        stats.reset();
+        EXPECT_EQ(0u, stats.getUniformsSetPerFrame());
+        EXPECT_EQ(0u, stats.getUniformsSkippedPerFrame());
+    }
+
+    TEST_F(ARendererStatistics, tracksAsyncResourceUploadLatency)
+    {
+        stats.asyncResourceUploaded(std::chrono::microseconds{ 100 });
+        stats.asyncResourceUploaded(std::chrono::microseconds{ 300 });
+        stats.asyncResourceUploaded(std::chrono::microseconds{ 500 });
+        stats.frameFinished(0u);
+        EXPECT_EQ(std::chrono::microseconds{ 300 }, stats.getAsyncResourceUploadLatencyAvg());
+        EXPECT_EQ(std::chrono::microseconds{ 500 }, stats.getAsyncResourceUploadLatencyMax());
+        EXPECT_THAT(logOutput(), HasSubstr("asyncResUploaded 3 latency (100/500/300 us)"));
+
+        stats.reset();
+        EXPECT_EQ(std::chrono::microseconds{ 0 }, stats.getAsyncResourceUploadLatencyAvg());
+        EXPECT_EQ(std::chrono::microseconds{ 0 }, stats.getAsyncResourceUploadLatencyMax());
+    }
+
     TEST_F(ARendererStatistics, tracksFrameCount)
     {
         stats.frameFinished(0u);
@@ -307,6 +337,43 @@ namespace ramses::internal
         EXPECT_THAT(logOutput(), Not(HasSubstr("RSUploaded")));
     }
 
+    TEST_F(ARendererStatistics, tracksRenderablesCulling)
+    {
+        stats.sceneRendered(sceneId1);
+        stats.trackRenderablesCulling(sceneId1, 0u, 10u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("culled/visible")));
+
+        stats.sceneRendered(sceneId1);
+        stats.trackRenderablesCulling(sceneId1, 4u, 6u);
+        stats.sceneRendered(sceneId2);
+        stats.trackRenderablesCulling(sceneId2, 3u, 1u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr("culled/visible per render (2/8)")); //scene1
+        EXPECT_THAT(logOutput(), HasSubstr("culled/visible per render (3/1)")); //scene2
+
+        stats.reset();
+        EXPECT_THAT(logOutput(), Not(HasSubstr("culled/visible")));
+    }
+
+    TEST_F(ARendererStatistics, tracksStateSwitches)
+    {
+        stats.sceneRendered(sceneId1);
+        stats.trackStateSwitches(sceneId1, 0u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("state switches")));
+
+        stats.sceneRendered(sceneId1);
+        stats.trackStateSwitches(sceneId1, 10u);
+        stats.sceneRendered(sceneId1);
+        stats.trackStateSwitches(sceneId1, 2u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr("state switches per render 4"));
+
+        stats.reset();
+        EXPECT_THAT(logOutput(), Not(HasSubstr("state switches")));
+    }
+
     TEST_F(ARendererStatistics, tracksShaderCompilationAndTimes)
     {
         stats.shaderCompiled(std::chrono::microseconds(2u), "some effect", SceneId(123));
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/RendererConfig.h"
+#include "internal/RendererLib/DisplayConfig.h"
 #include "RenderBackendMock.h"
 #include "PlatformMock.h"
 #include "internal/RendererLib/RenderingContext.h"
@@ -51,10 +52,10 @@ namespace ramses::internal
                 expirationMonitor.onDestroyed(sceneIt.key);
         }
 
-        void createDisplayController()
+        void createDisplayController(const DisplayConfig& displayConfig = {})
         {
             ASSERT_FALSE(renderer.hasDisplayController());
-            renderer.createDisplayContext({});
+            renderer.createDisplayContext(displayConfig);
         }
 
         void destroyDisplayController()
@@ -979,6 +980,183 @@ namespace ramses::internal
         EXPECT_EQ(0u, screenshots.size());
     }
 
+    TEST_P(ARenderer, deliversAsyncScreenshotWhenReadbackFinished)
+    {
+        DisplayConfig displayConfig;
+        displayConfig.setAsyncReadPixelsEnabled(true);
+        createDisplayController(displayConfig);
+
+        scheduleScreenshot(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u);
+
+        const DeviceResourceHandle readback{ 1u };
+        EXPECT_CALL(*renderer.m_displayController, readPixelsAsync(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u)).WillOnce(Return(readback));
+        EXPECT_CALL(*renderer.m_displayController, readPixels(_, _, _, _, _, _)).Times(0);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // GPU not finished yet
+        EXPECT_CALL(*renderer.m_displayController, getReadPixelsAsyncResult(readback, 100u, 100u, _)).WillOnce(Return(false));
+        auto screenshots = renderer.dispatchProcessedScreenshots();
+        EXPECT_TRUE(screenshots.empty());
+
+        // pending readback is not scheduled again
+        expectFrameBufferRendered(false);
+        doOneRendererLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, getReadPixelsAsyncResult(readback, 100u, 100u, _)).WillOnce(Invoke(
+            [](auto /*unused*/, auto w, auto h, auto& dataOut) {
+                dataOut.resize(w * h * 4);
+                return true;
+            }));
+        screenshots = renderer.dispatchProcessedScreenshots();
+        ASSERT_EQ(1u, screenshots.size());
+        EXPECT_EQ(DisplayControllerMock::FakeFrameBufferHandle, screenshots.front().first);
+        EXPECT_EQ(100u * 100u * 4u, screenshots.front().second.pixelData.size());
+        EXPECT_FALSE(screenshots.front().second.pendingReadback.isValid());
+
+        screenshots = renderer.dispatchProcessedScreenshots();
+        EXPECT_TRUE(screenshots.empty());
+    }
+
+    TEST_P(ARenderer, fallsBackToBlockingScreenshotIfAsyncReadbackNotAvailable)
+    {
+        DisplayConfig displayConfig;
+        displayConfig.setAsyncReadPixelsEnabled(true);
+        createDisplayController(displayConfig);
+
+        scheduleScreenshot(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u);
+
+        EXPECT_CALL(*renderer.m_displayController, readPixelsAsync(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+        expectDisplayControllerReadPixels(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        const auto screenshots = renderer.dispatchProcessedScreenshots();
+        ASSERT_EQ(1u, screenshots.size());
+        EXPECT_EQ(DisplayControllerMock::FakeFrameBufferHandle, screenshots.front().first);
+    }
+
+    TEST_P(ARenderer, discardsPendingAsyncScreenshotWhenOverwrittenOrDisplayDestroyed)
+    {
+        DisplayConfig displayConfig;
+        displayConfig.setAsyncReadPixelsEnabled(true);
+        createDisplayController(displayConfig);
+
+        scheduleScreenshot(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u);
+        EXPECT_CALL(*renderer.m_displayController, readPixelsAsync(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u)).WillOnce(Return(DeviceResourceHandle{ 1u }));
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, discardReadPixelsAsync(DeviceResourceHandle{ 1u }));
+        scheduleScreenshot(DisplayControllerMock::FakeFrameBufferHandle, 10u, 10u, 50u, 50u);
+        EXPECT_CALL(*renderer.m_displayController, readPixelsAsync(DisplayControllerMock::FakeFrameBufferHandle, 10u, 10u, 50u, 50u)).WillOnce(Return(DeviceResourceHandle{ 2u }));
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, discardReadPixelsAsync(DeviceResourceHandle{ 2u }));
+        destroyDisplayController();
+    }
+
+    TEST_P(ARenderer, recordsSceneCommandsOnceAndReplaysThemUntilSceneModified)
+    {
+        DisplayConfig displayConfig;
+        displayConfig.setRenderCommandRecordingEnabled(true);
+        createDisplayController(displayConfig);
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+        assignSceneToDisplayBuffer(sceneId, 0);
+        showScene(sceneId);
+
+        // display buffer is cleared by renderer upfront, recorded commands do not clear it
+        const auto expectSceneRecorded = [&]() {
+            EXPECT_CALL(*renderer.m_displayController, recordScene(Ref(rendererScenes.getScene(sceneId)), _, _))
+                .WillOnce([](const auto& /*unused*/, RenderingContext& renderContext, const auto& /*unused*/) {
+                EXPECT_EQ(DisplayControllerMock::FakeFrameBufferHandle, renderContext.displayBufferDeviceHandle);
+                EXPECT_EQ(ClearFlags(EClearFlag::None), renderContext.displayBufferClearPending);
+                EXPECT_FALSE(renderContext.displayBufferDepthDiscard);
+            });
+        };
+
+        expectSceneRecorded();
+        EXPECT_CALL(*renderer.m_displayController, executeCommandList(_));
+        EXPECT_CALL(*renderer.m_displayController, renderScene(_, _, _)).Times(0);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // buffer re-rendered but scene not modified, recorded commands are executed again
+        EXPECT_CALL(*renderer.m_displayController, recordScene(_, _, _)).Times(0);
+        EXPECT_CALL(*renderer.m_displayController, executeCommandList(_));
+        renderer.markBufferWithSceneForRerender(sceneId);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // modified scene is recorded again
+        renderer.markSceneModified(sceneId);
+        renderer.markBufferWithSceneForRerender(sceneId);
+        expectSceneRecorded();
+        EXPECT_CALL(*renderer.m_displayController, executeCommandList(_));
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+    }
+
+    TEST_P(ARenderer, recordsSceneCommandsAgainWhenRenderedToDifferentBuffer)
+    {
+        DisplayConfig displayConfig;
+        displayConfig.setRenderCommandRecordingEnabled(true);
+        createDisplayController(displayConfig);
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+        const DeviceResourceHandle offscreenBuffer(313u);
+        renderer.registerOffscreenBuffer(offscreenBuffer, 1u, 1u, false);
+        assignSceneToDisplayBuffer(sceneId, 0, offscreenBuffer);
+        showScene(sceneId);
+
+        // last scene in offscreen buffer cleared every frame can discard depth
+        EXPECT_CALL(*renderer.m_displayController, recordScene(Ref(rendererScenes.getScene(sceneId)), _, _))
+            .WillOnce([&](const auto& /*unused*/, RenderingContext& renderContext, const auto& /*unused*/) {
+            EXPECT_EQ(offscreenBuffer, renderContext.displayBufferDeviceHandle);
+            EXPECT_TRUE(renderContext.displayBufferDepthDiscard);
+        });
+        EXPECT_CALL(*renderer.m_displayController, executeCommandList(_));
+        expectOffscreenBufferCleared(offscreenBuffer);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+        assignSceneToDisplayBuffer(sceneId, 0);
+        showScene(sceneId);
+
+        EXPECT_CALL(*renderer.m_displayController, recordScene(Ref(rendererScenes.getScene(sceneId)), _, _))
+            .WillOnce([](const auto& /*unused*/, RenderingContext& renderContext, const auto& /*unused*/) {
+            EXPECT_EQ(DisplayControllerMock::FakeFrameBufferHandle, renderContext.displayBufferDeviceHandle);
+            EXPECT_FALSE(renderContext.displayBufferDepthDiscard);
+        });
+        EXPECT_CALL(*renderer.m_displayController, executeCommandList(_));
+        // offscreen buffer without scene is cleared
+        expectOffscreenBufferCleared(offscreenBuffer);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+        renderer.unregisterOffscreenBuffer(offscreenBuffer);
+    }
+
     TEST_P(ARenderer, takeMultipleScreenshotsOfADisplayOverritesPreviousScreenshot)
     {
         createDisplayController();
@@ -11,6 +11,7 @@
 #include "internal/RendererLib/FrameTimer.h"
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/DisplayConfig.h"
+#include "internal/RendererLib/ProgramUniformCache.h"
 #include "internal/SceneGraph/Resource/ArrayResource.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
 #include "ResourceUploaderMock.h"
@@ -20,6 +21,7 @@
 #include "internal/Components/ResourceDeleterCallingCallback.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
+#include <array>
 
 namespace ramses::internal
 {
@@ -52,7 +54,7 @@ namespace ramses::internal
             , sceneId(66u)
             , uploader(new StrictMock<ResourceUploaderMock>)
             , asyncEffectUploader(platformMock, platformMock.renderBackendMock, notifier, DisplayHandle{ 1 })
-            , rendererResourceUploader(resourceRegistry, std::unique_ptr<IResourceUploader>{ uploader }, platformMock.renderBackendMock, asyncEffectUploader, cfg, frameTimer, stats)
+            , rendererResourceUploader(resourceRegistry, std::unique_ptr<IResourceUploader>{ uploader }, platformMock.renderBackendMock, asyncEffectUploader, cfg, frameTimer, stats, nullptr, &uniformCache)
         {
             InSequence s;
             EXPECT_CALL(platformMock.renderBackendMock.contextMock, disable()).WillOnce(Return(true));
@@ -175,6 +177,7 @@ namespace ramses::internal
         FrameTimer frameTimer;
         RendererStatistics stats;
         NiceMock<ThreadAliveNotifierMock> notifier;
+        ProgramUniformCache uniformCache;
         StrictMock<ResourceUploaderMock>* uploader;
         AsyncEffectUploader asyncEffectUploader;
         ResourceUploadingManager rendererResourceUploader;
@@ -210,6 +213,34 @@ namespace ramses::internal
         }
     };
 
+    class AResourceUploadingManager_AsyncResourceUpload : public AResourceUploadingManager
+    {
+    public:
+        AResourceUploadingManager_AsyncResourceUpload()
+            : AResourceUploadingManager(makeAsyncResourceUploadConfig())
+        {
+        }
+
+        static DisplayConfig makeAsyncResourceUploadConfig()
+        {
+            DisplayConfig cfg;
+            cfg.setAsyncResourceUploadEnabled(true);
+            return cfg;
+        }
+
+        void waitWhileScheduledForUpload(const ResourceContentHash& hash)
+        {
+            constexpr std::chrono::seconds timeoutTime{ 2u };
+            const auto startTime = std::chrono::steady_clock::now();
+            while (resourceRegistry.getResourceStatus(hash) == EResourceStatus::ScheduledForUpload
+                && std::chrono::steady_clock::now() - startTime < timeoutTime)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{ 5u });
+                rendererResourceUploader.uploadAndUnloadPendingResources();
+            }
+        }
+    };
+
     TEST_F(AResourceUploadingManager, hasNothingToUploadUnloadInitially)
     {
         EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
@@ -302,6 +333,26 @@ namespace ramses::internal
         makeResourceUnused(resHash);
     }
 
+    TEST_F(AResourceUploadingManager, forgetsUniformValuesOfShaderProgramWhenUploadingEffect)
+    {
+        // values remembered for deleted program whose device handle gets reused
+        const std::array<float, 1> value{ 1.f };
+        uniformCache.activateProgram(DeviceMock::FakeShaderDeviceHandle);
+        EXPECT_TRUE(uniformCache.updateValue(DataFieldHandle{ 0u }, value.data(), sizeof(value)));
+
+        const auto resHash = dummyEffectResource.getHash();
+        registerAndProvideResource(resHash, true);
+        uploadShader(resHash);
+        expectResourceUploaded(resHash, DeviceMock::FakeShaderDeviceHandle);
+
+        uniformCache.activateProgram(DeviceMock::FakeShaderDeviceHandle);
+        EXPECT_TRUE(uniformCache.updateValue(DataFieldHandle{ 0u }, value.data(), sizeof(value)));
+        EXPECT_FALSE(uniformCache.updateValue(DataFieldHandle{ 0u }, value.data(), sizeof(value)));
+
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _));
+        makeResourceUnused(resHash);
+    }
+
     TEST_F(AResourceUploadingManager, setsBrokenStatusForEffectIfUploadFailed)
     {
         const auto resHash = dummyEffectResource.getHash();
@@ -871,4 +922,48 @@ namespace ramses::internal
         EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(4);
     }
 
+
+    TEST_F(AResourceUploadingManager_AsyncResourceUpload, uploadsDataResourceInResourceUploadThreadAndRegistersItInMainDevice)
+    {
+        const auto resHash = dummyResource.getHash();
+        registerAndProvideResource(resHash);
+
+        auto& uploadDeviceMock = platformMock.resourceUploadRenderBackendMock.deviceMock;
+        EXPECT_CALL(uploadDeviceMock, allocateIndexBuffer(EDataType::UInt16, 10u)).WillOnce(Return(DeviceMock::FakeIndexBufferDeviceHandle));
+        EXPECT_CALL(uploadDeviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, _, 10u));
+        EXPECT_CALL(uploadDeviceMock, insertFenceAndWait());
+        EXPECT_CALL(uploadDeviceMock, releaseResource(DeviceMock::FakeIndexBufferDeviceHandle));
+        EXPECT_CALL(platformMock.renderBackendMock.deviceMock, registerResource(_));
+
+        // resource uploader used by main thread is not involved
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(0);
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        expectResourceStatus(resHash, EResourceStatus::ScheduledForUpload);
+        EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+        waitWhileScheduledForUpload(resHash);
+        expectResourceUploaded(resHash, DeviceMock::FakeTextureDeviceHandle);
+        EXPECT_EQ(10u, resourceRegistry.getResourceDescriptor(resHash).vramSize);
+
+        EXPECT_CALL(*uploader, unloadResource(_, EResourceType::IndexArray, resHash, DeviceMock::FakeTextureDeviceHandle));
+        makeResourceUnused(resHash);
+    }
+
+    TEST_F(AResourceUploadingManager_AsyncResourceUpload, setsBrokenStatusForDataResourceIfAsyncUploadFailed)
+    {
+        const auto resHash = dummyResource.getHash();
+        registerAndProvideResource(resHash);
+
+        auto& uploadDeviceMock = platformMock.resourceUploadRenderBackendMock.deviceMock;
+        EXPECT_CALL(uploadDeviceMock, allocateIndexBuffer(EDataType::UInt16, 10u)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+        EXPECT_CALL(uploadDeviceMock, uploadIndexBufferData(DeviceResourceHandle::Invalid(), _, 10u));
+        EXPECT_CALL(uploadDeviceMock, insertFenceAndWait());
+        EXPECT_CALL(platformMock.renderBackendMock.deviceMock, registerResource(_)).Times(0);
+
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        waitWhileScheduledForUpload(resHash);
+        expectResourceUploadFailed(resHash);
+
+        makeResourceUnused(resHash);
+    }
 }
@@ -404,4 +404,41 @@ namespace ramses::internal
 
         EXPECT_TRUE(dependencyChecker.getDependentScenesInOrder().empty());
     }
+
+    TEST_F(ASceneDependencyChecker, groupsScenesIntoDependencyLevels)
+    {
+        const SceneId scene1(1u);
+        const SceneId scene2(2u);
+        const SceneId scene3(3u);
+        const SceneId scene4(4u);
+        const SceneId scene5(5u);
+
+        EXPECT_TRUE(dependencyChecker.getDependentScenesInLevels().empty());
+
+        // 1 -> 2 -> 4, 1 -> 3, 5 -> 4
+        EXPECT_TRUE(dependencyChecker.addDependency(scene1, scene2));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene2, scene4));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene1, scene3));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene5, scene4));
+
+        const auto& levels = dependencyChecker.getDependentScenesInLevels();
+        ASSERT_EQ(3u, levels.size());
+        EXPECT_EQ(2u, levels[0].size());
+        EXPECT_TRUE(contains_c(levels[0], scene1));
+        EXPECT_TRUE(contains_c(levels[0], scene5));
+        EXPECT_EQ(2u, levels[1].size());
+        EXPECT_TRUE(contains_c(levels[1], scene2));
+        EXPECT_TRUE(contains_c(levels[1], scene3));
+        EXPECT_EQ(SceneIdVector{ scene4 }, levels[2]);
+
+        dependencyChecker.removeScene(scene2);
+        const auto& levelsAfterRemoval = dependencyChecker.getDependentScenesInLevels();
+        ASSERT_EQ(2u, levelsAfterRemoval.size());
+        EXPECT_EQ(2u, levelsAfterRemoval[0].size());
+        EXPECT_TRUE(contains_c(levelsAfterRemoval[0], scene1));
+        EXPECT_TRUE(contains_c(levelsAfterRemoval[0], scene5));
+        EXPECT_EQ(2u, levelsAfterRemoval[1].size());
+        EXPECT_TRUE(contains_c(levelsAfterRemoval[1], scene3));
+        EXPECT_TRUE(contains_c(levelsAfterRemoval[1], scene4));
+    }
 }
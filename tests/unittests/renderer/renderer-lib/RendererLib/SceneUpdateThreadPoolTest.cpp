@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/RendererLib/SceneUpdateThreadPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    class ASceneUpdateThreadPool : public ::testing::TestWithParam<uint32_t>
+    {
+    protected:
+        void executeAndExpectEachSceneProcessedOnce(SceneUpdateThreadPool& pool, size_t sceneCount)
+        {
+            SceneIdVector scenes;
+            for (size_t i = 0u; i < sceneCount; ++i)
+                scenes.emplace_back(i + 1u);
+
+            std::mutex lock;
+            std::unordered_map<SceneId, uint32_t> processedScenes;
+            pool.execute(scenes, [&](SceneId sceneId) {
+                std::lock_guard<std::mutex> guard(lock);
+                ++processedScenes[sceneId];
+            });
+
+            ASSERT_EQ(sceneCount, processedScenes.size());
+            for (const auto sceneId : scenes)
+                EXPECT_EQ(1u, processedScenes[sceneId]);
+        }
+    };
+
+    INSTANTIATE_TEST_SUITE_P(
+        ASceneUpdateThreadPoolTests,
+        ASceneUpdateThreadPool,
+        ::testing::Values(0u, 1u, 4u));
+
+    TEST_P(ASceneUpdateThreadPool, processesEachSceneExactlyOnce)
+    {
+        SceneUpdateThreadPool pool{ GetParam() };
+        EXPECT_EQ(GetParam(), pool.getWorkerCount());
+
+        executeAndExpectEachSceneProcessedOnce(pool, 0u);
+        executeAndExpectEachSceneProcessedOnce(pool, 1u);
+        executeAndExpectEachSceneProcessedOnce(pool, 3u);
+        executeAndExpectEachSceneProcessedOnce(pool, 50u);
+    }
+
+    TEST_P(ASceneUpdateThreadPool, returnsOnlyAfterAllScenesProcessed)
+    {
+        SceneUpdateThreadPool pool{ GetParam() };
+
+        std::atomic<size_t> processedScenes{ 0u };
+        const SceneIdVector scenes{ SceneId{ 1u }, SceneId{ 2u }, SceneId{ 3u }, SceneId{ 4u }, SceneId{ 5u }, SceneId{ 6u } };
+        for (int i = 0; i < 10; ++i)
+        {
+            processedScenes = 0u;
+            pool.execute(scenes, [&](SceneId /*sceneId*/) {
+                std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+                ++processedScenes;
+            });
+            EXPECT_EQ(scenes.size(), processedScenes);
+        }
+    }
+}
@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ScreenshotFileSaver.h"
+#include "internal/Core/Utils/File.h"
+#include "internal/Core/Utils/Image.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AScreenshotFileSaver : public ::testing::Test
+    {
+    public:
+        void TearDown() override
+        {
+            for (const auto& fileName : m_fileNames)
+                File(fileName).remove();
+        }
+
+    protected:
+        ScreenshotInfo createScreenshot(std::string fileName, uint8_t pixelValue)
+        {
+            m_fileNames.push_back(fileName);
+            ScreenshotInfo screenshot;
+            screenshot.rectangle = { 0u, 0u, 2u, 3u };
+            screenshot.filename = std::move(fileName);
+            screenshot.pixelData.resize(2u * 3u * 4u, pixelValue);
+            return screenshot;
+        }
+
+        std::vector<std::string> m_fileNames;
+    };
+
+    TEST_F(AScreenshotFileSaver, doesNothingIfNoScreenshotSaved)
+    {
+        ScreenshotFileSaver saver;
+    }
+
+    TEST_F(AScreenshotFileSaver, savesAllQueuedScreenshotsBeforeDestruction)
+    {
+        {
+            ScreenshotFileSaver saver;
+            saver.save(createScreenshot("screenshotFileSaverTest1.png", 10u));
+            saver.save(createScreenshot("screenshotFileSaverTest2.png", 20u));
+        }
+
+        for (size_t i = 0u; i < m_fileNames.size(); ++i)
+        {
+            ASSERT_TRUE(File(m_fileNames[i]).exists());
+            Image image;
+            image.loadFromFilePNG(m_fileNames[i]);
+            EXPECT_EQ(2u, image.getWidth());
+            EXPECT_EQ(3u, image.getHeight());
+            EXPECT_EQ(static_cast<uint8_t>((i + 1u) * 10u), image.getData().front());
+        }
+    }
+}
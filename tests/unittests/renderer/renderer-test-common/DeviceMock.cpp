@@ -50,6 +50,9 @@ namespace ramses::internal
         ON_CALL(*this, allocateVertexArray(_)).WillByDefault(Return(FakeVertexArrayDeviceHandle));
         ON_CALL(*this, uploadShader(_)).WillByDefault(Invoke([](const auto& /*unused*/){return std::make_unique<const GPUResource>(1u, 2u);}));
         ON_CALL(*this, registerShader(_)).WillByDefault(Return(FakeShaderDeviceHandle));
+        ON_CALL(*this, releaseResource(_)).WillByDefault(Invoke([](const auto& /*unused*/){return std::make_unique<const GPUResource>(1u, 2u);}));
+        ON_CALL(*this, registerResource(_)).WillByDefault(Return(FakeTextureDeviceHandle));
+        ON_CALL(*this, insertFenceAndWait()).WillByDefault(Return(true));
         ON_CALL(*this, uploadBinaryShader(_, _, _, _)).WillByDefault(Return(FakeShaderDeviceHandle));
         ON_CALL(*this, allocateTexture2D(_, _, _, _, _, _)).WillByDefault(Return(FakeTextureDeviceHandle));
         ON_CALL(*this, uploadRenderBuffer(_, _, _, _, _)).WillByDefault(Return(FakeRenderBufferDeviceHandle));
@@ -69,6 +69,8 @@ namespace ramses::internal
 
         MOCK_METHOD(std::unique_ptr<const GPUResource>, uploadShader, (const EffectResource&), (override));
         MOCK_METHOD(DeviceResourceHandle, registerShader, (std::unique_ptr<const GPUResource>), (override));
+        MOCK_METHOD(DeviceResourceHandle, registerResource, (std::unique_ptr<const GPUResource>), (override));
+        MOCK_METHOD(std::unique_ptr<const GPUResource>, releaseResource, (DeviceResourceHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadBinaryShader, (const EffectResource&, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat), (override));
         MOCK_METHOD(bool, getBinaryShader, (DeviceResourceHandle, std::vector<std::byte>&, BinaryShaderFormatID&), (override));
         MOCK_METHOD(void, deleteShader, (DeviceResourceHandle), (override));
@@ -104,6 +106,9 @@ namespace ramses::internal
         MOCK_METHOD(void, swapDoubleBufferedRenderTarget, (DeviceResourceHandle), (override));
 
         MOCK_METHOD(void, readPixels, (uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t), (override));
+        MOCK_METHOD(DeviceResourceHandle, readPixelsAsync, (uint32_t, uint32_t, uint32_t, uint32_t), (override));
+        MOCK_METHOD(bool, isReadPixelsAsyncFinished, (DeviceResourceHandle), (override));
+        MOCK_METHOD(void, getReadPixelsAsyncResult, (DeviceResourceHandle, uint8_t*), (override));
 
         MOCK_METHOD(uint32_t, getTotalGpuMemoryUsageInKB, (), (const, override));
         MOCK_METHOD(uint32_t, getAndResetDrawCallCount, (), (override));
@@ -114,6 +119,7 @@ namespace ramses::internal
         MOCK_METHOD(bool, isExternalTextureExtensionSupported, (), (const, override));
 
         MOCK_METHOD(void, flush, (), (override));
+        MOCK_METHOD(bool, insertFenceAndWait, (), (override));
 
         MOCK_METHOD(uint32_t, getTextureAddress, (DeviceResourceHandle), (const, override));
         MOCK_METHOD(uint32_t, getGPUHandle, (DeviceResourceHandle), (const, override));